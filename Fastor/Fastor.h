@@ -18,6 +18,7 @@
 #include "simd_math/simd_math.h"
 #include "tensor/Tensor.h"
 #include "tensor/TensorMap.h"
+#include "tensor/DynamicTensor.h"
 #include "tensor/TensorIO.h"
 #include "tensor/TensorFunctions.h"
 #include "tensor/AbstractTensorFunctions.h"
@@ -27,6 +28,7 @@
 #include "tensor_algebra/abstract_contraction.h"
 #include "expressions/expressions.h"
 #include "backend/voigt.h"
+#include "backend/batch.h"
 
 #if defined(_MSC_VER)
 #pragma warning (default: 4003)
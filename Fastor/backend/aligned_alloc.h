@@ -0,0 +1,35 @@
+#ifndef ALIGNED_ALLOC_H
+#define ALIGNED_ALLOC_H
+
+#include "Fastor/config/config.h"
+
+#include <cstdint>
+#include <new>
+
+namespace Fastor {
+
+namespace internal {
+
+/* Heap allocation aligned to FASTOR_MEMORY_ALIGNMENT_VALUE, so that the
+   aligned loads/stores used by the assignment kernels are valid. The
+   pointer returned by operator new is stashed right before the aligned block
+*/
+template<typename T>
+FASTOR_INLINE T* aligned_allocate(FASTOR_INDEX n) {
+    if (n==0) return nullptr;
+    constexpr FASTOR_INDEX alignment = FASTOR_MEMORY_ALIGNMENT_VALUE < alignof(void*) ? alignof(void*) : FASTOR_MEMORY_ALIGNMENT_VALUE;
+    void* raw = ::operator new(n*sizeof(T) + alignment + sizeof(void*));
+    std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<T*>(aligned);
+}
+template<typename T>
+FASTOR_INLINE void aligned_free(T* ptr) {
+    if (ptr) ::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+}
+
+} // end of namespace internal
+
+} // end of namespace Fastor
+
+#endif // ALIGNED_ALLOC_H
@@ -13,12 +13,16 @@
 #include "Fastor/backend/lufact.h"
 #include "Fastor/backend/lut_inverse.h"
 #include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/matmul/matmul_dynamic.h"
+#include "Fastor/backend/matmul/matmul_mixed.h"
 #include "Fastor/backend/matmul/tmatmul.h"
 #include "Fastor/backend/norm.h"
 #include "Fastor/backend/outer.h"
+#include "Fastor/backend/parallel.h"
 #include "Fastor/backend/tensor_cross.h"
 #include "Fastor/backend/trace.h"
 #include "Fastor/backend/transpose/transpose.h"
+#include "Fastor/backend/trsm.h"
 
 #endif // BACKEND_H
 
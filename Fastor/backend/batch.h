@@ -0,0 +1,273 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/backend/eigh.h"
+#include "Fastor/backend/svd.h"
+
+// Batched small matrix kernels
+//
+// A batch of nbatch matrices of shape MxN is stored in an interleaved
+// "SIMD-across-instances" (AoSoA) layout: instances are grouped in blocks
+// of W = SIMDVector<T>::Size and within a block entry (i,j) of all W
+// instances is contiguous, that is element (b,i,j) lives at
+//
+//      ((b/W)*M*N + i*N + j)*W + b%W
+//
+// so that every SIMD lane works on a different matrix. Buffers must hold
+// batch_storage_size<T,M,N>(nbatch) entries. Padding lanes of the last
+// block are filled with copies of the last instance by batch_pack so that
+// no spurious inf/nan is generated by the kernels
+
+namespace Fastor {
+
+/* Number of instances processed together by the batched kernels */
+template<typename T>
+constexpr FASTOR_INLINE FASTOR_INDEX batch_width() {
+    return SIMDVector<T,DEFAULT_ABI>::Size;
+}
+
+/* Number of blocks of batch_width instances required to hold nbatch instances */
+template<typename T>
+FASTOR_INLINE FASTOR_INDEX batch_blocks(FASTOR_INDEX nbatch) {
+    return (nbatch + batch_width<T>() - 1) / batch_width<T>();
+}
+
+/* Number of entries of type T needed to store nbatch instances of shape Rest... */
+template<typename T, size_t ... Rest>
+FASTOR_INLINE FASTOR_INDEX batch_storage_size(FASTOR_INDEX nbatch) {
+    return batch_blocks<T>(nbatch) * batch_width<T>() * pack_prod<Rest...>::value;
+}
+
+
+// Layout conversion
+//----------------------------------------------------------------------------------------------------------//
+/* Interleave an array of nbatch tensors in to the AoSoA layout */
+template<typename T, size_t ... Rest>
+FASTOR_INLINE void batch_pack(const Tensor<T,Rest...> *FASTOR_RESTRICT src, T *FASTOR_RESTRICT dst, FASTOR_INDEX nbatch) {
+    FASTOR_ASSERT(nbatch > 0, "BATCH SIZE MUST BE GREATER THAN ZERO");
+    constexpr FASTOR_INDEX W    = batch_width<T>();
+    constexpr FASTOR_INDEX Size = pack_prod<Rest...>::value;
+    const FASTOR_INDEX nblocks  = batch_blocks<T>(nbatch);
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        T *FASTOR_RESTRICT block = dst + blk*Size*W;
+        for (FASTOR_INDEX lane=0; lane<W; ++lane) {
+            const FASTOR_INDEX b = blk*W+lane < nbatch ? blk*W+lane : nbatch-1;
+            const T *FASTOR_RESTRICT src_data = src[b].data();
+            for (FASTOR_INDEX i=0; i<Size; ++i) {
+                block[i*W+lane] = src_data[i];
+            }
+        }
+    }
+}
+
+/* De-interleave the AoSoA layout back in to an array of nbatch tensors */
+template<typename T, size_t ... Rest>
+FASTOR_INLINE void batch_unpack(const T *FASTOR_RESTRICT src, Tensor<T,Rest...> *FASTOR_RESTRICT dst, FASTOR_INDEX nbatch) {
+    constexpr FASTOR_INDEX W    = batch_width<T>();
+    constexpr FASTOR_INDEX Size = pack_prod<Rest...>::value;
+    for (FASTOR_INDEX b=0; b<nbatch; ++b) {
+        const T *FASTOR_RESTRICT block = src + (b/W)*Size*W;
+        const FASTOR_INDEX lane = b % W;
+        T *FASTOR_RESTRICT dst_data = dst[b].data();
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            dst_data[i] = block[i*W+lane];
+        }
+    }
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+
+// Kernels - these operate on a single block of batch_width instances
+//----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<typename V, size_t Size>
+FASTOR_INLINE void _batch_load(const typename V::scalar_value_type *FASTOR_RESTRICT src, V *FASTOR_RESTRICT dst) {
+    for (FASTOR_INDEX i=0; i<Size; ++i) {
+        dst[i].load(src+i*V::Size,false);
+    }
+}
+
+template<typename V, size_t Size>
+FASTOR_INLINE void _batch_store(const V *FASTOR_RESTRICT src, typename V::scalar_value_type *FASTOR_RESTRICT dst) {
+    for (FASTOR_INDEX i=0; i<Size; ++i) {
+        src[i].store(dst+i*V::Size,false);
+    }
+}
+
+template<typename V, size_t M, size_t K, size_t N>
+FASTOR_INLINE void _batch_matmul_block(const typename V::scalar_value_type *FASTOR_RESTRICT a,
+                                       const typename V::scalar_value_type *FASTOR_RESTRICT b,
+                                       typename V::scalar_value_type *FASTOR_RESTRICT out) {
+    constexpr FASTOR_INDEX W = V::Size;
+    V brow[N];
+    for (FASTOR_INDEX i=0; i<M; ++i) {
+        V out_row[N];
+        for (FASTOR_INDEX k=0; k<K; ++k) {
+            const V a_ik(a+(i*K+k)*W,false);
+            _batch_load<V,N>(b+k*N*W,brow);
+            for (FASTOR_INDEX j=0; j<N; ++j) {
+                out_row[j] = fmadd(a_ik,brow[j],out_row[j]);
+            }
+        }
+        _batch_store<V,N>(out_row,out+i*N*W);
+    }
+}
+
+/* Closed form determinants for up to 4x4 are evaluated lane-wise using the
+   scalar kernels in determinant.h with the SIMD vector as the scalar type
+*/
+template<typename V, size_t M, enable_if_t_<is_equal_v_<M,1>, bool> = false>
+FASTOR_INLINE V _batch_det_block(V *FASTOR_RESTRICT a) {
+    return a[0];
+}
+template<typename V, size_t M, enable_if_t_<is_greater_v_<M,1> && is_less_equal_v_<M,4>, bool> = false>
+FASTOR_INLINE V _batch_det_block(V *FASTOR_RESTRICT a) {
+    return _det<V,M,M>(a);
+}
+/* Beyond 4x4 Gaussian elimination without pivoting is used as pivoting
+   would require different row swaps in every lane
+*/
+template<typename V, size_t M, enable_if_t_<is_greater_v_<M,4>, bool> = false>
+FASTOR_INLINE V _batch_det_block(V *FASTOR_RESTRICT a) {
+    using T = typename V::scalar_value_type;
+    V det(a[0]);
+    for (FASTOR_INDEX k=0; k<M; ++k) {
+        const V inv_pivot = V(T(1)) / a[k*M+k];
+        for (FASTOR_INDEX i=k+1; i<M; ++i) {
+            const V factor = a[i*M+k] * inv_pivot;
+            for (FASTOR_INDEX j=k+1; j<M; ++j) {
+                a[i*M+j] -= factor * a[k*M+j];
+            }
+        }
+        if (k>0) det *= a[k*M+k];
+    }
+    return det;
+}
+
+template<typename V, size_t M, enable_if_t_<is_less_equal_v_<M,4>, bool> = false>
+FASTOR_INLINE void _batch_inverse_block(V *FASTOR_RESTRICT a, V *FASTOR_RESTRICT out) {
+    _inverse<V,M>(a,out);
+}
+/* Gauss-Jordan elimination without pivoting */
+template<typename V, size_t M, enable_if_t_<is_greater_v_<M,4>, bool> = false>
+FASTOR_INLINE void _batch_inverse_block(V *FASTOR_RESTRICT a, V *FASTOR_RESTRICT out) {
+    using T = typename V::scalar_value_type;
+    for (FASTOR_INDEX i=0; i<M; ++i) {
+        for (FASTOR_INDEX j=0; j<M; ++j) {
+            out[i*M+j] = i==j ? V(T(1)) : V();
+        }
+    }
+    for (FASTOR_INDEX k=0; k<M; ++k) {
+        const V inv_pivot = V(T(1)) / a[k*M+k];
+        for (FASTOR_INDEX j=0; j<M; ++j) {
+            a[k*M+j]   *= inv_pivot;
+            out[k*M+j] *= inv_pivot;
+        }
+        for (FASTOR_INDEX i=0; i<M; ++i) {
+            if (i==k) continue;
+            const V factor = a[i*M+k];
+            for (FASTOR_INDEX j=0; j<M; ++j) {
+                a[i*M+j]   -= factor * a[k*M+j];
+                out[i*M+j] -= factor * out[k*M+j];
+            }
+        }
+    }
+}
+
+} // internal
+//----------------------------------------------------------------------------------------------------------//
+
+
+
+// Batched operations on AoSoA buffers
+//----------------------------------------------------------------------------------------------------------//
+/* out[b] = a[b] * b[b] for a batch of (MxK) * (KxN) matrix-matrix multiplications */
+template<typename T, size_t M, size_t K, size_t N>
+FASTOR_INLINE void batch_matmul(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_matmul_block<V,M,K,N>(a+blk*M*K*V::Size, b+blk*K*N*V::Size, out+blk*M*N*V::Size);
+    }
+}
+
+/* out[b] = det(a[b]) for a batch of MxM matrices. As the result is a scalar per
+   instance out is simply a contiguous array of batch_blocks*batch_width entries
+*/
+template<typename T, size_t M>
+FASTOR_INLINE void batch_determinant(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    V a_block[M*M];
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_load<V,M*M>(a+blk*M*M*V::Size, a_block);
+        internal::_batch_det_block<V,M>(a_block).store(out+blk*V::Size,false);
+    }
+}
+
+/* out[b] = inverse(a[b]) for a batch of MxM matrices */
+template<typename T, size_t M>
+FASTOR_INLINE void batch_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    V a_block[M*M], out_block[M*M];
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_load<V,M*M>(a+blk*M*M*V::Size, a_block);
+        internal::_batch_inverse_block<V,M>(a_block,out_block);
+        internal::_batch_store<V,M*M>(out_block,out+blk*M*M*V::Size);
+    }
+}
+
+/* Eigen decomposition of a batch of symmetric 2x2 or 3x3 matrices. w holds the
+    eigenvalues of every instance in the AoSoA layout of Tensor<T,M> and v the
+    eigenvectors in the AoSoA layout of Tensor<T,M,M> [see _eigh]
+*/
+template<typename T, size_t M>
+FASTOR_INLINE void batch_eigh(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    V a_block[M*M], w_block[M], v_block[M*M];
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_load<V,M*M>(a+blk*M*M*V::Size, a_block);
+        _eigh<V,M>(a_block,w_block,v_block);
+        internal::_batch_store<V,M>(w_block,w+blk*M*V::Size);
+        internal::_batch_store<V,M*M>(v_block,v+blk*M*M*V::Size);
+    }
+}
+
+/* Singular value decomposition of a batch of 2x2 or 3x3 matrices [see _svd] */
+template<typename T, size_t M>
+FASTOR_INLINE void batch_svd(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT v, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    V a_block[M*M], u_block[M*M], s_block[M], v_block[M*M];
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_load<V,M*M>(a+blk*M*M*V::Size, a_block);
+        _svd<V,M>(a_block,u_block,s_block,v_block);
+        internal::_batch_store<V,M*M>(u_block,u+blk*M*M*V::Size);
+        internal::_batch_store<V,M>(s_block,s+blk*M*V::Size);
+        internal::_batch_store<V,M*M>(v_block,v+blk*M*M*V::Size);
+    }
+}
+
+/* Right polar decomposition F = R * U of a batch of 2x2 or 3x3 matrices [see _polar] */
+template<typename T, size_t M>
+FASTOR_INLINE void batch_polar(const T *FASTOR_RESTRICT f, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT u, FASTOR_INDEX nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const FASTOR_INDEX nblocks = batch_blocks<T>(nbatch);
+    V f_block[M*M], r_block[M*M], u_block[M*M];
+    for (FASTOR_INDEX blk=0; blk<nblocks; ++blk) {
+        internal::_batch_load<V,M*M>(f+blk*M*M*V::Size, f_block);
+        _polar<V,M>(f_block,r_block,u_block);
+        internal::_batch_store<V,M*M>(r_block,r+blk*M*M*V::Size);
+        internal::_batch_store<V,M*M>(u_block,u+blk*M*M*V::Size);
+    }
+}
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // BATCH_H
@@ -0,0 +1,113 @@
+#ifndef CHOLFACT_H
+#define CHOLFACT_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/backend/inner.h"
+
+#include <cmath>
+
+namespace Fastor {
+
+namespace internal {
+
+/* Dot product of the first K entries of two rows of L */
+template<typename T, size_t K, enable_if_t_<K==0, bool> = false>
+FASTOR_INLINE T _chol_dot(const T* FASTOR_RESTRICT, const T* FASTOR_RESTRICT) {
+    return T(0);
+}
+template<typename T, size_t K, enable_if_t_<is_greater_v_<K,0>, bool> = false>
+FASTOR_INLINE T _chol_dot(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT b) {
+    return _inner<T,K>(a,b);
+}
+
+/* Compile time recursive loop over the rows i of column j of L [Cholesky-Crout]
+    L(i,j) = (A(i,j) - L(i,0:j) . L(j,0:j)) / L(j,j)
+*/
+template<size_t i, size_t j, size_t N>
+struct cholfact_row_impl {
+    template<typename T>
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L, const T inv_ljj) {
+        L[i*N+j] = (A[i*N+j] - _chol_dot<T,j>(&L[i*N],&L[j*N])) * inv_ljj;
+        cholfact_row_impl<i+1,j,N>::Do(A, L, inv_ljj);
+    }
+};
+template<size_t j, size_t N>
+struct cholfact_row_impl<N,j,N> {
+    template<typename T>
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT, T *FASTOR_RESTRICT, const T) {}
+};
+
+/* Compile time recursive loop over the columns j of L */
+template<size_t j, size_t N>
+struct cholfact_col_impl {
+    template<typename T>
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L) {
+        const T ljj = std::sqrt(A[j*N+j] - _chol_dot<T,j>(&L[j*N],&L[j*N]));
+        L[j*N+j] = ljj;
+        cholfact_row_impl<j+1,j,N>::Do(A, L, T(1)/ljj);
+        cholfact_col_impl<j+1,N>::Do(A, L);
+    }
+};
+template<size_t N>
+struct cholfact_col_impl<N,N> {
+    template<typename T>
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT, T *FASTOR_RESTRICT) {}
+};
+
+} // internal
+
+
+/* Cholesky factorisation A = L * L^T of a symmetric positive definite matrix.
+    Only the lower triangular part of A is read and L has to be zero on entry
+    as its strictly upper triangular part is not written to
+*/
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,1>, bool> = false>
+FASTOR_INLINE void _cholfact(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L) {
+    L[0] = std::sqrt(A[0]);
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2>, bool> = false>
+FASTOR_INLINE void _cholfact(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L) {
+
+    // [a11 a12]   [l11   0] [l11 l21]
+    // [a21 a22]   [l21 l22] [0   l22]
+
+    const T L11 = std::sqrt(A[0]);
+    const T L21 = A[2] / L11;
+
+    L[0] = L11;
+    L[2] = L21;
+    L[3] = std::sqrt(A[3] - L21 * L21);
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _cholfact(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L) {
+
+    const T L11 = std::sqrt(A[0]);
+    const T inv_L11 = T(1) / L11;
+    const T L21 = A[3] * inv_L11;
+    const T L31 = A[6] * inv_L11;
+
+    const T L22 = std::sqrt(A[4] - L21 * L21);
+    const T L32 = (A[7] - L31 * L21) / L22;
+
+    const T L33 = std::sqrt(A[8] - L31 * L31 - L32 * L32);
+
+    L[0] = L11;
+    L[3] = L21;
+    L[4] = L22;
+    L[6] = L31;
+    L[7] = L32;
+    L[8] = L33;
+}
+
+template<typename T, size_t N, enable_if_t_<is_greater_equal_v_<N,4> && is_less_equal_v_<N,8>, bool> = false>
+FASTOR_INLINE void _cholfact(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT L) {
+    internal::cholfact_col_impl<0,N>::Do(A, L);
+}
+
+} // end of namespace Fastor
+
+#endif // CHOLFACT_H
@@ -0,0 +1,129 @@
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/config/cpuid.h"
+#include "Fastor/meta/meta.h"
+
+// Runtime CPU dispatch
+//
+// Fastor's SIMD types are chosen at compile time from the instruction set
+// macros of the compiler. With FASTOR_USE_RUNTIME_DISPATCH the large
+// matrix-matrix and matrix-vector kernels are in addition compiled for
+// AVX2/FMA and AVX512F using target attributes, and the best one the CPU
+// supports is selected at runtime using CPUID. Kernels are only dispatched
+// to when the CPU supports a wider instruction set than the one Fastor has
+// been compiled for, so a -march=native build is unaffected
+#if defined(FASTOR_USE_RUNTIME_DISPATCH) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FASTOR_HAS_RUNTIME_DISPATCH 1
+#endif
+
+namespace Fastor {
+
+// Instruction sets that kernels can be dispatched to
+enum class DispatchISA : int
+{
+    Scalar = 0,     /* No SIMD                                   */
+    SSE2,           /* SSE2                                      */
+    AVX2,           /* AVX2 and FMA                              */
+    AVX512,         /* AVX512F                                   */
+};
+
+/* Best instruction set supported by the CPU and the OS */
+inline DispatchISA detected_isa() {
+    const CPUFeatures &features = cpu_features();
+    if (features.avx512f) return DispatchISA::AVX512;
+    if (features.avx2 && features.fma) return DispatchISA::AVX2;
+    if (features.sse2) return DispatchISA::SSE2;
+    return DispatchISA::Scalar;
+}
+
+/* Instruction set Fastor has been compiled for */
+constexpr DispatchISA compiled_isa() {
+#if defined(FASTOR_AVX512F_IMPL)
+    return DispatchISA::AVX512;
+#elif defined(FASTOR_AVX2_IMPL) && defined(FASTOR_FMA_IMPL)
+    return DispatchISA::AVX2;
+#elif defined(FASTOR_SSE2_IMPL)
+    return DispatchISA::SSE2;
+#else
+    return DispatchISA::Scalar;
+#endif
+}
+
+namespace internal {
+inline DispatchISA& _dispatch_isa() {
+    static DispatchISA isa = detected_isa();
+    return isa;
+}
+} // internal
+
+/* Instruction set that kernels are currently dispatched to */
+inline DispatchISA get_dispatch_isa() {
+    return internal::_dispatch_isa();
+}
+
+/* Restrict dispatching to a given instruction set, for instance for testing
+   or benchmarking. Requests beyond what the CPU supports are ignored
+*/
+inline void set_dispatch_isa(DispatchISA isa) {
+    internal::_dispatch_isa() = int(isa) <= int(detected_isa()) ? isa : detected_isa();
+}
+
+} // end of namespace Fastor
+
+
+#ifdef FASTOR_HAS_RUNTIME_DISPATCH
+
+#include "Fastor/backend/dispatch/dispatch_ops.h"
+
+namespace Fastor {
+
+namespace internal {
+
+namespace dispatch_avx2 {
+template<typename T> using ops = avx2_ops<T>;
+#define FASTOR_DISPATCH_TARGET FASTOR_TARGET_AVX2
+#include "Fastor/backend/dispatch/dispatch_kernels.h"
+#undef FASTOR_DISPATCH_TARGET
+} // dispatch_avx2
+
+namespace dispatch_avx512 {
+template<typename T> using ops = avx512_ops<T>;
+#define FASTOR_DISPATCH_TARGET FASTOR_TARGET_AVX512
+#include "Fastor/backend/dispatch/dispatch_kernels.h"
+#undef FASTOR_DISPATCH_TARGET
+} // dispatch_avx512
+
+/* out = alpha*a*b + beta*out. Returns false if no kernel for an instruction
+   set wider than the compiled one is available, in which case the caller
+   has to fall back to its own implementation
+*/
+template<typename T, enable_if_t_<is_same_v_<T,float> || is_same_v_<T,double>,bool> = false>
+FASTOR_INLINE bool dispatch_gemm(const FASTOR_INDEX M, const FASTOR_INDEX K, const FASTOR_INDEX N,
+    const T alpha, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const T beta, T * FASTOR_RESTRICT out) {
+    const DispatchISA isa = get_dispatch_isa();
+    if (int(isa) <= int(compiled_isa())) return false;
+    if (isa == DispatchISA::AVX512) {
+        dispatch_avx512::gemm<T>(M,K,N,alpha,a,b,beta,out);
+        return true;
+    }
+    if (isa == DispatchISA::AVX2) {
+        dispatch_avx2::gemm<T>(M,K,N,alpha,a,b,beta,out);
+        return true;
+    }
+    return false;
+}
+template<typename T, enable_if_t_<!is_same_v_<T,float> && !is_same_v_<T,double>,bool> = false>
+FASTOR_INLINE bool dispatch_gemm(const FASTOR_INDEX, const FASTOR_INDEX, const FASTOR_INDEX,
+    const T, const T * FASTOR_RESTRICT, const T * FASTOR_RESTRICT, const T, T * FASTOR_RESTRICT) {
+    return false;
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // FASTOR_HAS_RUNTIME_DISPATCH
+
+#endif // DISPATCH_H
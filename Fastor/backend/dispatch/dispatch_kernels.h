@@ -0,0 +1,134 @@
+// Kernels compiled once per dispatchable instruction set. This file is
+// included by dispatch.h inside an instruction set specific namespace that
+// provides the ops<T> intrinsic wrappers and FASTOR_DISPATCH_TARGET, hence
+// there is no include guard
+
+
+template<typename T>
+FASTOR_DISPATCH_TARGET FASTOR_INLINE void _gemm_store(typename ops<T>::reg valpha, typename ops<T>::reg acc,
+    typename ops<T>::reg vbeta, T * FASTOR_RESTRICT out, bool accumulate) {
+    using O = ops<T>;
+    if (accumulate) O::store(out, O::fmadd(valpha,acc,O::mul(vbeta,O::load(out))));
+    else O::store(out, O::mul(valpha,acc));
+}
+template<typename T>
+FASTOR_DISPATCH_TARGET FASTOR_INLINE void _gemm_store(typename ops<T>::reg valpha, typename ops<T>::reg acc,
+    typename ops<T>::reg vbeta, T * FASTOR_RESTRICT out, bool accumulate, typename ops<T>::mask m) {
+    using O = ops<T>;
+    if (accumulate) O::store(out, O::fmadd(valpha,acc,O::mul(vbeta,O::load(out,m))), m);
+    else O::store(out, O::mul(valpha,acc), m);
+}
+
+/* out = alpha*a*b + beta*out for row-major a (MxK), b (KxN) and out (MxN)
+   using a 4 x 2*ops<T>::Size register tile, the column remainder is computed
+   with masked loads and stores. When beta is zero out is never read
+*/
+template<typename T>
+FASTOR_DISPATCH_TARGET FASTOR_NOINLINE void gemm(const FASTOR_INDEX M, const FASTOR_INDEX K, const FASTOR_INDEX N,
+    const T alpha, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const T beta, T * FASTOR_RESTRICT out) {
+
+    using O = ops<T>;
+    using R = typename O::reg;
+    using M_t = typename O::mask;
+    constexpr FASTOR_INDEX W = O::Size;
+    const bool accumulate = beta != T(0);
+    const R valpha = O::set1(alpha), vbeta = O::set1(beta);
+
+    // matrix-vector
+    if (N==1) {
+        for (FASTOR_INDEX i=0; i<M; ++i) {
+            R acc = O::zero();
+            FASTOR_INDEX k=0;
+            for (; k+W<=K; k+=W) {
+                acc = O::fmadd(O::load(&a[i*K+k]),O::load(&b[k]),acc);
+            }
+            T sacc = O::sum(acc);
+            for (; k<K; ++k) {
+                sacc += a[i*K+k]*b[k];
+            }
+            out[i] = accumulate ? alpha*sacc + beta*out[i] : alpha*sacc;
+        }
+        return;
+    }
+
+    FASTOR_INDEX i=0;
+    for (; i+4<=M; i+=4) {
+        const T * FASTOR_RESTRICT a0 = &a[ i   *K];
+        const T * FASTOR_RESTRICT a1 = &a[(i+1)*K];
+        const T * FASTOR_RESTRICT a2 = &a[(i+2)*K];
+        const T * FASTOR_RESTRICT a3 = &a[(i+3)*K];
+        FASTOR_INDEX j=0;
+        for (; j+2*W<=N; j+=2*W) {
+            R c00 = O::zero(), c01 = O::zero(), c10 = O::zero(), c11 = O::zero();
+            R c20 = O::zero(), c21 = O::zero(), c30 = O::zero(), c31 = O::zero();
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                const R b0 = O::load(&b[k*N+j]);
+                const R b1 = O::load(&b[k*N+j+W]);
+                R av = O::set1(a0[k]);
+                c00 = O::fmadd(av,b0,c00); c01 = O::fmadd(av,b1,c01);
+                av = O::set1(a1[k]);
+                c10 = O::fmadd(av,b0,c10); c11 = O::fmadd(av,b1,c11);
+                av = O::set1(a2[k]);
+                c20 = O::fmadd(av,b0,c20); c21 = O::fmadd(av,b1,c21);
+                av = O::set1(a3[k]);
+                c30 = O::fmadd(av,b0,c30); c31 = O::fmadd(av,b1,c31);
+            }
+            _gemm_store<T>(valpha,c00,vbeta,&out[ i   *N+j  ],accumulate);
+            _gemm_store<T>(valpha,c01,vbeta,&out[ i   *N+j+W],accumulate);
+            _gemm_store<T>(valpha,c10,vbeta,&out[(i+1)*N+j  ],accumulate);
+            _gemm_store<T>(valpha,c11,vbeta,&out[(i+1)*N+j+W],accumulate);
+            _gemm_store<T>(valpha,c20,vbeta,&out[(i+2)*N+j  ],accumulate);
+            _gemm_store<T>(valpha,c21,vbeta,&out[(i+2)*N+j+W],accumulate);
+            _gemm_store<T>(valpha,c30,vbeta,&out[(i+3)*N+j  ],accumulate);
+            _gemm_store<T>(valpha,c31,vbeta,&out[(i+3)*N+j+W],accumulate);
+        }
+        for (; j+W<=N; j+=W) {
+            R c0 = O::zero(), c1 = O::zero(), c2 = O::zero(), c3 = O::zero();
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                const R b0 = O::load(&b[k*N+j]);
+                c0 = O::fmadd(O::set1(a0[k]),b0,c0);
+                c1 = O::fmadd(O::set1(a1[k]),b0,c1);
+                c2 = O::fmadd(O::set1(a2[k]),b0,c2);
+                c3 = O::fmadd(O::set1(a3[k]),b0,c3);
+            }
+            _gemm_store<T>(valpha,c0,vbeta,&out[ i   *N+j],accumulate);
+            _gemm_store<T>(valpha,c1,vbeta,&out[(i+1)*N+j],accumulate);
+            _gemm_store<T>(valpha,c2,vbeta,&out[(i+2)*N+j],accumulate);
+            _gemm_store<T>(valpha,c3,vbeta,&out[(i+3)*N+j],accumulate);
+        }
+        // column remainder using masked loads and stores
+        if (j<N) {
+            const M_t m = O::make_mask(N-j);
+            R c0 = O::zero(), c1 = O::zero(), c2 = O::zero(), c3 = O::zero();
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                const R b0 = O::load(&b[k*N+j],m);
+                c0 = O::fmadd(O::set1(a0[k]),b0,c0);
+                c1 = O::fmadd(O::set1(a1[k]),b0,c1);
+                c2 = O::fmadd(O::set1(a2[k]),b0,c2);
+                c3 = O::fmadd(O::set1(a3[k]),b0,c3);
+            }
+            _gemm_store<T>(valpha,c0,vbeta,&out[ i   *N+j],accumulate,m);
+            _gemm_store<T>(valpha,c1,vbeta,&out[(i+1)*N+j],accumulate,m);
+            _gemm_store<T>(valpha,c2,vbeta,&out[(i+2)*N+j],accumulate,m);
+            _gemm_store<T>(valpha,c3,vbeta,&out[(i+3)*N+j],accumulate,m);
+        }
+    }
+    for (; i<M; ++i) {
+        FASTOR_INDEX j=0;
+        for (; j+W<=N; j+=W) {
+            R acc = O::zero();
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                acc = O::fmadd(O::set1(a[i*K+k]),O::load(&b[k*N+j]),acc);
+            }
+            _gemm_store<T>(valpha,acc,vbeta,&out[i*N+j],accumulate);
+        }
+        if (j<N) {
+            const M_t m = O::make_mask(N-j);
+            R acc = O::zero();
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                acc = O::fmadd(O::set1(a[i*K+k]),O::load(&b[k*N+j],m),acc);
+            }
+            _gemm_store<T>(valpha,acc,vbeta,&out[i*N+j],accumulate,m);
+        }
+    }
+}
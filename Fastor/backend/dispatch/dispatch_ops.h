@@ -0,0 +1,108 @@
+#ifndef DISPATCH_OPS_H
+#define DISPATCH_OPS_H
+
+#include <immintrin.h>
+
+// Thin wrappers over the intrinsics of every instruction set that can be
+// dispatched to at runtime. Each wrapper carries the target attribute of
+// its instruction set so that it can be used in a translation unit that
+// is compiled for a lower instruction set
+
+#define FASTOR_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define FASTOR_TARGET_AVX512 __attribute__((target("avx512f")))
+
+namespace Fastor {
+
+namespace internal {
+
+template<typename T> struct avx2_ops;
+template<typename T> struct avx512_ops;
+
+template<>
+struct avx2_ops<double> {
+    using reg = __m256d;
+    using mask = __m256i;
+    static constexpr FASTOR_INDEX Size = 4;
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg zero() {return _mm256_setzero_pd();}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg set1(double a) {return _mm256_set1_pd(a);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg load(const double *a) {return _mm256_loadu_pd(a);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE void store(double *a, reg v) {_mm256_storeu_pd(a,v);}
+    // first n < Size lanes only
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE mask make_mask(FASTOR_INDEX n) {
+        return _mm256_cmpgt_epi64(_mm256_set1_epi64x((long long)n),_mm256_setr_epi64x(0,1,2,3));
+    }
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg load(const double *a, mask m) {return _mm256_maskload_pd(a,m);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE void store(double *a, reg v, mask m) {_mm256_maskstore_pd(a,m,v);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg mul(reg a, reg b) {return _mm256_mul_pd(a,b);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg fmadd(reg a, reg b, reg c) {return _mm256_fmadd_pd(a,b,c);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE double sum(reg a) {
+        __m128d r = _mm_add_pd(_mm256_castpd256_pd128(a),_mm256_extractf128_pd(a,1));
+        return _mm_cvtsd_f64(_mm_add_sd(r,_mm_unpackhi_pd(r,r)));
+    }
+};
+
+template<>
+struct avx2_ops<float> {
+    using reg = __m256;
+    using mask = __m256i;
+    static constexpr FASTOR_INDEX Size = 8;
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg zero() {return _mm256_setzero_ps();}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg set1(float a) {return _mm256_set1_ps(a);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg load(const float *a) {return _mm256_loadu_ps(a);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE void store(float *a, reg v) {_mm256_storeu_ps(a,v);}
+    // first n < Size lanes only
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE mask make_mask(FASTOR_INDEX n) {
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32((int)n),_mm256_setr_epi32(0,1,2,3,4,5,6,7));
+    }
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg load(const float *a, mask m) {return _mm256_maskload_ps(a,m);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE void store(float *a, reg v, mask m) {_mm256_maskstore_ps(a,m,v);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg mul(reg a, reg b) {return _mm256_mul_ps(a,b);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE reg fmadd(reg a, reg b, reg c) {return _mm256_fmadd_ps(a,b,c);}
+    FASTOR_TARGET_AVX2 static FASTOR_INLINE float sum(reg a) {
+        __m128 r = _mm_add_ps(_mm256_castps256_ps128(a),_mm256_extractf128_ps(a,1));
+        r = _mm_add_ps(r,_mm_movehl_ps(r,r));
+        return _mm_cvtss_f32(_mm_add_ss(r,_mm_shuffle_ps(r,r,1)));
+    }
+};
+
+template<>
+struct avx512_ops<double> {
+    using reg = __m512d;
+    using mask = __mmask8;
+    static constexpr FASTOR_INDEX Size = 8;
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg zero() {return _mm512_setzero_pd();}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg set1(double a) {return _mm512_set1_pd(a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg load(const double *a) {return _mm512_loadu_pd(a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE void store(double *a, reg v) {_mm512_storeu_pd(a,v);}
+    // first n < Size lanes only
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE mask make_mask(FASTOR_INDEX n) {return mask((1U << n) - 1U);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg load(const double *a, mask m) {return _mm512_maskz_loadu_pd(m,a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE void store(double *a, reg v, mask m) {_mm512_mask_storeu_pd(a,m,v);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg mul(reg a, reg b) {return _mm512_mul_pd(a,b);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg fmadd(reg a, reg b, reg c) {return _mm512_fmadd_pd(a,b,c);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE double sum(reg a) {return _mm512_reduce_add_pd(a);}
+};
+
+template<>
+struct avx512_ops<float> {
+    using reg = __m512;
+    using mask = __mmask16;
+    static constexpr FASTOR_INDEX Size = 16;
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg zero() {return _mm512_setzero_ps();}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg set1(float a) {return _mm512_set1_ps(a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg load(const float *a) {return _mm512_loadu_ps(a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE void store(float *a, reg v) {_mm512_storeu_ps(a,v);}
+    // first n < Size lanes only
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE mask make_mask(FASTOR_INDEX n) {return mask((1U << n) - 1U);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg load(const float *a, mask m) {return _mm512_maskz_loadu_ps(m,a);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE void store(float *a, reg v, mask m) {_mm512_mask_storeu_ps(a,m,v);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg mul(reg a, reg b) {return _mm512_mul_ps(a,b);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE reg fmadd(reg a, reg b, reg c) {return _mm512_fmadd_ps(a,b,c);}
+    FASTOR_TARGET_AVX512 static FASTOR_INLINE float sum(reg a) {return _mm512_reduce_add_ps(a);}
+};
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // DISPATCH_OPS_H
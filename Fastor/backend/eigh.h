@@ -0,0 +1,194 @@
+#ifndef EIGH_H
+#define EIGH_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/simd_math/simd_math.h"
+
+#include <cmath>
+#include <limits>
+
+// Eigen decomposition of small symmetric matrices
+//
+// The kernels in this file are written for a generic "scalar-like" type T
+// which is either a primitive floating point type or a SIMDVector. In the
+// latter case every lane works on a different matrix [see batch.h]. For this
+// reason the kernels do not branch on values: a fixed number of cyclic Jacobi
+// sweeps is performed and sorting is done with arithmetic blends
+
+namespace Fastor {
+
+namespace internal {
+
+template<typename T>
+struct _eig_scalar { using type = T; };
+template<typename T, typename ABI>
+struct _eig_scalar<SIMDVector<T,ABI>> { using type = T; };
+
+/* Number of cyclic Jacobi sweeps for 3x3 matrices. Convergence is quadratic
+    so this is enough to reach machine precision
+*/
+template<typename T>
+constexpr FASTOR_INLINE size_t _jacobi_sweeps() {
+    return sizeof(typename _eig_scalar<T>::type) > 4 ? 5 : 4;
+}
+
+template<typename T>
+constexpr FASTOR_INLINE T _eig_tiny() {
+    return std::numeric_limits<T>::min();
+}
+
+template<typename T, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE T _eig_sqrt(T a) {return sqrts(a);}
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> _eig_sqrt(const SIMDVector<T,ABI> &a) {return sqrt(a);}
+
+template<typename T, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE T _eig_abs(T a) {return std::abs(a);}
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> _eig_abs(const SIMDVector<T,ABI> &a) {return abs(a);}
+
+template<typename T, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE T _eig_max(T a, T b) {return std::max(a,b);}
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> _eig_max(const SIMDVector<T,ABI> &a, const SIMDVector<T,ABI> &b) {return max(a,b);}
+
+/* +1 or -1 with the sign of a [+1 for +0] */
+template<typename T, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE T _eig_sign(T a) {return std::copysign(T(1),a);}
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> _eig_sign(const SIMDVector<T,ABI> &a) {return copysign(SIMDVector<T,ABI>(T(1)),a);}
+
+
+/* Jacobi rotation annihilating a(p,q) of the symmetric NxN matrix a and
+    accumulating the rotation in to the columns of v
+*/
+template<size_t p, size_t q, size_t N, typename T>
+FASTOR_INLINE void _jacobi_rotate(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT v) {
+    using S = typename _eig_scalar<T>::type;
+
+    const T apq = a[p*N+q];
+    const T d   = a[q*N+q] - a[p*N+p];
+    // t = tan(theta) with |theta| <= pi/4, t = 0 when a(p,q) = 0
+    const T t   = _eig_sign(d) * (apq + apq) / (_eig_abs(d) + _eig_sqrt(d*d + T(S(4))*apq*apq) + T(_eig_tiny<S>()));
+    const T c   = T(S(1)) / _eig_sqrt(T(S(1)) + t*t);
+    const T s   = t*c;
+
+    a[p*N+p] -= t*apq;
+    a[q*N+q] += t*apq;
+    a[p*N+q]  = T(S(0));
+    a[q*N+p]  = T(S(0));
+
+    for (size_t r=0; r<N; ++r) {
+        if (r==p || r==q) continue;
+        const T arp = a[r*N+p];
+        const T arq = a[r*N+q];
+        a[r*N+p] = a[p*N+r] = c*arp - s*arq;
+        a[r*N+q] = a[q*N+r] = s*arp + c*arq;
+    }
+
+    for (size_t k=0; k<N; ++k) {
+        const T vkp = v[k*N+p];
+        const T vkq = v[k*N+q];
+        v[k*N+p] = c*vkp - s*vkq;
+        v[k*N+q] = s*vkp + c*vkq;
+    }
+}
+
+/* Swap eigenpair i and j if w[i] > w[j] without branching */
+template<size_t i, size_t j, size_t N, typename T>
+FASTOR_INLINE void _eig_sort_pair(T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    using S = typename _eig_scalar<T>::type;
+    // swap is exactly 0 or 1
+    const T swap = T(S(0.5)) + T(S(0.5))*_eig_sign(w[i] - w[j]);
+    const T keep = T(S(1)) - swap;
+    const T wi = w[i], wj = w[j];
+    w[i] = keep*wi + swap*wj;
+    w[j] = keep*wj + swap*wi;
+    for (size_t k=0; k<N; ++k) {
+        const T vi = v[k*N+i], vj = v[k*N+j];
+        v[k*N+i] = keep*vi + swap*vj;
+        v[k*N+j] = keep*vj + swap*vi;
+    }
+}
+
+/* Copy the lower triangular part of A in to the full symmetric matrix a scaled
+    such that its largest entry is one, to avoid overflow/underflow in the
+    rotations. Returns the scaling factor
+*/
+template<size_t N, typename T>
+FASTOR_INLINE T _eig_load_scaled(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT a) {
+    using S = typename _eig_scalar<T>::type;
+    T scale(_eig_tiny<S>());
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<=i; ++j) {
+            scale = _eig_max(scale,_eig_abs(A[i*N+j]));
+        }
+    }
+    const T inv_scale = T(S(1)) / scale;
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<=i; ++j) {
+            a[i*N+j] = a[j*N+i] = A[i*N+j]*inv_scale;
+        }
+    }
+    return scale;
+}
+
+template<size_t N, typename T>
+FASTOR_INLINE void _eig_eye(T *FASTOR_RESTRICT v) {
+    using S = typename _eig_scalar<T>::type;
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            v[i*N+j] = i==j ? T(S(1)) : T(S(0));
+        }
+    }
+}
+
+} // internal
+
+
+/* Eigen decomposition A = V * diag(w) * V^T of a symmetric 2x2 or 3x3 matrix.
+    Only the lower triangular part of A is read. The eigenvalues w are sorted
+    in ascending order and the columns of V are the orthonormal eigenvectors
+*/
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2>, bool> = false>
+FASTOR_INLINE void _eigh(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT V) {
+    T a[4];
+    const T scale = internal::_eig_load_scaled<2>(A,a);
+    internal::_eig_eye<2>(V);
+
+    // A single rotation diagonalises a 2x2 matrix exactly
+    internal::_jacobi_rotate<0,1,2>(a,V);
+
+    w[0] = a[0]*scale;
+    w[1] = a[3]*scale;
+    internal::_eig_sort_pair<0,1,2>(w,V);
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _eigh(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT V) {
+    T a[9];
+    const T scale = internal::_eig_load_scaled<3>(A,a);
+    internal::_eig_eye<3>(V);
+
+    for (size_t sweep=0; sweep<internal::_jacobi_sweeps<T>(); ++sweep) {
+        internal::_jacobi_rotate<0,1,3>(a,V);
+        internal::_jacobi_rotate<0,2,3>(a,V);
+        internal::_jacobi_rotate<1,2,3>(a,V);
+    }
+
+    w[0] = a[0]*scale;
+    w[1] = a[4]*scale;
+    w[2] = a[8]*scale;
+
+    // Three compare-exchanges sort three values
+    internal::_eig_sort_pair<0,1,3>(w,V);
+    internal::_eig_sort_pair<1,2,3>(w,V);
+    internal::_eig_sort_pair<0,1,3>(w,V);
+}
+
+} // end of namespace Fastor
+
+#endif // EIGH_H
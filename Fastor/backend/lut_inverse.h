@@ -3,11 +3,19 @@
 
 #include "Fastor/config/config.h"
 #include "Fastor/meta/meta.h"
+#include "Fastor/backend/trsm.h"
 
 namespace Fastor {
 
+// Bigger matrices solve L * X = I
 template<typename T, size_t N, enable_if_t_<is_greater_v_<N,4>, bool> = false>
-FASTOR_INLINE void _lowunitri_inverse(const T *FASTOR_RESTRICT src, T *FASTOR_RESTRICT dst);
+FASTOR_INLINE void _lowunitri_inverse(const T *FASTOR_RESTRICT src, T *FASTOR_RESTRICT dst) {
+    std::fill(dst,dst+N*N,T(0));
+    for (size_t i=0; i<N; ++i) {
+        dst[i*N+i] = T(1);
+    }
+    internal::_trsm_dispatch<T,N,N,UpLoType::UniLower,false,true>(src,dst,dst);
+}
 
 template<typename T, size_t N, enable_if_t_<is_equal_v_<N,1>, bool> = false>
 FASTOR_INLINE void _lowunitri_inverse(const T *FASTOR_RESTRICT src, T *FASTOR_RESTRICT dst) {
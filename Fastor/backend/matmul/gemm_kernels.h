@@ -0,0 +1,29 @@
+#ifndef GEMM_KERNELS_H
+#define GEMM_KERNELS_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+
+namespace Fastor {
+
+namespace internal {
+
+/* Kernels generated offline for exact shapes [tools/gemm_codegen] specialise this
+    for every (T,M,K,N) they cover and are preferred by _matmul
+*/
+template<typename T, size_t M, size_t K, size_t N>
+struct gemm_kernel {
+    static constexpr bool value = false;
+    static FASTOR_INLINE void apply(const T * FASTOR_RESTRICT, const T * FASTOR_RESTRICT, T * FASTOR_RESTRICT) {}
+};
+
+} // internal
+
+} // end of namespace Fastor
+
+#ifdef FASTOR_GEMM_KERNELS_HEADER
+#include FASTOR_GEMM_KERNELS_HEADER
+#endif
+
+#endif // GEMM_KERNELS_H
@@ -3,6 +3,9 @@
 
 #include "Fastor/meta/meta.h"
 #include "Fastor/backend/matmul/matmul_kernels.h"
+#include "Fastor/backend/matmul/matmul_blocked.h"
+#include "Fastor/backend/matmul/gemm_kernels.h"
+#include "Fastor/backend/dispatch/dispatch.h"
 
 #ifdef FASTOR_USE_LIBXSMM
 #include "Fastor/backend/matmul/libxsmm_backend.h"
@@ -46,6 +49,28 @@ void _matmul(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTO
         return;
     }
 
+    // Kernels generated for this exact shape
+    FASTOR_IF_CONSTEXPR (internal::gemm_kernel<T,M,K,N>::value) {
+        internal::gemm_kernel<T,M,K,N>::apply(a,b,out);
+        return;
+    }
+
+#ifdef FASTOR_HAS_RUNTIME_DISPATCH
+    // Use the kernels of a wider instruction set if the CPU supports one
+    FASTOR_IF_CONSTEXPR (M*N*K > internal::meta_cube<FASTOR_BLAS_SWITCH_MATRIX_SIZE>::value) {
+        if (internal::dispatch_gemm<T>(M,K,N,T(1),a,b,T(0),out)) return;
+    }
+#endif
+
+#if !defined(FASTOR_USE_LIBXSMM) && !defined(FASTOR_USE_MKL)
+    // Large matrices that do not fit in cache
+    FASTOR_IF_CONSTEXPR ((is_same_v_<T,float> || is_same_v_<T,double>) && M>=16UL && K>=16UL && N>=16UL &&
+        M*N*K*sizeof(T) > internal::meta_cube<FASTOR_BLOCKED_GEMM_SWITCH_MATRIX_SIZE>::value*sizeof(double)) {
+        internal::_matmul_blocked<T,M,K,N>(a,b,out);
+        return;
+    }
+#endif
+
     // Matrix-vector specialisation
     FASTOR_IF_CONSTEXPR (N==1UL) {
         internal::_matvecmul<T,M,K>(a,b,out);
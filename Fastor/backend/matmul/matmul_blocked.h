@@ -0,0 +1,205 @@
+#ifndef MATMUL_BLOCKED_H
+#define MATMUL_BLOCKED_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/aligned_alloc.h"
+
+// Cache blocked matrix-matrix multiplication
+//
+// For matrices that do not fit in the L1/L2 caches _matmul_base streams
+// through the whole of b for every block of rows of c. This file implements
+// the Goto/BLIS algorithm instead:
+//
+//      K. Goto and R. van de Geijn, "Anatomy of high-performance matrix
+//      multiplication", ACM Transactions on Mathematical Software, 2008
+//
+// b is split in to KC x NC blocks that are packed in to contiguous panels of
+// NR columns [kept in the L3/L2 cache] and a in to MC x KC blocks that are
+// packed in to panels of MR rows [kept in the L2 cache]. An MR x NR register
+// tile of c is then computed by the micro-kernel streaming through one panel
+// of a and one panel of b [kept in the L1 cache]. Panels are zero padded so
+// the micro-kernel always works on full tiles and only the stores to c at the
+// edges of the matrix are partial
+
+namespace Fastor {
+
+namespace internal {
+
+/* Register and cache blocking parameters for a SIMDVector type V. The
+    micro-kernel keeps MR*NRV accumulators in registers so the sizes depend
+    on the number of SIMD registers of the architecture
+*/
+template<typename V>
+struct gemm_blocking {
+    using T = typename V::value_type;
+#if defined(FASTOR_AVX512F_IMPL) || defined(FASTOR_NEON_IMPL)
+    // 32 registers
+    static constexpr size_t MR  = 12;
+    static constexpr size_t NRV = 2;
+#else
+    // 16 registers
+    static constexpr size_t MR  = 6;
+    static constexpr size_t NRV = 2;
+#endif
+    static constexpr size_t NR  = NRV*V::Size;
+    // A KC x NR panel of b fits in L1
+    static constexpr size_t KC  = FASTOR_L1_CACHE_SIZE / (NR*sizeof(T)) / 8UL * 8UL;
+    // An MC x KC block of a fits in half of L2
+    static constexpr size_t MC  = FASTOR_L2_CACHE_SIZE / 2UL / (KC*sizeof(T)) / MR * MR;
+    // A KC x NC block of b fits in a share of L3
+    static constexpr size_t NC  = FASTOR_L3_CACHE_SIZE / (KC*sizeof(T)) / NR * NR;
+};
+
+
+/* Pack rows [0,mc) and columns [0,kc) of a (leading dimension lda) in to
+    panels of MR rows stored column by column and zero padded to a multiple of MR
+*/
+template<typename T, size_t MR>
+FASTOR_INLINE void _gemm_pack_a(const T * FASTOR_RESTRICT a, size_t lda, size_t mc, size_t kc, T * FASTOR_RESTRICT packed) {
+    for (size_t i=0; i<mc; i+=MR) {
+        const size_t mr = mc - i < MR ? mc - i : MR;
+        for (size_t p=0; p<kc; ++p) {
+            size_t ii=0;
+            for (; ii<mr; ++ii) {
+                packed[p*MR+ii] = a[(i+ii)*lda+p];
+            }
+            for (; ii<MR; ++ii) {
+                packed[p*MR+ii] = T(0);
+            }
+        }
+        packed += MR*kc;
+    }
+}
+
+/* Pack rows [0,kc) and columns [0,nc) of b (leading dimension ldb) in to
+    panels of NR columns stored row by row and zero padded to a multiple of NR
+*/
+template<typename T, size_t NR>
+FASTOR_INLINE void _gemm_pack_b(const T * FASTOR_RESTRICT b, size_t ldb, size_t kc, size_t nc, T * FASTOR_RESTRICT packed) {
+    for (size_t j=0; j<nc; j+=NR) {
+        const size_t nr = nc - j < NR ? nc - j : NR;
+        if (nr == NR) {
+            for (size_t p=0; p<kc; ++p) {
+                for (size_t jj=0; jj<NR; ++jj) {
+                    packed[p*NR+jj] = b[p*ldb+j+jj];
+                }
+            }
+        }
+        else {
+            for (size_t p=0; p<kc; ++p) {
+                size_t jj=0;
+                for (; jj<nr; ++jj) {
+                    packed[p*NR+jj] = b[p*ldb+j+jj];
+                }
+                for (; jj<NR; ++jj) {
+                    packed[p*NR+jj] = T(0);
+                }
+            }
+        }
+        packed += NR*kc;
+    }
+}
+
+
+/* c[0:mr,0:nr] (+)= a_panel * b_panel for packed MR x kc and kc x NR panels.
+    The product is accumulated in to c if accumulate is true and overwrites c
+    otherwise
+*/
+template<typename T, typename V, size_t MR, size_t NRV>
+FASTOR_INLINE void _gemm_micro_kernel(size_t kc, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b,
+    T * FASTOR_RESTRICT c, size_t ldc, size_t mr, size_t nr, bool accumulate) {
+
+    constexpr size_t NR = NRV*V::Size;
+
+    V acc[MR*NRV];
+    for (size_t p=0; p<kc; ++p) {
+        V bv[NRV];
+        for (size_t jv=0; jv<NRV; ++jv) {
+            bv[jv].load(&b[p*NR+jv*V::Size]);
+        }
+        for (size_t i=0; i<MR; ++i) {
+            const V av(a[p*MR+i]);
+            for (size_t jv=0; jv<NRV; ++jv) {
+                acc[i*NRV+jv] = fmadd(av,bv[jv],acc[i*NRV+jv]);
+            }
+        }
+    }
+
+    if (mr == MR && nr == NR) {
+        for (size_t i=0; i<MR; ++i) {
+            for (size_t jv=0; jv<NRV; ++jv) {
+                T *cij = &c[i*ldc+jv*V::Size];
+                if (accumulate) acc[i*NRV+jv] += V(cij,false);
+                acc[i*NRV+jv].store(cij,false);
+            }
+        }
+    }
+    else {
+        // Edge tile, go through a buffer
+        FASTOR_ARCH_ALIGN T tile[MR*NR];
+        for (size_t i=0; i<MR; ++i) {
+            for (size_t jv=0; jv<NRV; ++jv) {
+                acc[i*NRV+jv].store(&tile[i*NR+jv*V::Size]);
+            }
+        }
+        for (size_t i=0; i<mr; ++i) {
+            for (size_t j=0; j<nr; ++j) {
+                c[i*ldc+j] = accumulate ? c[i*ldc+j] + tile[i*NR+j] : tile[i*NR+j];
+            }
+        }
+    }
+}
+
+
+/* c = a * b for row-major a (MxK), b (KxN) and c (MxN) using cache blocking
+    and packing
+*/
+template<typename T, size_t M, size_t K, size_t N>
+FASTOR_NOINLINE void _matmul_blocked(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT c) {
+
+    using V       = SIMDVector<T,DEFAULT_ABI>;
+    using blocks  = gemm_blocking<V>;
+    constexpr size_t MR = blocks::MR;
+    constexpr size_t NRV = blocks::NRV;
+    constexpr size_t NR = blocks::NR;
+    // No need to block beyond the size of the problem
+    constexpr size_t KC = K < blocks::KC ? K : blocks::KC;
+    constexpr size_t MC = (M < blocks::MC ? M : blocks::MC) + MR - 1 - ((M < blocks::MC ? M : blocks::MC) + MR - 1) % MR;
+    constexpr size_t NC = (N < blocks::NC ? N : blocks::NC) + NR - 1 - ((N < blocks::NC ? N : blocks::NC) + NR - 1) % NR;
+
+    T *packed_a = aligned_allocate<T>(MC*KC);
+    T *packed_b = aligned_allocate<T>(KC*NC);
+
+    for (size_t jc=0; jc<N; jc+=NC) {
+        const size_t nc = N - jc < NC ? N - jc : NC;
+        for (size_t pc=0; pc<K; pc+=KC) {
+            const size_t kc = K - pc < KC ? K - pc : KC;
+            _gemm_pack_b<T,NR>(&b[pc*N+jc],N,kc,nc,packed_b);
+
+            for (size_t ic=0; ic<M; ic+=MC) {
+                const size_t mc = M - ic < MC ? M - ic : MC;
+                _gemm_pack_a<T,MR>(&a[ic*K+pc],K,mc,kc,packed_a);
+
+                for (size_t jr=0; jr<nc; jr+=NR) {
+                    const size_t nr = nc - jr < NR ? nc - jr : NR;
+                    for (size_t ir=0; ir<mc; ir+=MR) {
+                        const size_t mr = mc - ir < MR ? mc - ir : MR;
+                        _gemm_micro_kernel<T,V,MR,NRV>(kc,&packed_a[ir*kc],&packed_b[jr*kc],
+                            &c[(ic+ir)*N+jc+jr],N,mr,nr,pc!=0);
+                    }
+                }
+            }
+        }
+    }
+
+    aligned_free(packed_a);
+    aligned_free(packed_b);
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // MATMUL_BLOCKED_H
@@ -0,0 +1,114 @@
+#ifndef MATMUL_DYNAMIC_H
+#define MATMUL_DYNAMIC_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/dispatch/dispatch.h"
+
+namespace Fastor {
+
+namespace internal {
+
+// Matrix-matrix multiplication kernels for extents known only at runtime
+//-----------------------------------------------------------------------------------------------------------
+template<typename T, typename V>
+FASTOR_INLINE void _dynamic_gemm_store(const V &alpha, const V &acc, const V &beta, T* FASTOR_RESTRICT out, bool accumulate) {
+    if (accumulate) fmadd(alpha,acc,beta*V(out,false)).store(out,false);
+    else (alpha*acc).store(out,false);
+}
+
+/* out = alpha*a*b + beta*out for row-major a (MxK), b (KxN) and out (MxN)
+   Four rows of out are computed at a time using a 4 x V::Size register tile, the
+   column remainder is processed in scalar and the row remainder one row at a time.
+   When beta is zero out is never read so it can be uninitialised
+*/
+template<typename T>
+FASTOR_HINT_INLINE void _dynamic_gemm(const FASTOR_INDEX M, const FASTOR_INDEX K, const FASTOR_INDEX N,
+    const T alpha, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const T beta, T * FASTOR_RESTRICT out) {
+
+#ifdef FASTOR_HAS_RUNTIME_DISPATCH
+    if (dispatch_gemm<T>(M,K,N,alpha,a,b,beta,out)) return;
+#endif
+
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const bool accumulate = beta != T(0);
+    const V valpha(alpha), vbeta(beta);
+    const FASTOR_INDEX ROUNDM = ROUND_DOWN(M,4);
+    const FASTOR_INDEX ROUNDN = ROUND_DOWN(N,V::Size);
+
+    // matrix-vector
+    if (N==1) {
+        const FASTOR_INDEX ROUNDK = ROUND_DOWN(K,V::Size);
+        for (FASTOR_INDEX i=0; i<M; ++i) {
+            V acc;
+            FASTOR_INDEX k=0;
+            for (; k<ROUNDK; k+=V::Size) {
+                acc = fmadd(V(&a[i*K+k],false),V(&b[k],false),acc);
+            }
+            T sacc = acc.sum();
+            for (; k<K; ++k) {
+                sacc += a[i*K+k]*b[k];
+            }
+            out[i] = accumulate ? alpha*sacc + beta*out[i] : alpha*sacc;
+        }
+        return;
+    }
+
+    FASTOR_INDEX i=0;
+    for (; i<ROUNDM; i+=4) {
+        FASTOR_INDEX j=0;
+        for (; j<ROUNDN; j+=V::Size) {
+            V acc0, acc1, acc2, acc3;
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                const V brow(&b[k*N+j],false);
+                acc0 = fmadd(V(a[ i   *K+k]),brow,acc0);
+                acc1 = fmadd(V(a[(i+1)*K+k]),brow,acc1);
+                acc2 = fmadd(V(a[(i+2)*K+k]),brow,acc2);
+                acc3 = fmadd(V(a[(i+3)*K+k]),brow,acc3);
+            }
+            _dynamic_gemm_store(valpha,acc0,vbeta,&out[ i   *N+j],accumulate);
+            _dynamic_gemm_store(valpha,acc1,vbeta,&out[(i+1)*N+j],accumulate);
+            _dynamic_gemm_store(valpha,acc2,vbeta,&out[(i+2)*N+j],accumulate);
+            _dynamic_gemm_store(valpha,acc3,vbeta,&out[(i+3)*N+j],accumulate);
+        }
+        for (; j<N; ++j) {
+            for (FASTOR_INDEX ii=i; ii<i+4; ++ii) {
+                T acc = 0;
+                for (FASTOR_INDEX k=0; k<K; ++k) {
+                    acc += a[ii*K+k]*b[k*N+j];
+                }
+                out[ii*N+j] = accumulate ? alpha*acc + beta*out[ii*N+j] : alpha*acc;
+            }
+        }
+    }
+    for (; i<M; ++i) {
+        FASTOR_INDEX j=0;
+        for (; j<ROUNDN; j+=V::Size) {
+            V acc;
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                acc = fmadd(V(a[i*K+k]),V(&b[k*N+j],false),acc);
+            }
+            _dynamic_gemm_store(valpha,acc,vbeta,&out[i*N+j],accumulate);
+        }
+        for (; j<N; ++j) {
+            T acc = 0;
+            for (FASTOR_INDEX k=0; k<K; ++k) {
+                acc += a[i*K+k]*b[k*N+j];
+            }
+            out[i*N+j] = accumulate ? alpha*acc + beta*out[i*N+j] : alpha*acc;
+        }
+    }
+}
+
+template<typename T>
+FASTOR_INLINE void _dynamic_matmul(const FASTOR_INDEX M, const FASTOR_INDEX K, const FASTOR_INDEX N,
+    const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT out) {
+    _dynamic_gemm<T>(M,K,N,T(1),a,b,T(0),out);
+}
+//-----------------------------------------------------------------------------------------------------------
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // MATMUL_DYNAMIC_H
@@ -0,0 +1,229 @@
+#ifndef MATMUL_EPILOGUE_H
+#define MATMUL_EPILOGUE_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/aligned_alloc.h"
+#include "Fastor/backend/matmul/matmul.h"
+
+// Matrix-matrix multiplication with an epilogue
+//
+// c = epilogue(a * b) where the epilogue is an elementwise operation that is
+// applied to a register tile of the product before it is stored, such as
+// alpha * a * b + beta * c or f(alpha * a * b + d). An epilogue is a functor
+// that receives the accumulator and the flat (row-major) index of its first
+// element in to the M x N output and stores the final values itself
+//
+//      template<typename V> void operator()(const V &acc, FASTOR_INDEX i) const;
+//      void operator()(T acc, FASTOR_INDEX i) const;
+//
+// Products that go through the cache blocked kernel or a BLAS backend are
+// written to a buffer first and the epilogue is applied in a single pass over it
+
+namespace Fastor {
+
+namespace internal {
+
+// Epilogues for gemm
+//-----------------------------------------------------------------------------------------------------------
+/* c = alpha * a * b */
+template<typename T>
+struct gemm_epilogue_scale {
+    const T alpha;
+    T * FASTOR_RESTRICT c;
+    template<typename V>
+    FASTOR_INLINE void operator()(const V &acc, FASTOR_INDEX i) const {
+        (V(alpha)*acc).store(&c[i],false);
+    }
+    FASTOR_INLINE void operator()(T acc, FASTOR_INDEX i) const {
+        c[i] = alpha*acc;
+    }
+};
+/* c = alpha * a * b + beta * c */
+template<typename T>
+struct gemm_epilogue_axpby {
+    const T alpha;
+    const T beta;
+    T * FASTOR_RESTRICT c;
+    template<typename V>
+    FASTOR_INLINE void operator()(const V &acc, FASTOR_INDEX i) const {
+        fmadd(V(alpha),acc,V(beta)*V(&c[i],false)).store(&c[i],false);
+    }
+    FASTOR_INLINE void operator()(T acc, FASTOR_INDEX i) const {
+        c[i] = alpha*acc + beta*c[i];
+    }
+};
+/* c *= a * b */
+template<typename T>
+struct gemm_epilogue_mul {
+    T * FASTOR_RESTRICT c;
+    template<typename V>
+    FASTOR_INLINE void operator()(const V &acc, FASTOR_INDEX i) const {
+        (V(&c[i],false)*acc).store(&c[i],false);
+    }
+    FASTOR_INLINE void operator()(T acc, FASTOR_INDEX i) const {
+        c[i] *= acc;
+    }
+};
+/* c /= a * b */
+template<typename T>
+struct gemm_epilogue_div {
+    T * FASTOR_RESTRICT c;
+    template<typename V>
+    FASTOR_INLINE void operator()(const V &acc, FASTOR_INDEX i) const {
+        (V(&c[i],false)/acc).store(&c[i],false);
+    }
+    FASTOR_INLINE void operator()(T acc, FASTOR_INDEX i) const {
+        c[i] /= acc;
+    }
+};
+//-----------------------------------------------------------------------------------------------------------
+
+
+// Kernels
+//-----------------------------------------------------------------------------------------------------------
+/* Computes the MR x (NRV*V::Size) tile of a * b starting at row i and column j
+    and hands it over to the epilogue
+*/
+template<typename T, typename V, size_t M, size_t K, size_t N, size_t MR, size_t NRV, typename Epilogue>
+FASTOR_INLINE void _gemm_epilogue_block(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b,
+    const size_t i, const size_t j, const Epilogue &epilogue) {
+
+    V acc[MR*NRV];
+    for (size_t p=0; p<K; ++p) {
+        V bv[NRV];
+        for (size_t jv=0; jv<NRV; ++jv) {
+            bv[jv].load(&b[p*N+j+jv*V::Size],false);
+        }
+        for (size_t r=0; r<MR; ++r) {
+            const V av(a[(i+r)*K+p]);
+            for (size_t jv=0; jv<NRV; ++jv) {
+                acc[r*NRV+jv] = fmadd(av,bv[jv],acc[r*NRV+jv]);
+            }
+        }
+    }
+    for (size_t r=0; r<MR; ++r) {
+        for (size_t jv=0; jv<NRV; ++jv) {
+            epilogue(acc[r*NRV+jv],(i+r)*N+j+jv*V::Size);
+        }
+    }
+}
+
+/* Remaining columns of the MR rows starting at row i that do not fill a SIMD vector */
+template<typename T, size_t M, size_t K, size_t N, size_t MR, typename Epilogue>
+FASTOR_INLINE void _gemm_epilogue_block_scalar(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b,
+    const size_t i, const size_t j, const Epilogue &epilogue) {
+
+    T acc[MR] = {};
+    for (size_t p=0; p<K; ++p) {
+        for (size_t r=0; r<MR; ++r) {
+            acc[r] += a[(i+r)*K+p]*b[p*N+j];
+        }
+    }
+    for (size_t r=0; r<MR; ++r) {
+        epilogue(acc[r],(i+r)*N+j);
+    }
+}
+
+/* Applies the epilogue to an already computed product c of size n */
+template<typename T, typename V, typename Epilogue, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE void _gemm_epilogue_apply(const T * FASTOR_RESTRICT c, const size_t n, const Epilogue &epilogue) {
+    size_t i = 0;
+    for (; i<ROUND_DOWN(n,V::Size); i+=V::Size) {
+        epilogue(V(&c[i],false),i);
+    }
+    for (; i<n; ++i) {
+        epilogue(c[i],i);
+    }
+}
+template<typename T, typename V, typename Epilogue, enable_if_t_<!is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE void _gemm_epilogue_apply(const T * FASTOR_RESTRICT c, const size_t n, const Epilogue &epilogue) {
+    for (size_t i=0; i<n; ++i) {
+        epilogue(c[i],i);
+    }
+}
+
+/* a * b goes through a buffer on the stack if it is small and on the heap otherwise */
+template<typename T, typename V, size_t M, size_t K, size_t N, typename Epilogue,
+    enable_if_t_<M*N*sizeof(T) <= FASTOR_L1_CACHE_SIZE,bool> = false>
+FASTOR_INLINE void _gemm_epilogue_buffered(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const Epilogue &epilogue) {
+    FASTOR_ARCH_ALIGN T tmp[M*N];
+    _matmul<T,M,K,N>(a,b,tmp);
+    _gemm_epilogue_apply<T,V>(tmp,M*N,epilogue);
+}
+template<typename T, typename V, size_t M, size_t K, size_t N, typename Epilogue,
+    enable_if_t_<(M*N*sizeof(T) > FASTOR_L1_CACHE_SIZE),bool> = false>
+FASTOR_INLINE void _gemm_epilogue_buffered(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const Epilogue &epilogue) {
+    T *tmp = aligned_allocate<T>(M*N);
+    _matmul<T,M,K,N>(a,b,tmp);
+    _gemm_epilogue_apply<T,V>(tmp,M*N,epilogue);
+    aligned_free(tmp);
+}
+
+/* Products that are not computed by the register tiled kernel: non-primitive
+    types, matrices narrower than a SIMD vector and products that are handed
+    over to the blocked, dispatched or BLAS kernels
+*/
+template<typename T, typename V, size_t M, size_t K, size_t N>
+struct gemm_epilogue_is_buffered {
+    static constexpr bool value = !is_primitive_v_<T> || N < V::Size
+#if defined(FASTOR_USE_LIBXSMM) || defined(FASTOR_USE_MKL) || defined(FASTOR_HAS_RUNTIME_DISPATCH)
+        || M*N*K > meta_cube<FASTOR_BLAS_SWITCH_MATRIX_SIZE>::value
+#endif
+        || M*N*K*sizeof(T) > meta_cube<FASTOR_BLOCKED_GEMM_SWITCH_MATRIX_SIZE>::value*sizeof(double);
+};
+
+/* Register tiled a * b for row-major a (MxK) and b (KxN) that applies the
+    epilogue to each tile of the product while it is still in registers. V is
+    the SIMDVector type the epilogue works with
+*/
+template<typename T, typename V, size_t M, size_t K, size_t N, typename Epilogue,
+    enable_if_t_<!gemm_epilogue_is_buffered<T,V,M,K,N>::value,bool> = false>
+FASTOR_INLINE void _gemm_epilogue(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const Epilogue &epilogue) {
+
+    // 4 rows of 2 SIMD vectors keep 8 independent accumulators in flight
+    constexpr size_t MR  = 4UL;
+    constexpr size_t NRV = 2UL;
+    constexpr size_t M0  = M / MR * MR;
+    constexpr size_t N0  = N / (NRV*V::Size) * (NRV*V::Size);
+    constexpr size_t N1  = N / V::Size * V::Size;
+
+    size_t i = 0;
+    for (; i < M0; i += MR) {
+        size_t j = 0;
+        for (; j < N0; j += NRV*V::Size) {
+            _gemm_epilogue_block<T,V,M,K,N,MR,NRV>(a,b,i,j,epilogue);
+        }
+        for (; j < N1; j += V::Size) {
+            _gemm_epilogue_block<T,V,M,K,N,MR,1>(a,b,i,j,epilogue);
+        }
+        for (; j < N; ++j) {
+            _gemm_epilogue_block_scalar<T,M,K,N,MR>(a,b,i,j,epilogue);
+        }
+    }
+    for (; i < M; ++i) {
+        size_t j = 0;
+        for (; j < N0; j += NRV*V::Size) {
+            _gemm_epilogue_block<T,V,M,K,N,1,NRV>(a,b,i,j,epilogue);
+        }
+        for (; j < N1; j += V::Size) {
+            _gemm_epilogue_block<T,V,M,K,N,1,1>(a,b,i,j,epilogue);
+        }
+        for (; j < N; ++j) {
+            _gemm_epilogue_block_scalar<T,M,K,N,1>(a,b,i,j,epilogue);
+        }
+    }
+}
+template<typename T, typename V, size_t M, size_t K, size_t N, typename Epilogue,
+    enable_if_t_<gemm_epilogue_is_buffered<T,V,M,K,N>::value,bool> = false>
+FASTOR_INLINE void _gemm_epilogue(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const Epilogue &epilogue) {
+    _gemm_epilogue_buffered<T,V,M,K,N>(a,b,epilogue);
+}
+//-----------------------------------------------------------------------------------------------------------
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // MATMUL_EPILOGUE_H
@@ -0,0 +1,156 @@
+#ifndef MATMUL_MIXED_H
+#define MATMUL_MIXED_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+
+namespace Fastor {
+
+namespace internal {
+
+// Accumulators in double for N columns of float storage, the widest vector that is filled
+template<size_t N>
+struct mixed_precision_abi {
+#if defined(FASTOR_DONT_VECTORISE)
+    using type = simd_abi::scalar;
+#elif defined(FASTOR_AVX512_IMPL)
+    using type = conditional_t_<N >= 8UL, simd_abi::avx512,
+                    conditional_t_<N >= 4UL, simd_abi::avx,
+                        conditional_t_<N >= 2UL, simd_abi::sse, simd_abi::scalar>>>;
+#elif defined(FASTOR_AVX_IMPL)
+    using type = conditional_t_<N >= 4UL, simd_abi::avx,
+                    conditional_t_<N >= 2UL, simd_abi::sse, simd_abi::scalar>>;
+#elif defined(FASTOR_SSE2_IMPL)
+    using type = conditional_t_<N >= 2UL, simd_abi::sse, simd_abi::scalar>;
+#elif defined(FASTOR_NEON_IMPL)
+    using type = conditional_t_<N >= 2UL, simd_abi::neon, simd_abi::scalar>;
+#else
+    using type = simd_abi::scalar;
+#endif
+};
+
+
+// Loads V::Size floats widened to double and stores V::Size doubles rounded to float
+template<typename ABI>
+FASTOR_INLINE void _widen_load(const float * FASTOR_RESTRICT a, SIMDVector<double,ABI> &out) {
+    double tmp[SIMDVector<double,ABI>::Size];
+    for (size_t i=0; i<SIMDVector<double,ABI>::Size; ++i) tmp[i] = static_cast<double>(a[i]);
+    out.load(tmp,false);
+}
+template<typename ABI>
+FASTOR_INLINE void _narrow_store(float * FASTOR_RESTRICT a, const SIMDVector<double,ABI> &v) {
+    double tmp[SIMDVector<double,ABI>::Size];
+    v.store(tmp,false);
+    for (size_t i=0; i<SIMDVector<double,ABI>::Size; ++i) a[i] = static_cast<float>(tmp[i]);
+}
+
+#ifdef FASTOR_AVX512_IMPL
+FASTOR_INLINE void _widen_load(const float * FASTOR_RESTRICT a, SIMDVector<double,simd_abi::avx512> &out) {
+    out.value = _mm512_cvtps_pd(_mm256_loadu_ps(a));
+}
+FASTOR_INLINE void _narrow_store(float * FASTOR_RESTRICT a, const SIMDVector<double,simd_abi::avx512> &v) {
+    _mm256_storeu_ps(a,_mm512_cvtpd_ps(v.value));
+}
+#endif
+#ifdef FASTOR_AVX_IMPL
+FASTOR_INLINE void _widen_load(const float * FASTOR_RESTRICT a, SIMDVector<double,simd_abi::avx> &out) {
+    out.value = _mm256_cvtps_pd(_mm_loadu_ps(a));
+}
+FASTOR_INLINE void _narrow_store(float * FASTOR_RESTRICT a, const SIMDVector<double,simd_abi::avx> &v) {
+    _mm_storeu_ps(a,_mm256_cvtpd_ps(v.value));
+}
+#endif
+#ifdef FASTOR_SSE2_IMPL
+FASTOR_INLINE void _widen_load(const float * FASTOR_RESTRICT a, SIMDVector<double,simd_abi::sse> &out) {
+    out.value = _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(a))));
+}
+FASTOR_INLINE void _narrow_store(float * FASTOR_RESTRICT a, const SIMDVector<double,simd_abi::sse> &v) {
+    _mm_store_sd(reinterpret_cast<double*>(a),_mm_castps_pd(_mm_cvtpd_ps(v.value)));
+}
+#endif
+
+
+/* RB rows of C for the V::Size columns starting at column j. The rows of A are already
+    widened to double [a_rows, RB x K] so that they can be broadcast straight from memory
+*/
+template<typename V, size_t RB, size_t K, size_t N>
+FASTOR_INLINE void _matmul_mixed_block(const double * FASTOR_RESTRICT a_rows, const float * FASTOR_RESTRICT b, float * FASTOR_RESTRICT out, size_t i, size_t j) {
+    V acc[RB];
+    for (size_t k=0; k<K; ++k) {
+        V bk;
+        _widen_load(&b[k*N+j],bk);
+        for (size_t r=0; r<RB; ++r) {
+            acc[r] = fmadd(V(a_rows[r*K+k]),bk,acc[r]);
+        }
+    }
+    for (size_t r=0; r<RB; ++r) {
+        _narrow_store(&out[(i+r)*N+j],acc[r]);
+    }
+}
+
+// Columns J0 to N of RB rows of C, the remaining columns are covered with ever narrower vectors
+template<size_t J0, size_t RB, size_t K, size_t N, enable_if_t_<J0==N,bool> = false>
+FASTOR_INLINE void _matmul_mixed_columns(const double * FASTOR_RESTRICT, const float * FASTOR_RESTRICT, float * FASTOR_RESTRICT, size_t) {}
+
+template<size_t J0, size_t RB, size_t K, size_t N, enable_if_t_<(J0<N),bool> = false>
+FASTOR_INLINE void _matmul_mixed_columns(const double * FASTOR_RESTRICT a_rows, const float * FASTOR_RESTRICT b, float * FASTOR_RESTRICT out, size_t i) {
+    using V = SIMDVector<double,typename mixed_precision_abi<N-J0>::type>;
+    constexpr size_t J1 = J0 + ROUND_DOWN(N-J0,V::Size);
+    for (size_t j=J0; j<J1; j+=V::Size) {
+        _matmul_mixed_block<V,RB,K,N>(a_rows,b,out,i,j);
+    }
+    _matmul_mixed_columns<J1,RB,K,N>(a_rows,b,out,i);
+}
+
+template<size_t RB, size_t K, size_t N>
+FASTOR_INLINE void _matmul_mixed_rows(const float * FASTOR_RESTRICT a, const float * FASTOR_RESTRICT b, float * FASTOR_RESTRICT out, size_t i) {
+    double a_rows[RB*K];
+    for (size_t n=0; n<RB*K; ++n) a_rows[n] = static_cast<double>(a[i*K+n]);
+    _matmul_mixed_columns<0,RB,K,N>(a_rows,b,out,i);
+}
+
+} // internal
+
+
+/* Matrix-matrix multiplication of operands stored in T with the sums accumulated in the wider
+    type Acc and rounded to T once at the end
+*/
+template<typename T, typename Acc, size_t M, size_t K, size_t N,
+    enable_if_t_<!(is_same_v_<T,float> && is_same_v_<Acc,double>),bool> = false>
+FASTOR_INLINE void _matmul_mixed(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT out) {
+    Acc row[N];
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<N; ++j) row[j] = Acc(0);
+        for (size_t k=0; k<K; ++k) {
+            const Acc aik = static_cast<Acc>(a[i*K+k]);
+            for (size_t j=0; j<N; ++j) {
+                row[j] += aik*static_cast<Acc>(b[k*N+j]);
+            }
+        }
+        for (size_t j=0; j<N; ++j) out[i*N+j] = static_cast<T>(row[j]);
+    }
+}
+
+template<typename T, typename Acc, size_t M, size_t K, size_t N,
+    enable_if_t_<is_same_v_<T,float> && is_same_v_<Acc,double>,bool> = false>
+FASTOR_INLINE void _matmul_mixed(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT out) {
+    // eight rows keep enough independent accumulators in flight to hide the latency of fmadd
+    constexpr size_t RB = 8UL;
+    constexpr size_t MROUND = ROUND_DOWN(M,RB);
+    size_t i=0;
+    for (; i<MROUND; i+=RB) {
+        internal::_matmul_mixed_rows<RB,K,N>(a,b,out,i);
+    }
+    FASTOR_IF_CONSTEXPR(M % RB >= RB/2) {
+        internal::_matmul_mixed_rows<RB/2,K,N>(a,b,out,i);
+        i += RB/2;
+    }
+    for (; i<M; ++i) {
+        internal::_matmul_mixed_rows<1,K,N>(a,b,out,i);
+    }
+}
+
+} // end of namespace Fastor
+
+#endif // MATMUL_MIXED_H
@@ -0,0 +1,265 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(FASTOR_USE_OPENMP)
+#include <omp.h>
+#elif defined(FASTOR_USE_THREADS)
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#endif
+
+// Multithreaded evaluation of large expressions
+//
+// The flat index range [0,size) of an expression is split in to chunks of
+// FASTOR_PARALLEL_CHUNK_BYTES worth of entries, rounded down to a multiple
+// of the SIMD width so that every chunk starts on an aligned boundary.
+// Chunks are then distributed among threads either using OpenMP
+// (FASTOR_USE_OPENMP) or Fastor's own std::thread pool (FASTOR_USE_THREADS).
+// As chunking does not depend on the number of threads the result of a
+// reduction is the same irrespective of how many threads are used.
+// Expressions smaller than FASTOR_PARALLEL_THRESHOLD entries are always
+// evaluated serially on the calling thread
+
+namespace Fastor {
+
+namespace internal {
+
+#if defined(FASTOR_USE_THREADS)
+/* A persistent pool of worker threads. The calling thread takes part in
+   the work, so a pool of n threads spawns n-1 workers
+*/
+class thread_pool {
+public:
+    static thread_pool& instance() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    int num_threads() const {return _nthreads;}
+
+    void set_num_threads(int n) {
+        n = n < 1 ? 1 : n;
+        if (n == _nthreads) return;
+        std::lock_guard<std::mutex> run_lock(_run_mutex);
+        stop();
+        start(n);
+    }
+
+    /* Calls f(c) for every chunk c in [0,nchunks) */
+    void run(FASTOR_INDEX nchunks, const std::function<void(FASTOR_INDEX)> &f) {
+        // nested parallel regions and single threaded pools run serially
+        if (_nthreads == 1 || nchunks == 1 || _in_parallel_region()) {
+            for (FASTOR_INDEX c=0; c<nchunks; ++c) f(c);
+            return;
+        }
+        std::lock_guard<std::mutex> run_lock(_run_mutex);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _job = &f;
+            _nchunks = nchunks;
+            _next = 0;
+            _busy = _workers.size();
+            ++_generation;
+        }
+        _cv.notify_all();
+        work();
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done_cv.wait(lock, [this]{return _busy == 0;});
+        _job = nullptr;
+    }
+
+    ~thread_pool() {stop();}
+
+private:
+    thread_pool() {
+        const unsigned hw = std::thread::hardware_concurrency();
+        start(hw == 0 ? 1 : int(hw));
+    }
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    static bool& _in_parallel_region() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    void work() {
+        _in_parallel_region() = true;
+        FASTOR_INDEX c;
+        while ((c = _next.fetch_add(1)) < _nchunks) {
+            (*_job)(c);
+        }
+        _in_parallel_region() = false;
+    }
+
+    void worker_loop() {
+        size_t generation = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [&]{return _stop || _generation != generation;});
+                if (_stop) return;
+                generation = _generation;
+            }
+            work();
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_busy == 0) _done_cv.notify_one();
+        }
+    }
+
+    void start(int n) {
+        _stop = false;
+        _nthreads = n;
+        for (int i=1; i<n; ++i) {
+            _workers.emplace_back(&thread_pool::worker_loop, this);
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        for (auto &worker : _workers) worker.join();
+        _workers.clear();
+    }
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex, _run_mutex;
+    std::condition_variable _cv, _done_cv;
+    const std::function<void(FASTOR_INDEX)> *_job = nullptr;
+    std::atomic<FASTOR_INDEX> _next{0};
+    FASTOR_INDEX _nchunks = 0;
+    size_t _busy = 0;
+    size_t _generation = 0;
+    int _nthreads = 1;
+    bool _stop = false;
+};
+#endif
+
+#if defined(FASTOR_USE_OPENMP)
+FASTOR_INLINE int& _parallel_num_threads() {
+    static int nthreads = omp_get_max_threads();
+    return nthreads;
+}
+#endif
+
+} // internal
+
+
+/* Number of threads used to evaluate large expressions */
+FASTOR_INLINE int get_num_threads() {
+#if defined(FASTOR_USE_OPENMP)
+    return internal::_parallel_num_threads();
+#elif defined(FASTOR_USE_THREADS)
+    return internal::thread_pool::instance().num_threads();
+#else
+    return 1;
+#endif
+}
+
+/* Set the number of threads used to evaluate large expressions.
+   Has no effect unless a parallel backend is enabled
+*/
+FASTOR_INLINE void set_num_threads(int n) {
+#if defined(FASTOR_USE_OPENMP)
+    internal::_parallel_num_threads() = n < 1 ? 1 : n;
+#elif defined(FASTOR_USE_THREADS)
+    internal::thread_pool::instance().set_num_threads(n);
+#else
+    unused(n);
+#endif
+}
+
+
+namespace internal {
+
+/* Number of entries of type T in a chunk */
+template<typename T, typename V>
+constexpr FASTOR_INLINE FASTOR_INDEX parallel_chunk_size() {
+    return FASTOR_PARALLEL_CHUNK_BYTES / sizeof(T) < V::Size ? V::Size :
+        ROUND_DOWN(FASTOR_PARALLEL_CHUNK_BYTES / sizeof(T), V::Size);
+}
+
+template<typename T, typename V>
+FASTOR_INLINE bool _should_parallelise(FASTOR_INDEX size) {
+#if defined(FASTOR_PARALLEL)
+    return size >= FASTOR_PARALLEL_THRESHOLD && size > parallel_chunk_size<T,V>() && get_num_threads() > 1;
+#else
+    unused(size);
+    return false;
+#endif
+}
+
+#if defined(FASTOR_PARALLEL)
+template<typename F>
+FASTOR_HINT_INLINE void _parallel_run(FASTOR_INDEX nchunks, const F &f) {
+#if defined(FASTOR_USE_OPENMP)
+    const long long n = (long long)nchunks;
+    #pragma omp parallel for schedule(static) num_threads(get_num_threads())
+    for (long long c=0; c<n; ++c) {
+        f(FASTOR_INDEX(c));
+    }
+#else
+    const std::function<void(FASTOR_INDEX)> job(std::cref(f));
+    thread_pool::instance().run(nchunks, job);
+#endif
+}
+#endif
+
+/* Calls f(first,last) over SIMD aligned sub-ranges of [0,size) that
+   together cover the whole range
+*/
+template<typename T, typename V, typename F>
+FASTOR_INLINE void parallel_for(FASTOR_INDEX size, const F &f) {
+#if defined(FASTOR_PARALLEL)
+    if (_should_parallelise<T,V>(size)) {
+        constexpr FASTOR_INDEX chunk = parallel_chunk_size<T,V>();
+        _parallel_run((size + chunk - 1) / chunk, [&](FASTOR_INDEX c) {
+            f(c*chunk, std::min(size, (c+1)*chunk));
+        });
+        return;
+    }
+#endif
+    f(FASTOR_INDEX(0), size);
+}
+
+/* Reduces [0,size) by calling f(first,last) over SIMD aligned sub-ranges
+   and folding the partial results in order using combine
+*/
+template<typename T, typename V, typename F, typename Combine>
+FASTOR_INLINE T parallel_reduce(FASTOR_INDEX size, const F &f, const Combine &combine) {
+#if defined(FASTOR_PARALLEL)
+    if (_should_parallelise<T,V>(size)) {
+        constexpr FASTOR_INDEX chunk = parallel_chunk_size<T,V>();
+        const FASTOR_INDEX nchunks = (size + chunk - 1) / chunk;
+        std::vector<T> partial(nchunks);
+        _parallel_run(nchunks, [&](FASTOR_INDEX c) {
+            partial[c] = f(c*chunk, std::min(size, (c+1)*chunk));
+        });
+        T out = partial[0];
+        for (FASTOR_INDEX c=1; c<nchunks; ++c) {
+            out = combine(out, partial[c]);
+        }
+        return out;
+    }
+#endif
+    unused(combine);
+    return f(FASTOR_INDEX(0), size);
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // PARALLEL_H
@@ -0,0 +1,159 @@
+#ifndef SVD_H
+#define SVD_H
+
+#include "Fastor/backend/eigh.h"
+
+// Singular value and polar decomposition of small matrices
+//
+// V is obtained from the eigen decomposition of A^T * A and U from a Givens
+// QR factorisation of A * V as in
+//
+//      A. McAdams et. al. "Computing the singular value decomposition of 3x3
+//                          matrices with minimal branching and elementary
+//                          floating point operations"
+//
+// which, unlike normalising the columns of A * V, gives an orthogonal U even
+// for (nearly) singular matrices. As in eigh.h the kernels do not branch on
+// values so that they can be evaluated with a SIMDVector as the scalar type
+
+namespace Fastor {
+
+namespace internal {
+
+/* Givens rotation acting on rows i and j of b annihilating b(j,i).
+    The rotation is accumulated in to the columns of u
+*/
+template<size_t i, size_t j, size_t N, typename T>
+FASTOR_INLINE void _givens_qr_step(T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT u) {
+    using S = typename _eig_scalar<T>::type;
+
+    const T x = b[i*N+i];
+    const T y = b[j*N+i];
+    // c = 1 and s = 0 when x = y = 0. The perturbation must not underflow when squared
+    const T ax  = _eig_abs(x) + T(sqrts(_eig_tiny<S>()));
+    const T inv_r = T(S(1)) / _eig_sqrt(ax*ax + y*y);
+    const T c   = ax*inv_r;
+    const T s   = _eig_sign(x)*y*inv_r;
+
+    for (size_t k=0; k<N; ++k) {
+        const T bik = b[i*N+k];
+        const T bjk = b[j*N+k];
+        b[i*N+k] =  c*bik + s*bjk;
+        b[j*N+k] = -s*bik + c*bjk;
+    }
+    for (size_t k=0; k<N; ++k) {
+        const T uki = u[k*N+i];
+        const T ukj = u[k*N+j];
+        u[k*N+i] = c*uki + s*ukj;
+        u[k*N+j] = -s*uki + c*ukj;
+    }
+}
+
+template<size_t N, typename T, enable_if_t_<is_equal_v_<N,2>, bool> = false>
+FASTOR_INLINE void _givens_qr(T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT u) {
+    _givens_qr_step<0,1,2>(b,u);
+}
+template<size_t N, typename T, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _givens_qr(T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT u) {
+    _givens_qr_step<0,1,3>(b,u);
+    _givens_qr_step<0,2,3>(b,u);
+    _givens_qr_step<1,2,3>(b,u);
+}
+
+} // internal
+
+
+/* Singular value decomposition A = U * diag(s) * V^T of a 2x2 or 3x3 matrix.
+    The singular values s are non-negative and sorted in descending order
+    and U, V are orthogonal
+*/
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2> || is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _svd(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT U, T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT V) {
+    using S = typename internal::_eig_scalar<T>::type;
+
+    // Scale to avoid overflow/underflow when forming A^T * A
+    T scale(internal::_eig_tiny<S>());
+    for (size_t i=0; i<N*N; ++i) {
+        scale = internal::_eig_max(scale,internal::_eig_abs(A[i]));
+    }
+    const T inv_scale = T(S(1)) / scale;
+    T a[N*N];
+    for (size_t i=0; i<N*N; ++i) {
+        a[i] = A[i]*inv_scale;
+    }
+
+    // Eigen decomposition of A^T * A
+    T ata[N*N];
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<=i; ++j) {
+            T acc(S(0));
+            for (size_t k=0; k<N; ++k) {
+                acc += a[k*N+i]*a[k*N+j];
+            }
+            ata[i*N+j] = acc;
+        }
+    }
+    T w[N], Vasc[N*N];
+    _eigh<T,N>(ata,w,Vasc);
+
+    // Reverse to descending order
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            V[i*N+j] = Vasc[i*N+N-1-j];
+        }
+    }
+
+    // B = A * V
+    T b[N*N];
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            T acc(S(0));
+            for (size_t k=0; k<N; ++k) {
+                acc += a[i*N+k]*V[k*N+j];
+            }
+            b[i*N+j] = acc;
+        }
+    }
+
+    // B = U * R where R is diagonal up to round-off since the columns of B are orthogonal
+    internal::_eig_eye<N>(U);
+    internal::_givens_qr<N>(b,U);
+
+    for (size_t i=0; i<N; ++i) {
+        const T sign = internal::_eig_sign(b[i*N+i]);
+        s[i] = internal::_eig_abs(b[i*N+i])*scale;
+        for (size_t k=0; k<N; ++k) {
+            U[k*N+i] *= sign;
+        }
+    }
+}
+
+
+/* Right polar decomposition F = R * U of a 2x2 or 3x3 matrix where R is
+    orthogonal [a rotation when det(F) > 0] and U is symmetric positive
+    semi-definite
+*/
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2> || is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _polar(const T *FASTOR_RESTRICT F, T *FASTOR_RESTRICT R, T *FASTOR_RESTRICT U) {
+    using S = typename internal::_eig_scalar<T>::type;
+
+    T W[N*N], s[N], V[N*N];
+    _svd<T,N>(F,W,s,V);
+
+    // R = W * V^T and U = V * diag(s) * V^T
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            T r(S(0)), u(S(0));
+            for (size_t k=0; k<N; ++k) {
+                r += W[i*N+k]*V[j*N+k];
+                u += V[i*N+k]*s[k]*V[j*N+k];
+            }
+            R[i*N+j] = r;
+            U[i*N+j] = u;
+        }
+    }
+}
+
+} // end of namespace Fastor
+
+#endif // SVD_H
@@ -171,6 +171,26 @@ FASTOR_INLINE void _transpose<float,4,4>(const float * FASTOR_RESTRICT a, float
 }
 #endif
 
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE void _transpose<float,2,2>(const float * FASTOR_RESTRICT a, float * FASTOR_RESTRICT out) {
+    // de-interleaving load gives the columns
+    float32x2x2_t cols = vld2_f32(a);
+    vst1_f32(out  , cols.val[0]);
+    vst1_f32(out+2, cols.val[1]);
+}
+
+template<>
+FASTOR_INLINE void _transpose<float,4,4>(const float * FASTOR_RESTRICT a, float * FASTOR_RESTRICT out) {
+    // de-interleaving load gives the columns
+    float32x4x4_t cols = vld4q_f32(a);
+    vst1q_f32(out   , cols.val[0]);
+    vst1q_f32(out+4 , cols.val[1]);
+    vst1q_f32(out+8 , cols.val[2]);
+    vst1q_f32(out+12, cols.val[3]);
+}
+#endif
+
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE void _transpose<float,8,8>(const float * FASTOR_RESTRICT a, float * FASTOR_RESTRICT out) {
@@ -235,6 +255,16 @@ FASTOR_INLINE void _transpose<double,2,2>(const double* FASTOR_RESTRICT a, doubl
 }
 #endif
 
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE void _transpose<double,2,2>(const double* FASTOR_RESTRICT a, double* FASTOR_RESTRICT out) {
+    // de-interleaving load gives the columns
+    float64x2x2_t cols = vld2q_f64(a);
+    vst1q_f64(out  , cols.val[0]);
+    vst1q_f64(out+2, cols.val[1]);
+}
+#endif
+
 #ifdef FASTOR_SSE2_IMPL
 template<>
 FASTOR_INLINE void _transpose<double,3,3>(const double* FASTOR_RESTRICT a, double* FASTOR_RESTRICT out) {
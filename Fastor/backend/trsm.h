@@ -0,0 +1,210 @@
+#ifndef TRSM_H
+#define TRSM_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/meta/meta.h"
+#include "Fastor/meta/tensor_meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+
+namespace Fastor {
+
+namespace internal {
+
+template<typename UpLo, bool Transpose>
+struct trsm_traits {
+    static constexpr bool is_unit  = is_same_v_<UpLo,UpLoType::UniLower> || is_same_v_<UpLo,UpLoType::UniUpper>;
+    static constexpr bool is_lower = is_same_v_<UpLo,UpLoType::Lower>    || is_same_v_<UpLo,UpLoType::UniLower>;
+    static constexpr bool is_upper = is_same_v_<UpLo,UpLoType::Upper>    || is_same_v_<UpLo,UpLoType::UniUpper>;
+    // op(A) is lower triangular and rows are solved from the top
+    static constexpr bool is_forward = is_lower != Transpose;
+};
+
+// Row of X that is solved at step s
+template<size_t M, bool IsForward>
+constexpr FASTOR_INLINE size_t trsm_row(size_t s) {
+    return IsForward ? s : M - 1 - s;
+}
+
+// op(A)(i,k)
+template<size_t M, bool Transpose, typename T>
+FASTOR_INLINE T trsm_op(const T* FASTOR_RESTRICT a, size_t i, size_t k) {
+    return Transpose ? a[k*M+i] : a[i*M+k];
+}
+
+
+// Multiple right hand sides
+//-----------------------------------------------------------------------------------------------------------//
+/* Solves the RB rows of X in the block of rows starting at step s0 for the V::Size columns starting
+    at column j. Every row of X that is already solved is loaded once and eliminated from all the rows
+    of the block that are kept in registers, the small triangle of the block is then solved in place
+*/
+template<typename T, size_t M, size_t N, typename UpLo, bool Transpose, size_t RB, typename V>
+FASTOR_INLINE void _trsm_block(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT inv_diag, const T* b, T* x, size_t first, size_t s0, size_t j) {
+    using traits = trsm_traits<UpLo,Transpose>;
+    constexpr bool is_forward = traits::is_forward;
+
+    size_t rows[RB];
+    V acc[RB];
+    for (size_t r=0; r<RB; ++r) {
+        rows[r] = trsm_row<M,is_forward>(s0+r);
+        acc[r].load(&b[rows[r]*N+j],false);
+    }
+
+    for (size_t s=first; s<s0; ++s) {
+        const size_t k = trsm_row<M,is_forward>(s);
+        const V xk(&x[k*N+j],false);
+        for (size_t r=0; r<RB; ++r) {
+            acc[r] = fnmadd(V(trsm_op<M,Transpose>(a,rows[r],k)),xk,acc[r]);
+        }
+    }
+
+    for (size_t r=0; r<RB; ++r) {
+        for (size_t q=0; q<r; ++q) {
+            acc[r] = fnmadd(V(trsm_op<M,Transpose>(a,rows[r],rows[q])),acc[q],acc[r]);
+        }
+        FASTOR_IF_CONSTEXPR(!traits::is_unit) {
+            acc[r] *= V(inv_diag[rows[r]]);
+        }
+        acc[r].store(&x[rows[r]*N+j],false);
+    }
+}
+
+/* Rows of the panel solved before step first are known to be zero in B and hence in X
+    and are neither solved nor eliminated
+*/
+template<typename T, size_t M, size_t N, typename UpLo, bool Transpose, typename V>
+FASTOR_INLINE void _trsm_panel(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT inv_diag, const T* b, T* x, size_t first, size_t j) {
+    constexpr size_t RB = 4UL;
+    constexpr size_t ROUND_ = ROUND_DOWN(M,RB);
+    size_t s0 = first / RB * RB;
+    for (; s0<ROUND_; s0+=RB) {
+        _trsm_block<T,M,N,UpLo,Transpose,RB,V>(a,inv_diag,b,x,first,s0,j);
+    }
+    FASTOR_IF_CONSTEXPR(M % RB != 0) {
+        _trsm_block<T,M,N,UpLo,Transpose,(M % RB == 0 ? 1 : M % RB),V>(a,inv_diag,b,x,first,s0,j);
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+
+
+// Single right hand side
+//-----------------------------------------------------------------------------------------------------------//
+template<typename T>
+FASTOR_INLINE T _trsm_dot(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT y, size_t n) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    V vsum;
+    size_t k = 0;
+    for (; k+V::Size<=n; k+=V::Size) {
+        vsum = fmadd(V(&a[k],false),V(&y[k],false),vsum);
+    }
+    T sum = vsum.sum();
+    for (; k<n; ++k) {
+        sum += a[k]*y[k];
+    }
+    return sum;
+}
+
+template<typename T>
+FASTOR_INLINE void _trsm_axpy(const T* FASTOR_RESTRICT a, const T alpha, T* FASTOR_RESTRICT y, size_t n) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const V valpha(alpha);
+    size_t k = 0;
+    for (; k+V::Size<=n; k+=V::Size) {
+        const V vy = fnmadd(valpha,V(&a[k],false),V(&y[k],false));
+        vy.store(&y[k],false);
+    }
+    for (; k<n; ++k) {
+        y[k] -= alpha*a[k];
+    }
+}
+
+/* y holds one right hand side on entry and the solution on exit. As A is row-major the rows of
+    op(A) are contiguous when it is not transposed and the solve is done with inner products,
+    otherwise its columns are and every solved entry is eliminated from the remaining ones
+*/
+template<typename T, size_t M, typename UpLo, bool Transpose, enable_if_t_<!Transpose,bool> = false>
+FASTOR_INLINE void _trsm_vector(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT inv_diag, T* FASTOR_RESTRICT y) {
+    using traits = trsm_traits<UpLo,Transpose>;
+    for (size_t s=0; s<M; ++s) {
+        const size_t i = trsm_row<M,traits::is_forward>(s);
+        const size_t lo = traits::is_forward ? 0 : i+1;
+        const size_t hi = traits::is_forward ? i : M;
+        const T value = y[i] - _trsm_dot(&a[i*M+lo],&y[lo],hi-lo);
+        y[i] = traits::is_unit ? value : value*inv_diag[i];
+    }
+}
+
+template<typename T, size_t M, typename UpLo, bool Transpose, enable_if_t_<Transpose,bool> = false>
+FASTOR_INLINE void _trsm_vector(const T* FASTOR_RESTRICT a, const T* FASTOR_RESTRICT inv_diag, T* FASTOR_RESTRICT y) {
+    using traits = trsm_traits<UpLo,Transpose>;
+    for (size_t s=0; s<M; ++s) {
+        const size_t k = trsm_row<M,traits::is_forward>(s);
+        FASTOR_IF_CONSTEXPR(!traits::is_unit) {
+            y[k] *= inv_diag[k];
+        }
+        const size_t lo = traits::is_forward ? k+1 : 0;
+        const size_t hi = traits::is_forward ? M : k;
+        _trsm_axpy(&a[k*M+lo],y[k],&y[lo],hi-lo);
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+
+
+/* Solves op(A) * X = B, see _trsm. If IsTriangularB is set B is square and lower triangular when op(A)
+    is and upper triangular otherwise, as for the inverse of A with B = I. The zeros of B carry over to X
+    and are skipped, in which case X has to alias B
+*/
+template<typename T, size_t M, size_t N, typename UpLo, bool Transpose, bool IsTriangularB>
+FASTOR_INLINE void _trsm_dispatch(const T* FASTOR_RESTRICT a, const T* b, T* x) {
+
+    using traits = trsm_traits<UpLo,Transpose>;
+    static_assert(traits::is_lower || traits::is_upper, "TRSM REQUIRES A LOWER OR UPPER TRIANGULAR MATRIX");
+
+    T inv_diag[M];
+    FASTOR_IF_CONSTEXPR(!traits::is_unit) {
+        for (size_t i=0; i<M; ++i) inv_diag[i] = T(1) / a[i*M+i];
+    }
+
+    // the first non-zero of column j of B is solved at step j
+    constexpr size_t skip = IsTriangularB && M==N ? 1UL : 0UL;
+
+    using V = choose_best_simd_t<SIMDVector<T,DEFAULT_ABI>,N>;
+    FASTOR_IF_CONSTEXPR(N >= V::Size && V::Size != 1UL) {
+        constexpr size_t ROUND_ = ROUND_DOWN(N,V::Size);
+        size_t j = 0;
+        for (; j<ROUND_; j+=V::Size) {
+            const size_t first = skip*(traits::is_forward ? j : M - j - V::Size);
+            _trsm_panel<T,M,N,UpLo,Transpose,V>(a,inv_diag,b,x,first,j);
+        }
+        for (; j<N; ++j) {
+            const size_t first = skip*(traits::is_forward ? j : M - j - 1);
+            _trsm_panel<T,M,N,UpLo,Transpose,SIMDVector<T,simd_abi::scalar>>(a,inv_diag,b,x,first,j);
+        }
+    }
+    else {
+        // Too few right hand sides to vectorise across, vectorise along A instead
+        T y[M];
+        for (size_t j=0; j<N; ++j) {
+            for (size_t i=0; i<M; ++i) y[i] = b[i*N+j];
+            _trsm_vector<T,M,UpLo,Transpose>(a,inv_diag,y);
+            for (size_t i=0; i<M; ++i) x[i*N+j] = y[i];
+        }
+    }
+}
+
+} // internal
+
+
+/* Triangular solve op(A) * X = B for an M x M triangular matrix A and M x N right hand sides B,
+    all row-major. UpLo is one of UpLoType::Lower, UniLower, Upper or UniUpper and describes A as
+    it is stored, only that triangle of A is referenced and the diagonal is taken as one for the
+    unit variants. op(A) is A or, if Transpose is set, A^T. X may alias B
+*/
+template<typename T, size_t M, size_t N, typename UpLo, bool Transpose = false>
+FASTOR_INLINE void _trsm(const T* FASTOR_RESTRICT a, const T* b, T* x) {
+    internal::_trsm_dispatch<T,M,N,UpLo,Transpose,false>(a,b,x);
+}
+
+} // end of namespace Fastor
+
+#endif // TRSM_H
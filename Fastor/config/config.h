@@ -228,6 +228,17 @@ SOFTWARE.
     #define FASTOR_SSE2_IMPL 1
 #endif
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    #define FASTOR_NEON_IMPL 1
+#endif
+
+#if defined(__F16C__)
+    #define FASTOR_F16C_IMPL 1
+#endif
+#if defined(__AVX512BF16__)
+    #define FASTOR_AVX512BF16_IMPL 1
+#endif
+
 #if defined(__FMA4__)
     #define FASTOR_FMA4_IMPL 1
 #endif
@@ -293,7 +304,7 @@ SOFTWARE.
     #define FASTOR_SSE_IMPL 1
 #endif
 
-#if !defined(FASTOR_MIC_IMPL) && !defined(FASTOR_AVX512_IMPL) && !defined(FASTOR_AVX_IMPL) && !defined(FASTOR_SSE_IMPL)
+#if !defined(FASTOR_MIC_IMPL) && !defined(FASTOR_AVX512_IMPL) && !defined(FASTOR_AVX_IMPL) && !defined(FASTOR_SSE_IMPL) && !defined(FASTOR_NEON_IMPL)
 #define FASTOR_SCALAR_IMPL 1
 #endif
 
@@ -316,6 +327,9 @@ SOFTWARE.
 #ifdef FASTOR_AVX_IMPL
 #include <immintrin.h>
 #endif
+#ifdef FASTOR_NEON_IMPL
+#include <arm_neon.h>
+#endif
 
 
 // Mask loading
@@ -66,6 +66,57 @@ public:
 // std::cout << "CPU vendor = " << vendor << std::endl;
 
 
+/* Contents of the XCR0 register, that is the register states the OS saves
+   on a context switch. Only meaningful if CPUID(1) reports OSXSAVE
+*/
+inline uint64_t xgetbv0() {
+#ifdef _WIN32
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    asm volatile (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+    return (uint64_t(edx) << 32) | eax;
+#endif
+}
+
+/* SIMD instruction sets of the CPU Fastor is running on, as opposed to
+   the ones it has been compiled for
+*/
+struct CPUFeatures {
+    bool sse2    = false;
+    bool sse4_1  = false;
+    bool avx     = false;
+    bool avx2    = false;
+    bool fma     = false;
+    bool avx512f = false;
+
+    CPUFeatures() {
+        const uint32_t max_leaf = CPUID(0).EAX();
+        if (max_leaf < 1) return;
+        const CPUID leaf1(1);
+        sse2   = (leaf1.EDX() >> 26) & 1;
+        sse4_1 = (leaf1.ECX() >> 19) & 1;
+        fma    = (leaf1.ECX() >> 12) & 1;
+        // the OS has to save the ymm/zmm registers for avx/avx512 to be usable
+        const bool osxsave = (leaf1.ECX() >> 27) & 1;
+        const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+        const bool ymm_state = (xcr0 & 0x06) == 0x06;
+        const bool zmm_state = (xcr0 & 0xe6) == 0xe6;
+        avx = ((leaf1.ECX() >> 28) & 1) && ymm_state;
+        fma = fma && avx;
+        if (max_leaf < 7) return;
+        const CPUID leaf7(7);
+        avx2    = ((leaf7.EBX() >>  5) & 1) && ymm_state;
+        avx512f = ((leaf7.EBX() >> 16) & 1) && zmm_state;
+    }
+};
+
+inline const CPUFeatures& cpu_features() {
+    static const CPUFeatures features;
+    return features;
+}
+
+
 } // Fastor
 
 #endif // CPUID_H
@@ -83,6 +83,23 @@ SOFTWARE.
 //------------------------------------------------------------------------------------------------//
 
 
+// Multithreading - off by default. Define FASTOR_USE_OPENMP to evaluate large
+// expressions using OpenMP or FASTOR_USE_THREADS to use a std::thread pool
+//------------------------------------------------------------------------------------------------//
+#if defined(FASTOR_USE_OPENMP) || defined(FASTOR_USE_THREADS)
+#define FASTOR_PARALLEL 1
+#endif
+// Expressions with fewer entries than this are evaluated serially
+#ifndef FASTOR_PARALLEL_THRESHOLD
+#define FASTOR_PARALLEL_THRESHOLD 32768
+#endif
+// Bytes of output per chunk of work handed to a thread
+#ifndef FASTOR_PARALLEL_CHUNK_BYTES
+#define FASTOR_PARALLEL_CHUNK_BYTES 32768
+#endif
+//------------------------------------------------------------------------------------------------//
+
+
 // Macros used throughout Fastor
 //------------------------------------------------------------------------------------------------//
 //#define FASTOR_COPY_EXPR
@@ -92,6 +109,9 @@ SOFTWARE.
 //#define FASTOR_USE_OLD_INTRINSICS
 //#define FASTOR_USE_HADD
 //#define FASTOR_USE_VECTORISED_EXPR_ASSIGN  // to use vectorised expression assignment
+//#define FASTOR_NO_HARDWARE_GATHER // to build non-contiguous SIMD vectors lane by lane instead of with gather instructions
+//#define FASTOR_NO_STREAMING_STORES // to always store through the caches irrespective of the size of the output
+//#define FASTOR_NO_MASKED_TAILS // to finish loops with scalar code instead of a masked vector
 //#define FASTOR_ZERO_INITIALISE
 //#define FASTOR_USE_OLD_NDVIEWS
 //#define FASTOR_DISPATCH_DIV_TO_MUL_EXPR // change BINARY_DIV_OP to BINARY_MUL_OP for Expression/Number
@@ -107,6 +127,41 @@ SOFTWARE.
 #define FASTOR_BLAS_SWITCH_MATRIX_SIZE 16
 #endif
 
+// Cache sizes in bytes used for blocking the built-in gemm
+#ifndef FASTOR_L1_CACHE_SIZE
+#define FASTOR_L1_CACHE_SIZE 32768UL
+#endif
+#ifndef FASTOR_L2_CACHE_SIZE
+#define FASTOR_L2_CACHE_SIZE 1048576UL
+#endif
+#ifndef FASTOR_L3_CACHE_SIZE
+#define FASTOR_L3_CACHE_SIZE 4194304UL
+#endif
+
+// Assignments writing more than this many bytes use non-temporal stores as
+// their output would only evict the inputs from the last level cache
+#ifndef FASTOR_STREAMING_STORE_THRESHOLD
+#define FASTOR_STREAMING_STORE_THRESHOLD FASTOR_L3_CACHE_SIZE
+#endif
+
+// Switch to the cache blocked gemm when M*N*K*sizeof(T) exceeds the cube of
+// this size times sizeof(double)
+#ifndef FASTOR_BLOCKED_GEMM_SWITCH_MATRIX_SIZE
+#define FASTOR_BLOCKED_GEMM_SWITCH_MATRIX_SIZE 384
+#endif
+
+// Tensor networks with up to this many operands are ordered by an exhaustive
+// search over all contraction trees, larger networks are ordered greedily
+#ifndef FASTOR_OPMIN_MAX_DP_OPERANDS
+#define FASTOR_OPMIN_MAX_DP_OPERANDS 8
+#endif
+
+// Mixed precision solves stop refining the solution after this many iterations
+// and fall back to solving in double precision
+#ifndef FASTOR_MIXED_SOLVE_MAX_ITERATIONS
+#define FASTOR_MIXED_SOLVE_MAX_ITERATIONS 30
+#endif
+
 // FASTOR_NIL
 //------------------------------------------------------------------------------------------------//
 #define FASTOR_NIL 0
@@ -118,6 +173,7 @@ SOFTWARE.
 #define FASTOR_AVX512_BITSIZE 512
 #define FASTOR_AVX_BITSIZE 256
 #define FASTOR_SSE_BITSIZE 128
+#define FASTOR_NEON_BITSIZE 128
 #define FASTOR_DOUBLE_BITSIZE (sizeof(double)*8)
 #define FASTOR_SINGLE_BITSIZE (sizeof(float)*8)
 #ifndef FASTOR_SCALAR_BITSIZE
@@ -133,7 +189,7 @@ SOFTWARE.
 #define FASTOR_MEMORY_ALIGNMENT_VALUE 64
 #elif defined(FASTOR_AVX_IMPL)
 #define FASTOR_MEMORY_ALIGNMENT_VALUE 32
-#elif defined(FASTOR_SSE_IMPL)
+#elif defined(FASTOR_SSE_IMPL) || defined(FASTOR_NEON_IMPL)
 #define FASTOR_MEMORY_ALIGNMENT_VALUE 16
 #else
 #define FASTOR_MEMORY_ALIGNMENT_VALUE 8
@@ -0,0 +1,543 @@
+#ifndef SYMMETRIC_TENSOR_H
+#define SYMMETRIC_TENSOR_H
+
+
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorIO.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/meta/tensor_meta.h"
+#include "Fastor/meta/einsum_meta.h"
+#include "Fastor/backend/voigt.h"
+
+namespace Fastor {
+
+namespace internal {
+
+// Position of the pair (i,j) of a symmetric NxN tensor in Voigt order,
+// that is diagonal entries first followed by the upper off-diagonal row by row
+constexpr FASTOR_INLINE size_t symmetric_pair_index(size_t i, size_t j, size_t N) {
+    const size_t lo = i < j ? i : j;
+    const size_t hi = i < j ? j : i;
+    return lo == hi ? lo : N + lo*(2*N-lo-1)/2 + (hi-lo-1);
+}
+
+// Position of (a,b) in the row by row packed upper triangle of a symmetric MxM matrix
+constexpr FASTOR_INLINE size_t packed_upper_index(size_t a, size_t b, size_t M) {
+    const size_t lo = a < b ? a : b;
+    const size_t hi = a < b ? b : a;
+    return lo*(2*M-lo+1)/2 + (hi-lo);
+}
+
+// The indices (i,j) of every Voigt pair
+template<size_t N>
+struct voigt_pair_table {
+    size_t first[N*(N+1)/2];
+    size_t second[N*(N+1)/2];
+};
+template<size_t N>
+constexpr voigt_pair_table<N> make_voigt_pair_table() {
+    voigt_pair_table<N> table = {};
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=i; j<N; ++j) {
+            table.first[symmetric_pair_index(i,j,N)] = i;
+            table.second[symmetric_pair_index(i,j,N)] = j;
+        }
+    }
+    return table;
+}
+template<size_t N>
+struct voigt_pairs {
+    static constexpr voigt_pair_table<N> table = make_voigt_pair_table<N>();
+};
+template<size_t N>
+constexpr voigt_pair_table<N> voigt_pairs<N>::table;
+
+template<size_t ... Rest>
+struct symmetric_storage;
+
+// Symmetric second order tensor a_ij = a_ji
+template<size_t N>
+struct symmetric_storage<N,N> {
+    static constexpr size_t pairs = N*(N+1)/2;
+    static constexpr size_t size = pairs;
+    static constexpr FASTOR_INLINE size_t index(const size_t *as) {
+        return symmetric_pair_index(as[0],as[1],N);
+    }
+};
+
+// Fourth order tensor with minor a_ijkl = a_jikl = a_ijlk and
+// major a_ijkl = a_klij symmetries, i.e. a symmetric matrix of Voigt pairs
+template<size_t N>
+struct symmetric_storage<N,N,N,N> {
+    static constexpr size_t pairs = N*(N+1)/2;
+    static constexpr size_t size = pairs*(pairs+1)/2;
+    static constexpr FASTOR_INLINE size_t index(const size_t *as) {
+        return packed_upper_index(symmetric_pair_index(as[0],as[1],N),symmetric_pair_index(as[2],as[3],N),pairs);
+    }
+};
+
+} // internal
+
+
+//! Symmetric tensors with packed storage
+//!
+//! SymmetricTensor<T,N,N> stores the N(N+1)/2 independent entries of a symmetric second
+//! order tensor and SymmetricTensor<T,N,N,N,N> the M(M+1)/2, M=N(N+1)/2, independent entries
+//! of a fourth order tensor with minor and major symmetries such as an elasticity tensor.
+//! Writing an entry writes all of its symmetric counterparts. In expressions the tensors
+//! behave like dense tensors and evaluate to Tensor<T,Rest...>
+template<typename T, size_t ...Rest>
+class SymmetricTensor : public AbstractTensor<SymmetricTensor<T,Rest...>,sizeof...(Rest)> {
+public:
+    using scalar_type      = T;
+    using simd_vector_type = choose_best_simd_vector_t<T>;
+    using simd_abi_type    = typename simd_vector_type::abi_type;
+    using result_type      = Tensor<T,Rest...>;
+    using dimension_t      = std::integral_constant<FASTOR_INDEX, sizeof...(Rest)>;
+    using storage_type     = internal::symmetric_storage<Rest...>;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return sizeof...(Rest);}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return pack_prod<Rest...>::value;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX packed_size() {return storage_type::size;}
+    FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX dim) const {
+#if FASTOR_SHAPE_CHECK
+        FASTOR_ASSERT(dim>=0 && dim < sizeof...(Rest), "TENSOR SHAPE MISMATCH");
+#endif
+        constexpr FASTOR_INDEX DimensionHolder[sizeof...(Rest)] = {Rest...};
+        return DimensionHolder[dim];
+    }
+
+    constexpr FASTOR_INLINE SymmetricTensor() : _data{} {}
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE SymmetricTensor(U num) {
+        std::fill(_data.begin(),_data.end(),static_cast<T>(num));
+    }
+
+    // a is assumed to have the symmetries, it is not symmetrised
+    FASTOR_INLINE explicit SymmetricTensor(const Tensor<T,Rest...> &a) {
+        size_t as[dimension_t::value] = {};
+        for (FASTOR_INDEX i=0; i<size(); ++i) {
+            get_indices(i,as);
+            _data[storage_type::index(as)] = a.data()[i];
+        }
+    }
+
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data.data());}
+
+    // Index retriever
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename... Args, typename std::enable_if<sizeof...(Args)==dimension_t::value &&
+                                is_arithmetic_pack<Args...>::value,bool>::type =0>
+    FASTOR_INLINE FASTOR_INDEX get_packed_index(Args ... args) const {
+        constexpr size_t N = get_value<1,Rest...>::value;
+        const long long raw[sizeof...(Args)] = {static_cast<long long>(args)...};
+        size_t as[sizeof...(Args)];
+        bool in_bounds = true;
+        for (FASTOR_INDEX it=0; it<dimension_t::value; ++it) {
+            as[it] = raw[it] < 0 ? size_t(N + raw[it]) : size_t(raw[it]);
+            in_bounds = in_bounds && as[it] < N;
+        }
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(in_bounds, "INDEX OUT OF BOUNDS");
+#endif
+        unused(in_bounds);
+        return storage_type::index(as);
+    }
+
+    // Indices of the flat (dense row-major) position i
+    FASTOR_INLINE void get_indices(FASTOR_INDEX i, size_t *as) const {
+        constexpr size_t DimensionHolder[dimension_t::value] = {Rest...};
+        for (int it = int(dimension_t::value)-1; it>=0; --it) {
+            as[it] = i % DimensionHolder[it];
+            i /= DimensionHolder[it];
+        }
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename... Args, typename std::enable_if<sizeof...(Args)==dimension_t::value &&
+                                is_arithmetic_pack<Args...>::value,bool>::type =0>
+    FASTOR_INLINE T& operator()(Args ... args) {
+        return _data[get_packed_index(args...)];
+    }
+    template<typename... Args, typename std::enable_if<sizeof...(Args)==dimension_t::value &&
+                                is_arithmetic_pack<Args...>::value,bool>::type =0>
+    FASTOR_INLINE const T& operator()(Args ... args) const {
+        return _data[get_packed_index(args...)];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Expression templates evaluators
+    //----------------------------------------------------------------------------------------------------------//
+    // Entries are evaluated in their dense row-major order
+    template<typename U=T>
+    FASTOR_INLINE T eval_s(FASTOR_INDEX i) const {
+        size_t as[dimension_t::value];
+        get_indices(i,as);
+        return _data[storage_type::index(as)];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i) const {
+        using V = SIMDVector<U,simd_abi_type>;
+        FASTOR_ALIGN U vals[V::Size];
+        for (FASTOR_INDEX j=0; j<V::Size; ++j) {
+            vals[j] = eval_s(i+j);
+        }
+        return V(vals);
+    }
+    template<typename U=T>
+    FASTOR_INLINE T eval_s(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return (*this)(i,j);
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        using V = SIMDVector<U,simd_abi_type>;
+        FASTOR_ALIGN U vals[V::Size];
+        for (FASTOR_INDEX k=0; k<V::Size; ++k) {
+            vals[k] = (*this)(i,j+k);
+        }
+        return V(vals);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Cast method
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename U>
+    FASTOR_INLINE SymmetricTensor<U,Rest...> cast() const {
+        SymmetricTensor<U,Rest...> out;
+        std::copy(_data.begin(),_data.end(),out.data());
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    //----------------------------------------------------------------------------------------------------------//
+private:
+    static_assert((sizeof...(Rest)==2 || sizeof...(Rest)==4) && no_of_unique<Rest...>::value==1,
+        "SYMMETRIC TENSORS HAVE TO BE SECOND OR FOURTH ORDER WITH EQUAL DIMENSIONS");
+    FASTOR_ALIGN std::array<T,storage_type::size> _data;
+    //----------------------------------------------------------------------------------------------------------//
+};
+
+
+template<typename T, size_t ... Rest>
+struct tensor_type_finder<SymmetricTensor<T,Rest...>> {
+    using type = Tensor<T,Rest...>;
+};
+
+template<typename T, size_t ... Rest>
+struct scalar_type_finder<SymmetricTensor<T,Rest...>> {
+    using type = T;
+};
+
+
+// Assignment to dense tensors
+//----------------------------------------------------------------------------------------------------------//
+template<typename Derived, size_t DIM, typename T, size_t ...Rest>
+FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const SymmetricTensor<T,Rest...> &src) {
+    trivial_assign(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, size_t ...Rest>
+FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const SymmetricTensor<T,Rest...> &src) {
+    trivial_assign_add(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, size_t ...Rest>
+FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const SymmetricTensor<T,Rest...> &src) {
+    trivial_assign_sub(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, size_t ...Rest>
+FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const SymmetricTensor<T,Rest...> &src) {
+    trivial_assign_mul(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, size_t ...Rest>
+FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const SymmetricTensor<T,Rest...> &src) {
+    trivial_assign_div(dst.self(),src);
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Arithmetic that keeps the packed storage
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t ... Rest>
+FASTOR_INLINE SymmetricTensor<T,Rest...> operator+(const SymmetricTensor<T,Rest...> &a, const SymmetricTensor<T,Rest...> &b) {
+    SymmetricTensor<T,Rest...> out;
+    for (FASTOR_INDEX i=0; i<out.packed_size(); ++i) out.data()[i] = a.data()[i] + b.data()[i];
+    return out;
+}
+template<typename T, size_t ... Rest>
+FASTOR_INLINE SymmetricTensor<T,Rest...> operator-(const SymmetricTensor<T,Rest...> &a, const SymmetricTensor<T,Rest...> &b) {
+    SymmetricTensor<T,Rest...> out;
+    for (FASTOR_INDEX i=0; i<out.packed_size(); ++i) out.data()[i] = a.data()[i] - b.data()[i];
+    return out;
+}
+template<typename T, size_t ... Rest, typename U, enable_if_t_<is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,Rest...> operator*(const SymmetricTensor<T,Rest...> &a, U b) {
+    SymmetricTensor<T,Rest...> out;
+    for (FASTOR_INDEX i=0; i<out.packed_size(); ++i) out.data()[i] = a.data()[i]*static_cast<T>(b);
+    return out;
+}
+template<typename T, size_t ... Rest, typename U, enable_if_t_<is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,Rest...> operator*(U a, const SymmetricTensor<T,Rest...> &b) {
+    return b*a;
+}
+template<typename T, size_t ... Rest, typename U, enable_if_t_<is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,Rest...> operator/(const SymmetricTensor<T,Rest...> &a, U b) {
+    SymmetricTensor<T,Rest...> out;
+    for (FASTOR_INDEX i=0; i<out.packed_size(); ++i) out.data()[i] = a.data()[i]/static_cast<T>(b);
+    return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Reductions
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N>
+FASTOR_INLINE T trace(const SymmetricTensor<T,N,N> &a) {
+    // diagonal entries come first
+    T out = 0;
+    for (size_t i=0; i<N; ++i) out += a.data()[i];
+    return out;
+}
+
+// a_ij b_ij, the off-diagonal entries appear twice
+template<typename T, size_t N>
+FASTOR_INLINE T inner(const SymmetricTensor<T,N,N> &a, const SymmetricTensor<T,N,N> &b) {
+    const T *a_data = a.data();
+    const T *b_data = b.data();
+    T diag = 0, off = 0;
+    for (size_t i=0; i<N; ++i) diag += a_data[i]*b_data[i];
+    for (size_t i=N; i<a.packed_size(); ++i) off += a_data[i]*b_data[i];
+    return diag + 2*off;
+}
+template<typename T, size_t N>
+FASTOR_INLINE T inner(const SymmetricTensor<T,N,N> &a, const Tensor<T,N,N> &b) {
+    const T *a_data = a.data();
+    const T *b_data = b.data();
+    T out = 0;
+    for (size_t i=0; i<N; ++i) {
+        out += a_data[i]*b_data[i*N+i];
+        for (size_t j=i+1; j<N; ++j) {
+            out += a_data[internal::symmetric_pair_index(i,j,N)]*(b_data[i*N+j]+b_data[j*N+i]);
+        }
+    }
+    return out;
+}
+template<typename T, size_t N>
+FASTOR_INLINE T inner(const Tensor<T,N,N> &a, const SymmetricTensor<T,N,N> &b) {
+    return inner(b,a);
+}
+
+// a_ijkl b_ijkl, each Voigt pair that is not on the diagonal appears twice
+template<typename T, size_t N>
+FASTOR_INLINE T inner(const SymmetricTensor<T,N,N,N,N> &a, const SymmetricTensor<T,N,N,N,N> &b) {
+    constexpr size_t M = N*(N+1)/2;
+    const T *a_data = a.data();
+    const T *b_data = b.data();
+    T out = 0;
+    size_t pq = 0;
+    for (size_t p=0; p<M; ++p) {
+        for (size_t q=p; q<M; ++q, ++pq) {
+            const T w = T(p == q ? 1 : 2)*(p < N ? 1 : 2)*(q < N ? 1 : 2);
+            out += w*a_data[pq]*b_data[pq];
+        }
+    }
+    return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Double contraction with a second order tensor
+//----------------------------------------------------------------------------------------------------------//
+namespace internal {
+// Weights of the Voigt pairs of a second order tensor in a double contraction
+// c_ijkl b_kl = c_ij(kl) bb_(kl) where bb_(kl) = b_kl + b_lk for k != l
+template<typename T, size_t N>
+FASTOR_INLINE void symmetric_contraction_weights(const SymmetricTensor<T,N,N> &b, T *bb) {
+    for (size_t p=0; p<b.packed_size(); ++p) bb[p] = (p < N ? 1 : 2)*b.data()[p];
+}
+template<typename T, size_t N>
+FASTOR_INLINE void symmetric_contraction_weights(const Tensor<T,N,N> &b, T *bb) {
+    const T *b_data = b.data();
+    for (size_t k=0; k<N; ++k) {
+        bb[k] = b_data[k*N+k];
+        for (size_t l=k+1; l<N; ++l) {
+            bb[symmetric_pair_index(k,l,N)] = b_data[k*N+l] + b_data[l*N+k];
+        }
+    }
+}
+
+// Expands the packed upper triangle of a fourth order symmetric tensor in to the full
+// matrix of its Voigt pairs so that the matmul kernels can be used
+template<typename T, size_t N, size_t M = N*(N+1)/2>
+FASTOR_INLINE void symmetric_unpack(const SymmetricTensor<T,N,N,N,N> &a, Tensor<T,M,M> &A) {
+    const T *a_data = a.data();
+    T *A_data = A.data();
+    size_t pq = 0;
+    for (size_t p=0; p<M; ++p) {
+        for (size_t q=p; q<M; ++q, ++pq) {
+            A_data[p*M+q] = a_data[pq];
+            A_data[q*M+p] = a_data[pq];
+        }
+    }
+}
+
+// c_(ij)(kl) bb_(kl) is a symmetric matrix-vector product in Voigt pairs, the packed
+// upper triangle is walked once and every entry is used for both of its positions
+template<typename T, size_t N, typename Tens>
+FASTOR_INLINE SymmetricTensor<T,N,N> symmetric_double_contraction(const SymmetricTensor<T,N,N,N,N> &a, const Tens &b) {
+    constexpr size_t M = N*(N+1)/2;
+    T bb[M];
+    symmetric_contraction_weights(b,bb);
+    const T *a_data = a.data();
+    T acc[M] = {};
+    size_t pq = 0;
+    for (size_t p=0; p<M; ++p) {
+        acc[p] += a_data[pq++]*bb[p];
+        for (size_t q=p+1; q<M; ++q, ++pq) {
+            acc[p] += a_data[pq]*bb[q];
+            acc[q] += a_data[pq]*bb[p];
+        }
+    }
+    SymmetricTensor<T,N,N> out;
+    std::copy(acc,acc+M,out.data());
+    return out;
+}
+
+// Is the pair contraction a_ijkl b_kl or a_klij b_kl (or any of their symmetric variants)
+template<class Idx4, class Idx2>
+struct is_symmetric_double_contraction {
+    static constexpr bool value = false;
+};
+template<size_t I0, size_t I1, size_t I2, size_t I3, size_t J0, size_t J1>
+struct is_symmetric_double_contraction<Index<I0,I1,I2,I3>,Index<J0,J1>> {
+    static constexpr bool value = no_of_unique<I0,I1,I2,I3>::value == 4 && J0 != J1 &&
+        (((J0==I2 && J1==I3) || (J0==I3 && J1==I2)) || ((J0==I0 && J1==I1) || (J0==I1 && J1==I0)));
+};
+} // internal
+
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<internal::is_symmetric_double_contraction<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,N,N> einsum(const SymmetricTensor<T,N,N,N,N> &a, const SymmetricTensor<T,N,N> &b) {
+    return internal::symmetric_double_contraction(a,b);
+}
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<internal::is_symmetric_double_contraction<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,N,N> einsum(const SymmetricTensor<T,N,N,N,N> &a, const Tensor<T,N,N> &b) {
+    return internal::symmetric_double_contraction(a,b);
+}
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<internal::is_symmetric_double_contraction<Index_J,Index_I>::value,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,N,N> einsum(const SymmetricTensor<T,N,N> &a, const SymmetricTensor<T,N,N,N,N> &b) {
+    return internal::symmetric_double_contraction(b,a);
+}
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<internal::is_symmetric_double_contraction<Index_J,Index_I>::value,bool> = false>
+FASTOR_INLINE SymmetricTensor<T,N,N> einsum(const Tensor<T,N,N> &a, const SymmetricTensor<T,N,N,N,N> &b) {
+    return internal::symmetric_double_contraction(b,a);
+}
+
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<is_pair_reduction_v<Index_I,Index_J>,bool> = false>
+FASTOR_INLINE Tensor<T> einsum(const SymmetricTensor<T,N,N> &a, const SymmetricTensor<T,N,N> &b) {
+    return inner(a,b);
+}
+template<class Index_I, class Index_J, typename T, size_t N,
+    enable_if_t_<is_pair_reduction_v<Index_I,Index_J>,bool> = false>
+FASTOR_INLINE Tensor<T> einsum(const SymmetricTensor<T,N,N,N,N> &a, const SymmetricTensor<T,N,N,N,N> &b) {
+    return inner(a,b);
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Push-forward of symmetric tensors by a deformation gradient F, that is
+// F_iI F_jJ A_IJ and F_iI F_jJ F_kK F_lL A_IJKL. Scaling by 1/J is left to the caller
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N>
+FASTOR_INLINE SymmetricTensor<T,N,N> push_forward(const SymmetricTensor<T,N,N> &a, const Tensor<T,N,N> &F) {
+    const T *a_data = a.data();
+    const T *F_data = F.data();
+    // FA_iJ = F_iI A_IJ
+    T FA[N][N];
+    for (size_t i=0; i<N; ++i) {
+        for (size_t J=0; J<N; ++J) {
+            T value = 0;
+            for (size_t I=0; I<N; ++I) value += F_data[i*N+I]*a_data[internal::symmetric_pair_index(I,J,N)];
+            FA[i][J] = value;
+        }
+    }
+    // only the upper triangle of FA F^T is computed
+    SymmetricTensor<T,N,N> out;
+    T *out_data = out.data();
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=i; j<N; ++j) {
+            T value = 0;
+            for (size_t J=0; J<N; ++J) value += FA[i][J]*F_data[j*N+J];
+            out_data[internal::symmetric_pair_index(i,j,N)] = value;
+        }
+    }
+    return out;
+}
+
+template<typename T, size_t N>
+FASTOR_INLINE SymmetricTensor<T,N,N,N,N> push_forward(const SymmetricTensor<T,N,N,N,N> &a, const Tensor<T,N,N> &F) {
+    constexpr size_t M = N*(N+1)/2;
+    const T *F_data = F.data();
+    // The push-forward of a symmetric second order tensor in Voigt pairs
+    // P_(ij)(IJ) = F_iI F_jJ + F_iJ F_jI for I != J and F_iI F_jI otherwise
+    // so that the push-forward of a is P A P^T
+    constexpr auto &pairs = internal::voigt_pairs<N>::table;
+    Tensor<T,M,M> P;
+    T *P_data = P.data();
+    for (size_t p=0; p<M; ++p) {
+        const size_t i = pairs.first[p], j = pairs.second[p];
+        for (size_t q=0; q<M; ++q) {
+            const size_t I = pairs.first[q], J = pairs.second[q];
+            P_data[p*M+q] = q < N ? F_data[i*N+I]*F_data[j*N+I] :
+                F_data[i*N+I]*F_data[j*N+J] + F_data[i*N+J]*F_data[j*N+I];
+        }
+    }
+    Tensor<T,M,M> A, PA, Pt, PAPt;
+    internal::symmetric_unpack(a,A);
+    _matmul<T,M,M,M>(P_data,A.data(),PA.data());
+    _transpose<T,M,M>(P_data,Pt.data());
+    _matmul<T,M,M,M>(PA.data(),Pt.data(),PAPt.data());
+
+    SymmetricTensor<T,N,N,N,N> out;
+    T *out_data = out.data();
+    const T *PAPt_data = PAPt.data();
+    size_t pq = 0;
+    for (size_t p=0; p<M; ++p) {
+        for (size_t q=p; q<M; ++q, ++pq) {
+            out_data[pq] = PAPt_data[p*M+q];
+        }
+    }
+    return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Voigt forms are read straight off the packed storage
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N>
+FASTOR_INLINE typename VoigtType<T,N,N>::return_type voigt(const SymmetricTensor<T,N,N> &a) {
+    typename VoigtType<T,N,N>::return_type out;
+    std::copy(a.data(),a.data()+a.packed_size(),out.data());
+    return out;
+}
+template<typename T, size_t N>
+FASTOR_INLINE typename VoigtType<T,N,N,N,N>::return_type voigt(const SymmetricTensor<T,N,N,N,N> &a) {
+    constexpr size_t M = N*(N+1)/2;
+    typename VoigtType<T,N,N,N,N>::return_type out;
+    for (size_t p=0; p<M; ++p) {
+        for (size_t q=0; q<M; ++q) {
+            out(p,q) = a.data()[internal::packed_upper_index(p,q,M)];
+        }
+    }
+    return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // SYMMETRIC_TENSOR_H
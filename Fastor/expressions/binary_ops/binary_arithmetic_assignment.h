@@ -15,7 +15,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<!is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && (requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>), bool> = false >\
+    enable_if_t_<!is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && (requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>) &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false >\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.lhs().self());\
     assign ##OP_ASSIGN_TYPE (dst.self(), src.rhs().self());\
@@ -26,7 +28,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && requires_evaluation_v<TRhs>, bool> = false>\
+    enable_if_t_<is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && requires_evaluation_v<TRhs> &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.lhs());\
     assign  ##OP_ASSIGN_TYPE (dst.self(), src.rhs().self());\
@@ -37,7 +41,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<!is_primitive_v_<TLhs> && is_primitive_v_<TRhs> && requires_evaluation_v<TLhs>, bool> = false>\
+    enable_if_t_<!is_primitive_v_<TLhs> && is_primitive_v_<TRhs> && requires_evaluation_v<TLhs> &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.lhs().self());\
     assign  ##OP_ASSIGN_TYPE (dst.self(), src.rhs());\
@@ -51,7 +57,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<!is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && (requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>), bool> = false >\
+    enable_if_t_<!is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && (requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>) &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false >\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     if (!does_alias(dst.self(),src.rhs().self())) {\
         assign ##ASSIGN_TYPE (dst.self(), src.lhs().self());\
@@ -69,7 +77,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && requires_evaluation_v<TRhs>, bool> = false>\
+    enable_if_t_<is_primitive_v_<TLhs> && !is_primitive_v_<TRhs> && requires_evaluation_v<TRhs> &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.lhs());\
     assign  ##OP_ASSIGN_TYPE (dst.self(), src.rhs().self());\
@@ -80,7 +90,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<!is_primitive_v_<TLhs> && is_primitive_v_<TRhs> && requires_evaluation_v<TLhs>, bool> = false>\
+    enable_if_t_<!is_primitive_v_<TLhs> && is_primitive_v_<TRhs> && requires_evaluation_v<TLhs> &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>, bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.lhs().self());\
     assign  ##OP_ASSIGN_TYPE (dst.self(), src.rhs());\
@@ -96,7 +108,9 @@ FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
-    enable_if_t_<(requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>),bool> = false>\
+    enable_if_t_<(requires_evaluation_v<TLhs> || requires_evaluation_v<TRhs>) &&\
+        !is_fused_gemm_expr_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>> &&\
+        !has_common_subexpression_v<Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>>,bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Binary ##NAME ## Op<TLhs, TRhs, OtherDIM> &src) {\
     using result_type = typename Binary ##NAME ## Op<TLhs, TRhs, OtherDIM>::result_type;\
     const result_type a(src.self());\
@@ -184,6 +184,10 @@ public:\
         return _lhs.template teval_s<EVAL_TYPE>(as) OP (EVAL_TYPE)_rhs;\
     }\
 };\
+template<typename TLhs, typename TRhs, size_t DIM0>\
+struct is_tail_maskable<Binary ##NAME ## Op<TLhs, TRhs, DIM0>> {\
+    static constexpr bool value = is_tail_maskable<TLhs>::value && is_tail_maskable<TRhs>::value;\
+};\
 template<typename TLhs, typename TRhs, size_t DIM0,\
          typename std::enable_if<!is_primitive_v_<TLhs> &&\
                                  !is_primitive_v_<TRhs>,bool>::type = 0 >\
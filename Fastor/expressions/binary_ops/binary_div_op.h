@@ -239,6 +239,13 @@ public:
     }
 };
 
+// The lanes past the end hold arbitrary values which integer division could trap on
+template<typename TLhs, typename TRhs, size_t DIM0>
+struct is_tail_maskable<BinaryDivOp<TLhs, TRhs, DIM0>> {
+    static constexpr bool value = is_tail_maskable<TLhs>::value && is_tail_maskable<TRhs>::value &&
+        !std::is_integral<typename BinaryDivOp<TLhs, TRhs, DIM0>::scalar_type>::value;
+};
+
 template<typename TLhs, typename TRhs, size_t DIM0,
          typename std::enable_if<!is_primitive_v_<TLhs> &&
                                  !is_primitive_v_<TRhs>,bool>::type = 0 >
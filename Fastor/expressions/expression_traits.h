@@ -31,7 +31,7 @@ static constexpr bool is_expression_v = is_expression<Derived>::value;
 template<class T>
 struct expression_binder_type {
 #ifndef FASTOR_COPY_EXPR
-    using type = conditional_t_<is_expression_v<T> || is_arithmetic_v_<T>, const T, const T&>;
+    using type = conditional_t_<is_expression_v<T> || is_primitive_v_<T>, const T, const T&>;
 #else
     using type = const T;
 #endif
@@ -52,6 +52,9 @@ class TensorMap;
 template<typename T, size_t ... Rest>
 class SingleValueTensor;
 
+template<typename T, int DIM>
+class DynamicTensor;
+
 // traits
 //----------------------------------------------------------------------------------------------------------//
 template<typename Derived>
@@ -132,6 +135,20 @@ static constexpr bool is_binary_cmp_op_v = is_binary_cmp_op<Derived>::value;
 //----------------------------------------------------------------------------------------------------------//
 
 
+/* Is an elementwise unary math expression such as sqrt, exp or unary minus.
+    Specialised by FASTOR_MAKE_UNARY_MATH_OPS
+*/
+//----------------------------------------------------------------------------------------------------------//
+template<typename Derived>
+struct is_unary_math_op {
+    static constexpr bool value = false;
+};
+
+template<typename Derived>
+static constexpr bool is_unary_math_op_v = is_unary_math_op<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
 /* Is boolean expresssion */
 //----------------------------------------------------------------------------------------------------------//
 template<typename Derived>
@@ -144,6 +161,30 @@ static constexpr bool is_boolean_expression_v = is_boolean_expression<Derived>::
 //----------------------------------------------------------------------------------------------------------//
 
 
+/* Whether an expression can be evaluated a whole SIMD vector at a time past its last entry so
+    that loops can finish with a masked vector instead of a scalar loop. Tensor and DynamicTensor
+    storage is padded to or aligned on the SIMD width so a vector that starts before the end never
+    reads outside of it. Specialised by the elementwise expressions on top of them
+*/
+//----------------------------------------------------------------------------------------------------------//
+template<typename Derived>
+struct is_tail_maskable {
+    static constexpr bool value = is_primitive_v_<Derived>;
+};
+template<typename T, size_t ... Rest>
+struct is_tail_maskable<Tensor<T,Rest...>> {
+    static constexpr bool value = true;
+};
+template<typename T, int DIM>
+struct is_tail_maskable<DynamicTensor<T,DIM>> {
+    static constexpr bool value = true;
+};
+
+template<typename Derived>
+static constexpr bool is_tail_maskable_v = is_tail_maskable<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
 //----------------------------------------------------------------------------------------------------------//
 template<typename Derived>
 struct is_tensor_view {
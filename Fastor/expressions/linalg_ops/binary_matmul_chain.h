@@ -0,0 +1,169 @@
+#ifndef BINARY_MATMUL_CHAIN_H
+#define BINARY_MATMUL_CHAIN_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
+
+#include <array>
+#include <tuple>
+
+// Assignment of chains of matrix products
+//
+// A % B % C % v builds nested BinaryMatMulOp nodes that are evaluated in the
+// order they are written, here ((A % B) % C) % v, even when multiplying from
+// the right (three matrix-vector products) is far cheaper. As all extents
+// are known at compile time the chain is flattened in to its factors and the
+// parenthesisation with the smallest flop count is found with the classic
+// matrix-chain dynamic program at compile time. Every factor that is not a
+// tensor, for instance trans(A) or A + B, is evaluated once and the last
+// product is assigned through the usual matmul assignment.
+// is_binary_matmul_chain [linalg_traits.h] decides which expressions qualify
+
+namespace Fastor {
+
+namespace internal {
+
+// Optimal parenthesisation
+//----------------------------------------------------------------------------------------------------------//
+/* Factor i of the chain is p[i] x p[i+1]. Returns the factor after which
+    the product of the factors first...last is split. Ties keep the left
+    to right order
+*/
+template<size_t N>
+constexpr size_t matmul_chain_split(const std::array<size_t,N+1> &p, size_t first, size_t last) {
+    size_t cost[N][N] = {};
+    size_t split[N][N] = {};
+    for (size_t len=1; len<N; ++len) {
+        for (size_t i=0; i+len<N; ++i) {
+            const size_t j = i + len;
+            cost[i][j] = size_t(-1);
+            for (size_t k=i; k<j; ++k) {
+                const size_t c = cost[i][k] + cost[k+1][j] + p[i]*p[k+1]*p[j+1];
+                if (c < cost[i][j]) {
+                    cost[i][j] = c;
+                    split[i][j] = k;
+                }
+            }
+        }
+    }
+    return split[first][last];
+}
+
+/* A vector factor can only be the first or the last one and is treated
+    as a row or column vector respectively
+*/
+template<typename Factor, bool IsFirst>
+struct matmul_chain_factor_extents {
+    using result_type = typename Factor::result_type;
+    static constexpr bool is_vector = result_type::dimension_t::value == 1;
+    static constexpr size_t rows = is_vector && IsFirst ? 1 : get_tensor_dimension_v<0,result_type>;
+    static constexpr size_t cols = is_vector ? (IsFirst ? get_tensor_dimension_v<0,result_type> : 1)
+                                             : get_tensor_dimension_v<1,result_type>;
+};
+
+template<typename Factors, typename Seq = typename std_ext::make_index_sequence<std::tuple_size<Factors>::value>::type>
+struct matmul_chain;
+template<typename ... Factors, size_t ... Is>
+struct matmul_chain<std::tuple<Factors...>,std_ext::index_sequence<Is...>> {
+    using factors = std::tuple<Factors...>;
+    // factors as they are held by the expression
+    using bound_type = std::tuple<expression_t<Factors>...>;
+    static constexpr size_t size = sizeof...(Factors);
+
+    static constexpr std::array<size_t,size+1> extents() {
+        return {{matmul_chain_factor_extents<typename std::tuple_element<0,factors>::type,true>::rows,
+                 matmul_chain_factor_extents<Factors,Is==0>::cols...}};
+    }
+    static constexpr size_t split(size_t first, size_t last) {
+        return matmul_chain_split<size>(extents(),first,last);
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Evaluation
+//----------------------------------------------------------------------------------------------------------//
+template<typename Expr>
+struct matmul_chain_bind {
+    static FASTOR_INLINE std::tuple<expression_t<Expr>> get(const Expr &expr) {
+        return std::tuple<expression_t<Expr>>(expr);
+    }
+};
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_chain_bind<BinaryMatMulOp<TLhs,TRhs,DIM>> {
+    static FASTOR_INLINE auto get(const BinaryMatMulOp<TLhs,TRhs,DIM> &expr)
+        -> decltype(std::tuple_cat(matmul_chain_bind<TLhs>::get(expr.lhs()),matmul_chain_bind<TRhs>::get(expr.rhs()))) {
+        return std::tuple_cat(matmul_chain_bind<TLhs>::get(expr.lhs()),matmul_chain_bind<TRhs>::get(expr.rhs()));
+    }
+};
+
+// Product of the factors first...last
+template<typename Chain, size_t first, size_t last, bool IsFactor = first==last>
+struct matmul_chain_product;
+
+template<typename Chain, size_t first, size_t last>
+struct matmul_chain_product<Chain,first,last,true> {
+    using factor_type = typename std::tuple_element<first,typename Chain::factors>::type;
+    using result_type = typename factor_type::result_type;
+
+    template<typename F = factor_type, enable_if_t_<is_tensor_v<F>,bool> = false>
+    static FASTOR_INLINE const F& get(const typename Chain::bound_type &factors) {
+        return std::get<first>(factors);
+    }
+    template<typename F = factor_type, enable_if_t_<!is_tensor_v<F>,bool> = false>
+    static FASTOR_INLINE result_type get(const typename Chain::bound_type &factors) {
+        return result_type(std::get<first>(factors));
+    }
+};
+
+template<typename Chain, size_t first, size_t last>
+struct matmul_chain_product<Chain,first,last,false> {
+    static constexpr size_t split = Chain::split(first,last);
+    using lhs_product = matmul_chain_product<Chain,first,split>;
+    using rhs_product = matmul_chain_product<Chain,split+1,last>;
+    using result_type = typename BinaryMatMulOp<typename lhs_product::result_type,
+                                                typename rhs_product::result_type,2>::result_type;
+
+    static FASTOR_INLINE result_type get(const typename Chain::bound_type &factors) {
+        const auto &a = lhs_product::get(factors);
+        const auto &b = rhs_product::get(factors);
+        result_type out;
+        matmul_dispatcher(a,b,out);
+        return out;
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+// assignments
+//----------------------------------------------------------------------------------------------------------//
+#define FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(ASSIGN_TYPE)\
+template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,\
+    enable_if_t_<is_binary_matmul_chain_v<BinaryMatMulOp<TLhs,TRhs,OtherDIM>> &&\
+        !has_common_subexpression_v<BinaryMatMulOp<TLhs,TRhs,OtherDIM>>,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs,TRhs,OtherDIM> &src) {\
+    using factors = typename matmul_chain_factors<BinaryMatMulOp<TLhs,TRhs,OtherDIM>>::type;\
+    using chain_type = internal::matmul_chain<factors>;\
+    using product_type = internal::matmul_chain_product<chain_type,0,chain_type::size-1>;\
+    const typename chain_type::bound_type bound = internal::matmul_chain_bind<BinaryMatMulOp<TLhs,TRhs,OtherDIM>>::get(src);\
+    const auto &a = product_type::lhs_product::get(bound);\
+    const auto &b = product_type::rhs_product::get(bound);\
+    assign ##ASSIGN_TYPE (dst.self(), BinaryMatMulOp<remove_all_t<decltype(a)>,remove_all_t<decltype(b)>,OtherDIM>(a,b));\
+}\
+
+FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(    )
+FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(_add)
+FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(_sub)
+FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(_mul)
+FASTOR_MAKE_MATMUL_CHAIN_ASSIGNMENT(_div)
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_MATMUL_CHAIN_H
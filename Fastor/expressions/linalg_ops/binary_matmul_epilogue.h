@@ -0,0 +1,230 @@
+#ifndef BINARY_MATMUL_EPILOGUE_H
+#define BINARY_MATMUL_EPILOGUE_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/aligned_alloc.h"
+#include "Fastor/backend/matmul/matmul_epilogue.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/binary_ops/binary_arithmetic_ops.h"
+#include "Fastor/expressions/unary_ops/unary_math_ops.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
+
+#include <algorithm>
+
+// Assignment of matmul expressions with an elementwise epilogue
+//
+// Expressions such as C = 2*(A%B) + D or C = sqrt(A%B) are otherwise
+// evaluated by assigning the product and then applying every elementwise
+// operation in a separate pass over C. Here the product is lowered to
+// _gemm_epilogue and the whole elementwise expression around it is evaluated
+// on each output tile of the product while it is still in registers.
+// is_fused_gemm_expr [linalg_traits.h] decides which expressions qualify
+
+namespace Fastor {
+
+namespace internal {
+
+// Evaluation of the epilogue for a tile acc of the product
+//----------------------------------------------------------------------------------------------------------//
+/* The operand of a binary op that is not the product, either a scalar or an
+    elementwise expression evaluated at the flat index i
+*/
+template<typename T, typename Acc, typename Expr, enable_if_t_<is_primitive_v_<Expr>,bool> = false>
+FASTOR_INLINE Acc gemm_epilogue_operand(const Expr &num, FASTOR_INDEX) {
+    return Acc(T(num));
+}
+template<typename T, typename Acc, typename Expr, enable_if_t_<!is_primitive_v_<Expr> && !is_primitive_v_<Acc>,bool> = false>
+FASTOR_INLINE Acc gemm_epilogue_operand(const Expr &expr, FASTOR_INDEX i) {
+    return expr.template eval<T>(i);
+}
+template<typename T, typename Acc, typename Expr, enable_if_t_<!is_primitive_v_<Expr> && is_primitive_v_<Acc>,bool> = false>
+FASTOR_INLINE Acc gemm_epilogue_operand(const Expr &expr, FASTOR_INDEX i) {
+    return expr.template eval_s<T>(i);
+}
+
+template<typename Expr>
+struct gemm_epilogue_expr;
+
+template<typename TLhs, typename TRhs, size_t DIM>
+struct gemm_epilogue_expr<BinaryMatMulOp<TLhs,TRhs,DIM>> {
+    using matmul_type = BinaryMatMulOp<TLhs,TRhs,DIM>;
+    static FASTOR_INLINE matmul_type matmul(const matmul_type &expr) {
+        return expr;
+    }
+    template<typename T, typename Acc>
+    static FASTOR_INLINE Acc apply(const matmul_type &, const Acc &acc, FASTOR_INDEX) {
+        return acc;
+    }
+};
+
+#define FASTOR_MAKE_GEMM_EPILOGUE_BINARY_EXPR(NAME, OP)\
+template<typename TLhs, typename TRhs, size_t DIM>\
+struct gemm_epilogue_expr<Binary ##NAME ## Op<TLhs,TRhs,DIM>> {\
+    using expr_type = Binary ##NAME ## Op<TLhs,TRhs,DIM>;\
+    using on_lhs = std::integral_constant<bool,is_gemm_epilogue_expr<TLhs>::value>;\
+    using matmul_type = typename gemm_epilogue_expr<conditional_t_<on_lhs::value,TLhs,TRhs>>::matmul_type;\
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {\
+        return matmul(expr, on_lhs());\
+    }\
+    template<typename T, typename Acc>\
+    static FASTOR_INLINE Acc apply(const expr_type &expr, const Acc &acc, FASTOR_INDEX i) {\
+        return apply<T>(expr, acc, i, on_lhs());\
+    }\
+private:\
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr, std::true_type) {\
+        return gemm_epilogue_expr<TLhs>::matmul(expr.lhs());\
+    }\
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr, std::false_type) {\
+        return gemm_epilogue_expr<TRhs>::matmul(expr.rhs());\
+    }\
+    template<typename T, typename Acc>\
+    static FASTOR_INLINE Acc apply(const expr_type &expr, const Acc &acc, FASTOR_INDEX i, std::true_type) {\
+        return gemm_epilogue_expr<TLhs>::template apply<T>(expr.lhs(), acc, i) OP gemm_epilogue_operand<T,Acc>(expr.rhs(), i);\
+    }\
+    template<typename T, typename Acc>\
+    static FASTOR_INLINE Acc apply(const expr_type &expr, const Acc &acc, FASTOR_INDEX i, std::false_type) {\
+        return gemm_epilogue_operand<T,Acc>(expr.lhs(), i) OP gemm_epilogue_expr<TRhs>::template apply<T>(expr.rhs(), acc, i);\
+    }\
+};\
+
+FASTOR_MAKE_GEMM_EPILOGUE_BINARY_EXPR(Add, +)
+FASTOR_MAKE_GEMM_EPILOGUE_BINARY_EXPR(Sub, -)
+FASTOR_MAKE_GEMM_EPILOGUE_BINARY_EXPR(Mul, *)
+FASTOR_MAKE_GEMM_EPILOGUE_BINARY_EXPR(Div, /)
+
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct gemm_epilogue_expr<UnaryExpr<Expr,DIM>> {
+    using expr_type = UnaryExpr<Expr,DIM>;
+    using matmul_type = typename gemm_epilogue_expr<Expr>::matmul_type;
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {
+        return gemm_epilogue_expr<Expr>::matmul(expr.expr());
+    }
+    template<typename T, typename Acc>
+    static FASTOR_INLINE Acc apply(const expr_type &expr, const Acc &acc, FASTOR_INDEX i) {
+        return expr_type::apply(gemm_epilogue_expr<Expr>::template apply<T>(expr.expr(), acc, i));
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// How the result of the epilogue is combined with the destination
+//----------------------------------------------------------------------------------------------------------//
+struct gemm_assign {
+    static constexpr bool reads_destination = false;
+    template<typename Acc>
+    static FASTOR_INLINE Acc apply(const Acc &, const Acc &x) {return x;}
+};
+#define FASTOR_MAKE_GEMM_ASSIGN_TYPE(ASSIGN_TYPE, OP)\
+struct gemm_assign ##ASSIGN_TYPE {\
+    static constexpr bool reads_destination = true;\
+    template<typename Acc>\
+    static FASTOR_INLINE Acc apply(const Acc &c, const Acc &x) {return c OP x;}\
+};\
+
+FASTOR_MAKE_GEMM_ASSIGN_TYPE(_add, +)
+FASTOR_MAKE_GEMM_ASSIGN_TYPE(_sub, -)
+FASTOR_MAKE_GEMM_ASSIGN_TYPE(_mul, *)
+FASTOR_MAKE_GEMM_ASSIGN_TYPE(_div, /)
+
+/* The epilogue functor handed over to _gemm_epilogue */
+template<typename Expr, typename AssignType>
+struct gemm_expr_epilogue {
+    using T = typename Expr::scalar_type;
+    using V = typename Expr::simd_vector_type;
+    const Expr &expr;
+    T * FASTOR_RESTRICT c;
+    FASTOR_INLINE void operator()(const V &acc, FASTOR_INDEX i) const {
+        V x = gemm_epilogue_expr<Expr>::template apply<T>(expr, acc, i);
+        if (AssignType::reads_destination) x = AssignType::apply(V(&c[i],false), x);
+        x.store(&c[i],false);
+    }
+    FASTOR_INLINE void operator()(T acc, FASTOR_INDEX i) const {
+        T x = gemm_epilogue_expr<Expr>::template apply<T>(expr, acc, i);
+        if (AssignType::reads_destination) x = AssignType::apply(c[i], x);
+        c[i] = x;
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Operands of the product
+//----------------------------------------------------------------------------------------------------------//
+/* Operands that are not tensors are evaluated */
+template<typename Expr, bool IsTensor = is_tensor_v<Expr>>
+struct gemm_epilogue_matrix {
+    using T = typename Expr::scalar_type;
+    using result_type = typename Expr::result_type;
+    const result_type _value;
+    FASTOR_INLINE gemm_epilogue_matrix(const Expr &expr, const T *) : _value(expr) {}
+    FASTOR_INLINE const T* data() const {return _value.data();}
+};
+/* Tensors are used in place, unless they alias the destination */
+template<typename Expr>
+struct gemm_epilogue_matrix<Expr,true> {
+    using T = typename Expr::scalar_type;
+    T *_copy = nullptr;
+    const T *_data;
+    FASTOR_INLINE gemm_epilogue_matrix(const Expr &expr, const T *dst) : _data(expr.data()) {
+        if (_data == dst) {
+            _copy = aligned_allocate<T>(expr.size());
+            std::copy(_data,_data+expr.size(),_copy);
+            _data = _copy;
+        }
+    }
+    gemm_epilogue_matrix(const gemm_epilogue_matrix&) = delete;
+    gemm_epilogue_matrix& operator=(const gemm_epilogue_matrix&) = delete;
+    FASTOR_INLINE ~gemm_epilogue_matrix() {aligned_free(_copy);}
+    FASTOR_INLINE const T* data() const {return _data;}
+};
+
+template<typename AssignType, typename Derived, size_t DIM, typename Expr>
+FASTOR_INLINE void _fused_gemm_assign(AbstractTensor<Derived,DIM> &dst, const Expr &src) {
+    using T = typename Expr::scalar_type;
+    using V = typename Expr::simd_vector_type;
+    using matmul_type = typename gemm_epilogue_expr<Expr>::matmul_type;
+    using lhs_type = remove_all_t<typename matmul_type::lhs_expr_type>;
+    using rhs_type = remove_all_t<typename matmul_type::rhs_expr_type>;
+    constexpr size_t M = matmul_type::M;
+    constexpr size_t K = matmul_type::K;
+    constexpr size_t N = matmul_type::N;
+
+    T* out = dst.self().data();
+    FASTOR_ASSERT(dst.self().size()==M*N, "TENSOR SIZE MISMATCH");
+    const matmul_type mat = gemm_epilogue_expr<Expr>::matmul(src);
+    const gemm_epilogue_matrix<lhs_type> a(mat.lhs(), out);
+    const gemm_epilogue_matrix<rhs_type> b(mat.rhs(), out);
+    _gemm_epilogue<T,V,M,K,N>(a.data(),b.data(),gemm_expr_epilogue<Expr,AssignType>{src,out});
+}
+//----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+// assignments
+//----------------------------------------------------------------------------------------------------------//
+#define FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(ASSIGN_TYPE)\
+template<typename Derived, size_t DIM, template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t OtherDIM,\
+    enable_if_t_<is_fused_gemm_expr_v<BinaryExpr<TLhs,TRhs,OtherDIM>>,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const BinaryExpr<TLhs,TRhs,OtherDIM> &src) {\
+    internal::_fused_gemm_assign<internal::gemm_assign ##ASSIGN_TYPE>(dst, src);\
+}\
+template<typename Derived, size_t DIM, template<typename,size_t> class UnaryExpr, typename Expr, size_t OtherDIM,\
+    enable_if_t_<is_fused_gemm_expr_v<UnaryExpr<Expr,OtherDIM>>,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const UnaryExpr<Expr,OtherDIM> &src) {\
+    internal::_fused_gemm_assign<internal::gemm_assign ##ASSIGN_TYPE>(dst, src);\
+}\
+
+FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(    )
+FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(_add)
+FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(_sub)
+FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(_mul)
+FASTOR_MAKE_FUSED_GEMM_ASSIGNMENT(_div)
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_MATMUL_EPILOGUE_H
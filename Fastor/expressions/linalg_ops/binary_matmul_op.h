@@ -5,6 +5,7 @@
 #include "Fastor/simd_vector/SIMDVector.h"
 #include "Fastor/backend/inner.h"
 #include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/matmul/matmul_epilogue.h"
 #include "Fastor/tensor/AbstractTensor.h"
 #include "Fastor/tensor/Aliasing.h"
 #include "Fastor/tensor/TensorTraits.h"
@@ -32,26 +33,43 @@ struct BinaryMatMulOp: public AbstractTensor<BinaryMatMulOp<TLhs, TRhs, DIM0>,DI
     // does not matter which one as matmul bypasses this
     using simd_vector_type = typename TLhs::simd_vector_type;
     using simd_abi_type = typename simd_vector_type::abi_type;
-    using result_type = conditional_t_<lhs_rank == 1,   // vector-matrix
+    // if any of the operands has runtime extents so does the result
+    static constexpr bool is_dynamic = has_dynamic_extent_v<TLhs> || has_dynamic_extent_v<TRhs>;
+    using result_type = conditional_t_<is_dynamic,
+                                        DynamicTensor<scalar_type, (lhs_rank == 1 || rhs_rank == 1) ? 1 : 2>,
+                                    conditional_t_<lhs_rank == 1,   // vector-matrix
                                         Tensor<scalar_type,N> ,
                                         conditional_t_<rhs_rank == 1, // matrix-vector
                                             Tensor<scalar_type,M>,
                                             Tensor<scalar_type,M,N>   // matrix-matrix
                                         >
+                                    >
                                     >;
 
     FASTOR_INLINE BinaryMatMulOp(lhs_expr_type inlhs, rhs_expr_type inrhs) : _lhs(inlhs), _rhs(inrhs) {
         static_assert(lhs_rank <=2 && rhs_rank <=2, "EXPRESSIONS FOR MATRIX MULTIPLICATION HAVE TO BE 2-DIMENSIONAL");
-        static_assert(K == K_other, "INVALID MATMUL OPERANDS. COLUMNS(A)!=ROWS(B)");
+        static_assert(is_dynamic || K == K_other, "INVALID MATMUL OPERANDS. COLUMNS(A)!=ROWS(B)");
     }
 
+    template<bool D = is_dynamic, enable_if_t_<!D,bool> = false>
     constexpr FASTOR_INLINE FASTOR_INDEX size() const {return M*N;}
+    template<bool D = is_dynamic, enable_if_t_<!D,bool> = false>
     constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {return i==0 ? M : N;}
 
+    template<bool D = is_dynamic, enable_if_t_<D,bool> = false>
+    FASTOR_INLINE FASTOR_INDEX size() const {return rows()*cols();}
+    template<bool D = is_dynamic, enable_if_t_<D,bool> = false>
+    FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {
+        return lhs_rank == 1 ? cols() : (i==0 ? rows() : cols());
+    }
+
     constexpr FASTOR_INLINE lhs_expr_type lhs() const {return _lhs;}
     constexpr FASTOR_INLINE rhs_expr_type rhs() const {return _rhs;}
 
 private:
+    FASTOR_INLINE FASTOR_INDEX rows() const {return lhs_rank == 1 ? 1 : _lhs.dimension(0);}
+    FASTOR_INLINE FASTOR_INDEX cols() const {return rhs_rank == 1 ? 1 : _rhs.dimension(1);}
+
     lhs_expr_type _lhs;
     rhs_expr_type _rhs;
 };
@@ -68,40 +86,30 @@ operator %(const AbstractTensor<TLhs,DIM0> &lhs, const AbstractTensor<TRhs,DIM1>
 
 // helper dispatcher functions
 namespace internal {
-// till streaming gemm is implemented
+// c = alpha*a*b + beta*c, c *= a*b and c /= a*b with the scaling applied to the
+// output tile of the matmul kernel before it is stored
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm(const T alpha, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const T beta, T * FASTOR_RESTRICT c) {
-
-    FASTOR_ARCH_ALIGN T tmp[M*N];
+    using V = choose_best_simd_t<SIMDVector<T,DEFAULT_ABI>,N>;
     if (beta == 0) {
-        // non-streaming
-        _matmul<T,M,K,N>(a,b,tmp);
-        for (size_t i = 0; i<M*N; ++i)
-            c[i] = alpha * tmp[i];
+        _gemm_epilogue<T,V,M,K,N>(a,b,gemm_epilogue_scale<T>{alpha,c});
     }
     else {
-        // streaming
-        _matmul<T,M,K,N>(a,b,tmp);
-        for (size_t i = 0; i<M*N; ++i)
-            c[i] = alpha * tmp[i] + beta*c[i];
+        _gemm_epilogue<T,V,M,K,N>(a,b,gemm_epilogue_axpby<T>{alpha,beta,c});
     }
 }
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm_mul(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT c) {
-    FASTOR_ARCH_ALIGN T tmp[M*N];
-    _matmul<T,M,K,N>(a,b,tmp);
-    for (size_t i = 0; i<M*N; ++i)
-        c[i] *= tmp[i];
+    using V = choose_best_simd_t<SIMDVector<T,DEFAULT_ABI>,N>;
+    _gemm_epilogue<T,V,M,K,N>(a,b,gemm_epilogue_mul<T>{c});
 }
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm_div(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT c) {
-    FASTOR_ARCH_ALIGN T tmp[M*N];
-    _matmul<T,M,K,N>(a,b,tmp);
-    for (size_t i = 0; i<M*N; ++i)
-        c[i] /= tmp[i];
+    using V = choose_best_simd_t<SIMDVector<T,DEFAULT_ABI>,N>;
+    _gemm_epilogue<T,V,M,K,N>(a,b,gemm_epilogue_div<T>{c});
 }
 
 
@@ -167,6 +175,70 @@ FASTOR_INLINE void matmul_dispatcher_div(const Tensor<T,J> &a, const Tensor<T,J,
     _gemm_div<T,1,J,K>(a.data(),b.data(),out.data());
 }
 
+
+
+// matmul - matvec overloads for operands or outputs with runtime extents
+template<typename TLhs, typename TRhs>
+FASTOR_INLINE void _dynamic_matmul_extents(const TLhs &a, const TRhs &b, FASTOR_INDEX &M, FASTOR_INDEX &K, FASTOR_INDEX &N) {
+    M = TLhs::result_type::dimension_t::value == 1 ? 1 : a.dimension(0);
+    K = TLhs::result_type::dimension_t::value == 1 ? a.dimension(0) : a.dimension(1);
+    N = TRhs::result_type::dimension_t::value == 1 ? 1 : b.dimension(1);
+    FASTOR_ASSERT(K==b.dimension(0), "INVALID MATMUL OPERANDS. COLUMNS(A)!=ROWS(B)");
+}
+template<typename T, int DIM>
+FASTOR_INLINE void _dynamic_matmul_resize(DynamicTensor<T,DIM> &out, FASTOR_INDEX M, FASTOR_INDEX N) {
+    std::array<FASTOR_INDEX,DIM> dims;
+    dims[0] = DIM == 1 ? M*N : M;
+    if (DIM == 2) dims[DIM-1] = N;
+    out.resize(dims);
+}
+template<typename TOut>
+FASTOR_INLINE void _dynamic_matmul_resize(TOut &out, FASTOR_INDEX M, FASTOR_INDEX N) {
+    FASTOR_ASSERT(out.size()==M*N, "TENSOR SIZE MISMATCH");
+}
+
+template<typename TLhs, typename TRhs, typename TOut,
+    enable_if_t_<has_dynamic_extent_v<TLhs> || has_dynamic_extent_v<TRhs> || has_dynamic_extent_v<TOut>,bool> = false>
+FASTOR_INLINE void matmul_dispatcher(const TLhs &a, const TRhs &b, TOut &out) {
+    using T = typename TOut::scalar_type;
+    FASTOR_INDEX M, K, N;
+    _dynamic_matmul_extents(a,b,M,K,N);
+    _dynamic_matmul_resize(out,M,N);
+    _dynamic_matmul<T>(M,K,N,a.data(),b.data(),out.data());
+}
+template<typename TLhs, typename TRhs, typename TOut,
+    enable_if_t_<has_dynamic_extent_v<TLhs> || has_dynamic_extent_v<TRhs> || has_dynamic_extent_v<TOut>,bool> = false>
+FASTOR_INLINE void matmul_dispatcher(const typename TOut::scalar_type alpha, const TLhs &a, const TRhs &b,
+    const typename TOut::scalar_type beta, TOut &out) {
+    using T = typename TOut::scalar_type;
+    FASTOR_INDEX M, K, N;
+    _dynamic_matmul_extents(a,b,M,K,N);
+    FASTOR_ASSERT(out.size()==M*N, "TENSOR SIZE MISMATCH");
+    _dynamic_gemm<T>(M,K,N,alpha,a.data(),b.data(),beta,out.data());
+}
+template<typename TLhs, typename TRhs, typename TOut,
+    enable_if_t_<has_dynamic_extent_v<TLhs> || has_dynamic_extent_v<TRhs> || has_dynamic_extent_v<TOut>,bool> = false>
+FASTOR_INLINE void matmul_dispatcher_mul(const TLhs &a, const TRhs &b, TOut &out) {
+    using T = typename TOut::scalar_type;
+    FASTOR_INDEX M, K, N;
+    _dynamic_matmul_extents(a,b,M,K,N);
+    FASTOR_ASSERT(out.size()==M*N, "TENSOR SIZE MISMATCH");
+    DynamicTensor<T,1> tmp(M*N);
+    _dynamic_matmul<T>(M,K,N,a.data(),b.data(),tmp.data());
+    out *= tmp;
+}
+template<typename TLhs, typename TRhs, typename TOut,
+    enable_if_t_<has_dynamic_extent_v<TLhs> || has_dynamic_extent_v<TRhs> || has_dynamic_extent_v<TOut>,bool> = false>
+FASTOR_INLINE void matmul_dispatcher_div(const TLhs &a, const TRhs &b, TOut &out) {
+    using T = typename TOut::scalar_type;
+    FASTOR_INDEX M, K, N;
+    _dynamic_matmul_extents(a,b,M,K,N);
+    FASTOR_ASSERT(out.size()==M*N, "TENSOR SIZE MISMATCH");
+    DynamicTensor<T,1> tmp(M*N);
+    _dynamic_matmul<T>(M,K,N,a.data(),b.data(),tmp.data());
+    out /= tmp;
+}
+
 } // internal
 
 
@@ -199,10 +271,32 @@ FASTOR_INLINE Tensor<T,K> matmul(const Tensor<T,J> &a, const Tensor<T,J,K> &b) {
 }
 
 
+// For tensors stored in T with the products accumulated in the wider type Acc, for instance
+// float tensors with double accumulators [matmul<double>(a,b)]. The result is stored in T
+template<typename Acc, typename T, size_t I, size_t J, size_t K, enable_if_t_<!is_same_v_<Acc,T>,bool> = false>
+FASTOR_INLINE Tensor<T,I,K> matmul(const Tensor<T,I,J> &a, const Tensor<T,J,K> &b) {
+    Tensor<T,I,K> out;
+    _matmul_mixed<T,Acc,I,J,K>(a.data(),b.data(),out.data());
+    return out;
+}
+template<typename Acc, typename T, size_t I, size_t J, enable_if_t_<!is_same_v_<Acc,T>,bool> = false>
+FASTOR_INLINE Tensor<T,I> matmul(const Tensor<T,I,J> &a, const Tensor<T,J> &b) {
+    Tensor<T,I> out;
+    _matmul_mixed<T,Acc,I,J,1>(a.data(),b.data(),out.data());
+    return out;
+}
+template<typename Acc, typename T, size_t J, size_t K, enable_if_t_<!is_same_v_<Acc,T>,bool> = false>
+FASTOR_INLINE Tensor<T,K> matmul(const Tensor<T,J> &a, const Tensor<T,J,K> &b) {
+    Tensor<T,K> out;
+    _matmul_mixed<T,Acc,1,J,K>(a.data(),b.data(),out.data());
+    return out;
+}
+
 // Generic matmul function for AbstractTensor types are provided here
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
     enable_if_t_<is_less_equal_v_<DIM0,2> && is_less_equal_v_<DIM1,2>
-    && !is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = 0 >
+    && !is_tensor_v<Derived0> && !is_tensor_v<Derived1>
+    && !has_dynamic_extent_v<Derived0> && !has_dynamic_extent_v<Derived1>,bool> = 0 >
 FASTOR_INLINE
 conditional_t_<Derived0::result_type::dimension_t::value == 1,
     Tensor<typename Derived0::scalar_type,
@@ -225,7 +319,8 @@ matmul(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM
 
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
     enable_if_t_<is_less_equal_v_<DIM0,2> && is_less_equal_v_<DIM1,2>
-    && !is_tensor_v<Derived0> && is_tensor_v<Derived1>,bool> = 0 >
+    && !is_tensor_v<Derived0> && is_tensor_v<Derived1>
+    && !has_dynamic_extent_v<Derived0>,bool> = 0 >
 FASTOR_INLINE
 conditional_t_<Derived0::result_type::dimension_t::value == 1,
     Tensor<typename Derived0::scalar_type,
@@ -246,7 +341,8 @@ matmul(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM
 
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
     enable_if_t_<is_less_equal_v_<DIM0,2> && is_less_equal_v_<DIM1,2>
-    && is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = 0 >
+    && is_tensor_v<Derived0> && !is_tensor_v<Derived1>
+    && !has_dynamic_extent_v<Derived1>,bool> = 0 >
 FASTOR_INLINE
 conditional_t_<Derived0::result_type::dimension_t::value == 1,
     Tensor<typename Derived0::scalar_type,
@@ -265,6 +361,17 @@ matmul(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM
     return matmul(a.self(),tmp_b);
 }
 
+// If any of the operands has runtime extents the result is a DynamicTensor
+template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
+    enable_if_t_<is_less_equal_v_<DIM0,2> && is_less_equal_v_<DIM1,2>
+    && (has_dynamic_extent_v<Derived0> || has_dynamic_extent_v<Derived1>),bool> = 0 >
+FASTOR_INLINE
+typename BinaryMatMulOp<Derived0,Derived1,meta_min<DIM0,DIM1>::value>::result_type
+matmul(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
+    using result_type = typename BinaryMatMulOp<Derived0,Derived1,meta_min<DIM0,DIM1>::value>::result_type;
+    return result_type(a.self() % b.self());
+}
+
 
 
 // triangular matmul functions
@@ -338,15 +445,17 @@ tmatmul(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DI
 
 // assignments
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
 FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     // dst = matmul(src.lhs().self(),src.rhs().self()); // this makes a copy for dst, compiler emits a memcpy
     internal::matmul_dispatcher(src.lhs().self(),src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     lhs_t a(src.lhs().self());
@@ -354,8 +463,10 @@ FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp
     internal::matmul_dispatcher(a,src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
     rhs_t b(src.rhs().self());
@@ -363,8 +474,10 @@ FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp
     internal::matmul_dispatcher(src.lhs().self(),b,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
@@ -378,15 +491,17 @@ FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp
 
 // assignments add
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
 FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     internal::matmul_dispatcher((T)1,src.lhs().self(),src.rhs().self(),(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
@@ -394,8 +509,10 @@ FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
     internal::matmul_dispatcher((T)1,a,src.rhs().self(),(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
@@ -403,8 +520,10 @@ FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
     internal::matmul_dispatcher((T)1,src.lhs().self(),b,(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
@@ -417,15 +536,17 @@ FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
 
 // assignments sub
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
 FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     internal::matmul_dispatcher((T)-1,src.lhs().self(),src.rhs().self(),(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
@@ -433,8 +554,10 @@ FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
     internal::matmul_dispatcher((T)-1,a,src.rhs().self(),(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
@@ -442,8 +565,10 @@ FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
     internal::matmul_dispatcher((T)-1,src.lhs().self(),b,(T)1,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using T = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::scalar_type;
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
@@ -456,30 +581,36 @@ FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
 
 // assignments mul
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
 FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     internal::matmul_dispatcher_mul(src.lhs().self(),src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     lhs_t a(src.lhs().self());
     internal::matmul_dispatcher_mul(a,src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
     rhs_t b(src.rhs().self());
     internal::matmul_dispatcher_mul(src.lhs().self(),b,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
@@ -491,30 +622,36 @@ FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
 
 // assignments div
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
 FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     internal::matmul_dispatcher_div(src.lhs().self(),src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     lhs_t a(src.lhs().self());
     internal::matmul_dispatcher_div(a,src.rhs().self(),dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
     rhs_t b(src.rhs().self());
     internal::matmul_dispatcher_div(src.lhs().self(),b,dst.self());
 }
 template<typename Derived, size_t DIM, typename TLhs, typename TRhs, size_t OtherDIM,
-    typename std::enable_if<!is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
-                            !is_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>>, bool >::type = false>
+    typename std::enable_if<!is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_expr_type>> &&
+                            !is_evaluated_tensor_v<remove_all_t<typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_expr_type>> &&
+                            !has_common_subexpression<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value &&
+                            !is_binary_matmul_chain<BinaryMatMulOp<TLhs, TRhs, OtherDIM>>::value, bool >::type = false>
 FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<TLhs, TRhs, OtherDIM> &src) {
     using lhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::lhs_type;
     using rhs_t = typename BinaryMatMulOp<TLhs, TRhs, OtherDIM>::rhs_type;
@@ -524,103 +661,6 @@ FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatM
 }
 
 
-
-
-
-
-
-// recursive greedy-like
-template<typename Derived, size_t DIM, typename TLhs, typename TRhs0, typename TRhs1, size_t OtherDIM>
-FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<BinaryMatMulOp<TLhs, TRhs0, OtherDIM>, TRhs1, OtherDIM> &src) {
-    FASTOR_IF_CONSTEXPR(BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::flop_count > BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::flop_count)
-    {
-        using result_t = typename BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>(src.lhs().rhs().self(),src.rhs().self()));
-        assign(dst, BinaryMatMulOp<TLhs, result_t, OtherDIM>(src.lhs().lhs().self(),tmp));
-    }
-    else
-    {
-        using result_t = typename BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TLhs, TRhs0, OtherDIM>(src.lhs().lhs().self(),src.lhs().rhs().self()));
-        assign(dst, BinaryMatMulOp<result_t, TRhs1, OtherDIM>(tmp,src.rhs().self()));
-    }
-}
-
-template<typename Derived, size_t DIM, typename TLhs, typename TRhs0, typename TRhs1, size_t OtherDIM>
-FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<BinaryMatMulOp<TLhs, TRhs0, OtherDIM>, TRhs1, OtherDIM> &src) {
-    FASTOR_IF_CONSTEXPR(BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::flop_count > BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::flop_count)
-    {
-        using result_t = typename BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>(src.lhs().rhs().self(),src.rhs().self()));
-        assign_add(dst, BinaryMatMulOp<TLhs, result_t, OtherDIM>(src.lhs().lhs().self(),tmp));
-    }
-    else
-    {
-        using result_t = typename BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TLhs, TRhs0, OtherDIM>(src.lhs().lhs().self(),src.lhs().rhs().self()));
-        assign_add(dst, BinaryMatMulOp<result_t, TRhs1, OtherDIM>(tmp,src.rhs().self()));
-    }
-}
-
-template<typename Derived, size_t DIM, typename TLhs, typename TRhs0, typename TRhs1, size_t OtherDIM>
-FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<BinaryMatMulOp<TLhs, TRhs0, OtherDIM>, TRhs1, OtherDIM> &src) {
-    FASTOR_IF_CONSTEXPR(BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::flop_count > BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::flop_count)
-    {
-        using result_t = typename BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>(src.lhs().rhs().self(),src.rhs().self()));
-        assign_sub(dst, BinaryMatMulOp<TLhs, result_t, OtherDIM>(src.lhs().lhs().self(),tmp));
-    }
-    else
-    {
-        using result_t = typename BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TLhs, TRhs0, OtherDIM>(src.lhs().lhs().self(),src.lhs().rhs().self()));
-        assign_sub(dst, BinaryMatMulOp<result_t, TRhs1, OtherDIM>(tmp,src.rhs().self()));
-    }
-}
-
-template<typename Derived, size_t DIM, typename TLhs, typename TRhs0, typename TRhs1, size_t OtherDIM>
-FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<BinaryMatMulOp<TLhs, TRhs0, OtherDIM>, TRhs1, OtherDIM> &src) {
-    FASTOR_IF_CONSTEXPR(BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::flop_count > BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::flop_count)
-    {
-        using result_t = typename BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>(src.lhs().rhs().self(),src.rhs().self()));
-        assign_mul(dst, BinaryMatMulOp<TLhs, result_t, OtherDIM>(src.lhs().lhs().self(),tmp));
-    }
-    else
-    {
-        using result_t = typename BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TLhs, TRhs0, OtherDIM>(src.lhs().lhs().self(),src.lhs().rhs().self()));
-        assign_mul(dst, BinaryMatMulOp<result_t, TRhs1, OtherDIM>(tmp,src.rhs().self()));
-    }
-}
-
-template<typename Derived, size_t DIM, typename TLhs, typename TRhs0, typename TRhs1, size_t OtherDIM>
-FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const BinaryMatMulOp<BinaryMatMulOp<TLhs, TRhs0, OtherDIM>, TRhs1, OtherDIM> &src) {
-    FASTOR_IF_CONSTEXPR(BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::flop_count > BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::flop_count)
-    {
-        using result_t = typename BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TRhs0, TRhs1, OtherDIM>(src.lhs().rhs().self(),src.rhs().self()));
-        assign_div(dst, BinaryMatMulOp<TLhs, result_t, OtherDIM>(src.lhs().lhs().self(),tmp));
-    }
-    else
-    {
-        using result_t = typename BinaryMatMulOp<TLhs, TRhs0, OtherDIM>::result_type;
-        result_t tmp;
-        assign(tmp, BinaryMatMulOp<TLhs, TRhs0, OtherDIM>(src.lhs().lhs().self(),src.lhs().rhs().self()));
-        assign_div(dst, BinaryMatMulOp<result_t, TRhs1, OtherDIM>(tmp,src.rhs().self()));
-    }
-}
-
-
 } // end of namespace Fastor
 
 
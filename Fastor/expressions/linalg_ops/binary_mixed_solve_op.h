@@ -0,0 +1,124 @@
+#ifndef BINARY_MIXED_SOLVE_OP_H
+#define BINARY_MIXED_SOLVE_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include "Fastor/expressions/linalg_ops/unary_lu_op.h"
+#include "Fastor/expressions/linalg_ops/unary_chol_op.h"
+#include "Fastor/expressions/linalg_ops/unary_norm_op.h"
+
+#include <limits>
+#include <cmath>
+
+
+namespace Fastor {
+
+// Solving linear system of equations in mixed precision
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+// Views the operands in double precision without copying them if they already are
+template<size_t ... Rest>
+FASTOR_INLINE const Tensor<double,Rest...>& to_double(const Tensor<double,Rest...> &a) {
+    return a;
+}
+template<typename T, size_t ... Rest, enable_if_t_<!is_same_v_<T,double>,bool> = false>
+FASTOR_INLINE Tensor<double,Rest...> to_double(const Tensor<T,Rest...> &a) {
+    return a.template cast<double>();
+}
+
+/* Iterative refinement of the solution of A X = B. solve_single solves with the factors of A in
+    single precision, the residual B - A X is computed and the solution is updated in double until
+    the residual is as small as that of a backward stable solve in double. Returns false if the
+    residual stops decreasing, that is if A is too ill-conditioned for its factors in single
+    precision to be of any use
+*/
+template<typename T, size_t M, size_t ... Rest, typename SolveSingle>
+FASTOR_INLINE bool mixed_refine(const Tensor<T,M,M> &A, const Tensor<T,M,Rest...> &B, SolveSingle &&solve_single, Tensor<double,M,Rest...> &X) {
+
+    const auto &Ad = to_double(A);
+    const auto &Bd = to_double(B);
+
+    X = solve_single(B.template cast<float>()).template cast<double>();
+
+    const double tol = std::sqrt(double(M))*std::numeric_limits<double>::epsilon()*norm(Ad);
+    double prev_residual = std::numeric_limits<double>::infinity();
+    for (size_t iter=0; iter<FASTOR_MIXED_SOLVE_MAX_ITERATIONS; ++iter) {
+        Tensor<double,M,Rest...> R = Bd - matmul(Ad,X);
+
+        const double residual = norm(R);
+        if (residual <= tol*norm(X)) return true;
+        // also catches NaNs from a failed factorisation
+        if (!(residual < prev_residual)) return false;
+        prev_residual = residual;
+
+        X += solve_single(R.template cast<float>()).template cast<double>();
+    }
+    return false;
+}
+
+template<typename T, size_t M, size_t ... Rest>
+FASTOR_INLINE Tensor<T,M,Rest...> mixed_lu_solve(const Tensor<T,M,M> &A, const Tensor<T,M,Rest...> &B) {
+    Tensor<float,M,M> L, U;
+    Tensor<size_t,M> p;
+    lu<LUCompType::BlockLUPiv>(A.template cast<float>(), L, U, p);
+
+    Tensor<double,M,Rest...> X;
+    if (!mixed_refine(A, B, [&](const Tensor<float,M,Rest...> &R) { return get_lu_solve(L, U, p, R); }, X)) {
+        return solve<SolveCompType::BlockLUPiv>(to_double(A), to_double(B)).template cast<T>();
+    }
+    return X.template cast<T>();
+}
+
+template<typename T, size_t M, size_t ... Rest>
+FASTOR_INLINE Tensor<T,M,Rest...> mixed_chol_solve(const Tensor<T,M,M> &A, const Tensor<T,M,Rest...> &B) {
+    Tensor<float,M,M> L;
+    cholesky(A.template cast<float>(), L);
+
+    Tensor<double,M,Rest...> X;
+    if (!mixed_refine(A, B, [&](const Tensor<float,M,Rest...> &R) { return get_chol_solve(L, R); }, X)) {
+        return solve<SolveCompType::Chol>(to_double(A), to_double(B)).template cast<T>();
+    }
+    return X.template cast<T>();
+}
+
+} // internal
+
+
+/* The factorisation is done in single precision, at roughly the speed and half the memory
+    traffic of a single precision solve, and the solution is refined to double precision.
+    Matrices that are too ill-conditioned for single precision are solved in double instead
+*/
+// Single RHS
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M,
+    enable_if_t_< SType == SolveCompType::MixedLU, bool> = false>
+FASTOR_INLINE Tensor<T,M> solve(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    return internal::mixed_lu_solve(A, b);
+}
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M,
+    enable_if_t_< SType == SolveCompType::MixedChol, bool> = false>
+FASTOR_INLINE Tensor<T,M> solve(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    return internal::mixed_chol_solve(A, b);
+}
+
+// Multiple RHS
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M, size_t N,
+    enable_if_t_< SType == SolveCompType::MixedLU, bool> = false>
+FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    return internal::mixed_lu_solve(A, B);
+}
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M, size_t N,
+    enable_if_t_< SType == SolveCompType::MixedChol, bool> = false>
+FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    return internal::mixed_chol_solve(A, B);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_MIXED_SOLVE_OP_H
@@ -34,6 +34,7 @@ enum class DetCompType : int
     Simple = 0,   /* Using simple hand-optimised calculations    */
     LU,           /* Using LU factorisation                      */
     QR,           /* Using QR factorisation                      */
+    Chol,         /* Using Cholesky factorisation                */
 };
 
 // Inverse computation type
@@ -45,6 +46,7 @@ enum class InvCompType : int
     BlockLUPiv,   /* Using block LU factorisation with pivot     */
     SimpleLU,     /* Using simple LU factorisation               */
     SimpleLUPiv,  /* Using simple LU factorisation with pivot    */
+    Chol,         /* Using Cholesky factorisation                */
 };
 
 // Solve computation type
@@ -58,6 +60,10 @@ enum class SolveCompType : int
     SimpleLUPiv,   /* Using simple LU factorisation with pivot     */
     QR,            /* Using QR factorisation                       */
     Chol,          /* Using Cholesky factorisation                 */
+    MixedLU,       /* Using block LU factorisation with pivot in
+                      single precision and refinement in double    */
+    MixedChol,     /* Using Cholesky factorisation in single
+                      precision and refinement in double           */
 };
 
 
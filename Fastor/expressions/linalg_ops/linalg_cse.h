@@ -0,0 +1,235 @@
+#ifndef LINALG_CSE_H
+#define LINALG_CSE_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/binary_ops/binary_arithmetic_ops.h"
+#include "Fastor/expressions/unary_ops/unary_math_ops.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
+
+#include <array>
+#include <tuple>
+
+// Common subexpression elimination for expressions with linear algebra nodes
+//
+// Expressions such as C = inv(F) % A + A % inv(F) or D = trans(F) % F - trans(F)
+// evaluate every matmul and unary linalg node in to its own temporary, so a
+// node that is spelled more than once is also computed more than once. Here
+// the distinct repeated nodes of the expression are collected at compile time
+// in to a cache of stack temporaries. At runtime every occurrence is keyed by
+// the addresses of the tensors and the values of the scalars it refers to,
+// evaluated on its first occurrence and read back on the others. The
+// expression is then rebuilt on top of the temporaries and assigned as usual.
+// has_common_subexpression [linalg_traits.h] decides which expressions qualify
+
+namespace Fastor {
+
+namespace internal {
+
+// Distinct repeated nodes of an expression in evaluation order
+//----------------------------------------------------------------------------------------------------------//
+template<typename ... Nodes>
+struct cse_node_list {};
+
+template<typename Node, typename ... Nodes>
+struct cse_is_listed {
+    static constexpr bool value = false;
+};
+template<typename Node, typename First, typename ... Rest>
+struct cse_is_listed<Node,First,Rest...> {
+    static constexpr bool value = is_same_v_<Node,First> || cse_is_listed<Node,Rest...>::value;
+};
+
+template<typename List, typename Node>
+struct cse_node_list_add;
+template<typename ... Nodes, typename Node>
+struct cse_node_list_add<cse_node_list<Nodes...>,Node> {
+    using type = conditional_t_<cse_is_listed<Node,Nodes...>::value, cse_node_list<Nodes...>, cse_node_list<Nodes...,Node>>;
+};
+
+/* Operands are collected before the node itself so that a repeated node
+    is evaluated on top of the temporaries of its own repeated operands
+*/
+template<typename Expr, typename Root, typename List, typename Enable = void>
+struct cse_collect {
+    using type = List;
+};
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM, typename Root, typename List>
+struct cse_collect<UnaryExpr<Expr,DIM>,Root,List,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    using expr_list = typename cse_collect<Expr,Root,List>::type;
+    using type = conditional_t_<is_cse_repeated<UnaryExpr<Expr,DIM>,Root>::value,
+        typename cse_node_list_add<expr_list,UnaryExpr<Expr,DIM>>::type, expr_list>;
+};
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM, typename Root, typename List>
+struct cse_collect<BinaryExpr<TLhs,TRhs,DIM>,Root,List,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    using lhs_list = typename cse_collect<TLhs,Root,List>::type;
+    using rhs_list = typename cse_collect<TRhs,Root,lhs_list>::type;
+    using type = conditional_t_<is_cse_repeated<BinaryExpr<TLhs,TRhs,DIM>,Root>::value,
+        typename cse_node_list_add<rhs_list,BinaryExpr<TLhs,TRhs,DIM>>::type, rhs_list>;
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Runtime identity of a node
+//----------------------------------------------------------------------------------------------------------//
+/* Keys are built from the leaves and not from the address of the node
+    itself as the accessors of the expressions return their operands by value
+*/
+template<typename Expr, typename Enable = void>
+struct cse_key {
+    template<typename E = Expr, enable_if_t_<is_arithmetic_v_<E>,bool> = false>
+    static FASTOR_INLINE std::tuple<E> get(const E &num) {
+        return std::tuple<E>(num);
+    }
+    template<typename E = Expr, enable_if_t_<!is_arithmetic_v_<E>,bool> = false>
+    static FASTOR_INLINE std::tuple<const void*> get(const E &expr) {
+        return std::tuple<const void*>(static_cast<const void*>(&expr));
+    }
+};
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct cse_key<UnaryExpr<Expr,DIM>,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    static FASTOR_INLINE auto get(const UnaryExpr<Expr,DIM> &expr) -> decltype(cse_key<Expr>::get(expr.expr())) {
+        return cse_key<Expr>::get(expr.expr());
+    }
+};
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM>
+struct cse_key<BinaryExpr<TLhs,TRhs,DIM>,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    static FASTOR_INLINE auto get(const BinaryExpr<TLhs,TRhs,DIM> &expr)
+        -> decltype(std::tuple_cat(cse_key<TLhs>::get(expr.lhs()),cse_key<TRhs>::get(expr.rhs()))) {
+        return std::tuple_cat(cse_key<TLhs>::get(expr.lhs()),cse_key<TRhs>::get(expr.rhs()));
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Cache of temporaries
+//----------------------------------------------------------------------------------------------------------//
+/* A node that occurs Count times in the expression can refer to at most
+    Count different operands at runtime
+*/
+template<typename Node, size_t Count>
+struct cse_slot {
+    using result_type = typename Node::result_type;
+    using key_type = decltype(cse_key<Node>::get(std::declval<const Node&>()));
+    std::array<result_type,Count> values;
+    std::array<key_type,Count> keys;
+    size_t filled = 0;
+};
+
+template<typename Root, typename List = typename cse_collect<Root,Root,cse_node_list<>>::type>
+struct cse_cache;
+template<typename Root, typename ... Nodes>
+struct cse_cache<Root,cse_node_list<Nodes...>> {
+    template<typename Node>
+    using slot_type = cse_slot<Node,cse_count<Node,Root>::value>;
+
+    std::tuple<slot_type<Nodes>...> slots;
+
+    template<typename Node>
+    FASTOR_INLINE slot_type<Node>& get() {
+        return std::get<slot_type<Node>>(slots);
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Rebuilding the expression on top of the temporaries
+//----------------------------------------------------------------------------------------------------------//
+template<typename Rewriter, typename Node, typename Cache>
+FASTOR_INLINE const typename Node::result_type& cse_evaluate(const Node &expr, Cache &cache) {
+    auto &slot = cache.template get<Node>();
+    const auto key = cse_key<Node>::get(expr);
+    for (size_t i=0; i<slot.filled; ++i) {
+        if (slot.keys[i] == key) return slot.values[i];
+    }
+    const size_t n = slot.filled++;
+    slot.keys[n] = key;
+    assign(slot.values[n], Rewriter::rebuild(expr,cache));
+    return slot.values[n];
+}
+
+// Leaves are kept as they are
+template<typename Expr, typename Root, typename Enable = void>
+struct cse_rewriter {
+    using type = Expr;
+    template<typename Cache>
+    static FASTOR_INLINE expression_t<Expr> rewrite(const Expr &expr, Cache &) {
+        return expr;
+    }
+};
+
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM, typename Root>
+struct cse_rewriter<UnaryExpr<Expr,DIM>,Root,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    using expr_type = UnaryExpr<Expr,DIM>;
+    using expr_rewriter = cse_rewriter<Expr,Root>;
+    using rebuilt_type = UnaryExpr<typename expr_rewriter::type,DIM>;
+    static constexpr bool is_repeated = is_cse_repeated<expr_type,Root>::value;
+    using type = conditional_t_<is_repeated, typename expr_type::result_type, rebuilt_type>;
+
+    template<typename Cache>
+    static FASTOR_INLINE rebuilt_type rebuild(const expr_type &expr, Cache &cache) {
+        return rebuilt_type(expr_rewriter::rewrite(expr.expr(),cache));
+    }
+    template<typename Cache, bool R = is_repeated, enable_if_t_<!R,bool> = false>
+    static FASTOR_INLINE rebuilt_type rewrite(const expr_type &expr, Cache &cache) {
+        return rebuild(expr,cache);
+    }
+    template<typename Cache, bool R = is_repeated, enable_if_t_<R,bool> = false>
+    static FASTOR_INLINE const type& rewrite(const expr_type &expr, Cache &cache) {
+        return cse_evaluate<cse_rewriter>(expr,cache);
+    }
+};
+
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM, typename Root>
+struct cse_rewriter<BinaryExpr<TLhs,TRhs,DIM>,Root,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    using expr_type = BinaryExpr<TLhs,TRhs,DIM>;
+    using lhs_rewriter = cse_rewriter<TLhs,Root>;
+    using rhs_rewriter = cse_rewriter<TRhs,Root>;
+    using rebuilt_type = BinaryExpr<typename lhs_rewriter::type,typename rhs_rewriter::type,DIM>;
+    static constexpr bool is_repeated = is_cse_repeated<expr_type,Root>::value;
+    using type = conditional_t_<is_repeated, typename expr_type::result_type, rebuilt_type>;
+
+    template<typename Cache>
+    static FASTOR_INLINE rebuilt_type rebuild(const expr_type &expr, Cache &cache) {
+        return rebuilt_type(lhs_rewriter::rewrite(expr.lhs(),cache),rhs_rewriter::rewrite(expr.rhs(),cache));
+    }
+    template<typename Cache, bool R = is_repeated, enable_if_t_<!R,bool> = false>
+    static FASTOR_INLINE rebuilt_type rewrite(const expr_type &expr, Cache &cache) {
+        return rebuild(expr,cache);
+    }
+    template<typename Cache, bool R = is_repeated, enable_if_t_<R,bool> = false>
+    static FASTOR_INLINE const type& rewrite(const expr_type &expr, Cache &cache) {
+        return cse_evaluate<cse_rewriter>(expr,cache);
+    }
+};
+//----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+// assignments
+//----------------------------------------------------------------------------------------------------------//
+/* The rebuilt expression has strictly fewer costly nodes than the original
+    one so the assignment below does not come back here
+*/
+#define FASTOR_MAKE_CSE_ASSIGNMENT(ASSIGN_TYPE)\
+template<typename Derived, size_t DIM, template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t OtherDIM,\
+    enable_if_t_<has_common_subexpression_v<BinaryExpr<TLhs,TRhs,OtherDIM>>,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const BinaryExpr<TLhs,TRhs,OtherDIM> &src) {\
+    using expr_type = BinaryExpr<TLhs,TRhs,OtherDIM>;\
+    internal::cse_cache<expr_type> cache;\
+    assign ##ASSIGN_TYPE (dst.self(), internal::cse_rewriter<expr_type,expr_type>::rebuild(src,cache));\
+}\
+
+FASTOR_MAKE_CSE_ASSIGNMENT(    )
+FASTOR_MAKE_CSE_ASSIGNMENT(_add)
+FASTOR_MAKE_CSE_ASSIGNMENT(_sub)
+FASTOR_MAKE_CSE_ASSIGNMENT(_mul)
+FASTOR_MAKE_CSE_ASSIGNMENT(_div)
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // LINALG_CSE_H
@@ -6,7 +6,9 @@
 #include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
 #include "Fastor/expressions/linalg_ops/unary_piv_op.h"
 #include "Fastor/expressions/linalg_ops/unary_lu_op.h"
+#include "Fastor/expressions/linalg_ops/unary_chol_op.h"
 #include "Fastor/expressions/linalg_ops/binary_solve_op.h"
+#include "Fastor/expressions/linalg_ops/binary_mixed_solve_op.h"
 #include "Fastor/expressions/linalg_ops/unary_trans_op.h"
 #include "Fastor/expressions/linalg_ops/unary_ctrans_op.h"
 #include "Fastor/expressions/linalg_ops/unary_adj_op.h"
@@ -15,6 +17,8 @@
 #include "Fastor/expressions/linalg_ops/unary_trace_op.h"
 #include "Fastor/expressions/linalg_ops/unary_norm_op.h"
 #include "Fastor/expressions/linalg_ops/unary_qr_op.h"
+#include "Fastor/expressions/linalg_ops/unary_eigh_op.h"
+#include "Fastor/expressions/linalg_ops/unary_svd_op.h"
 #include "Fastor/expressions/linalg_ops/unary_det_op.h"
 #include "Fastor/expressions/linalg_ops/binary_cross_op.h"
 
@@ -10,6 +10,7 @@
 #include "Fastor/expressions/linalg_ops/unary_inv_op.h"
 #include "Fastor/expressions/linalg_ops/binary_solve_op.h"
 #include <type_traits>
+#include <tuple>
 
 
 namespace Fastor {
@@ -266,6 +267,201 @@ static constexpr bool requires_evaluation_v = requires_evaluation<Derived>::valu
 //----------------------------------------------------------------------------------------------------------//
 
 
+// Is a matrix-matrix product followed by elementwise operations that can be
+// applied to the output tile of the matmul kernel [binary_matmul_epilogue.h]
+//----------------------------------------------------------------------------------------------------------//
+// Scalars and elementwise expressions that can be evaluated at any index
+template<typename Derived>
+struct is_gemm_epilogue_operand {
+    static constexpr bool value = !requires_evaluation<Derived>::value && !has_dynamic_extent_v<Derived> &&
+                                  !is_boolean_expression<Derived>::value;
+};
+
+template<typename Derived>
+struct is_gemm_epilogue_expr {
+    static constexpr bool value = false;
+};
+// Matrix-matrix products of static float and double matrices. Chains of
+// products are left to the greedy ordering of BinaryMatMulOp
+template<typename TLhs, typename TRhs, size_t DIM>
+struct is_gemm_epilogue_expr<BinaryMatMulOp<TLhs,TRhs,DIM>> {
+    using expr_type = BinaryMatMulOp<TLhs,TRhs,DIM>;
+    using scalar_type = typename expr_type::scalar_type;
+    static constexpr bool value = expr_type::lhs_rank == 2 && expr_type::rhs_rank == 2 && !expr_type::is_dynamic &&
+                                  (is_same_v_<scalar_type,float> || is_same_v_<scalar_type,double>) &&
+                                  !has_binary_matmul_op<TLhs>::value && !has_binary_matmul_op<TRhs>::value;
+};
+#define FASTOR_MAKE_IS_GEMM_EPILOGUE_EXPR(NAME)\
+template<typename TLhs, typename TRhs, size_t DIM>\
+struct is_gemm_epilogue_expr<Binary ##NAME ## Op<TLhs,TRhs,DIM>> {\
+    static constexpr bool value = (is_gemm_epilogue_expr<TLhs>::value && is_gemm_epilogue_operand<TRhs>::value) ||\
+                                  (is_gemm_epilogue_operand<TLhs>::value && is_gemm_epilogue_expr<TRhs>::value);\
+};\
+
+FASTOR_MAKE_IS_GEMM_EPILOGUE_EXPR(Add)
+FASTOR_MAKE_IS_GEMM_EPILOGUE_EXPR(Sub)
+FASTOR_MAKE_IS_GEMM_EPILOGUE_EXPR(Mul)
+FASTOR_MAKE_IS_GEMM_EPILOGUE_EXPR(Div)
+
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct is_gemm_epilogue_expr<UnaryExpr<Expr,DIM>> {
+    static constexpr bool value = is_unary_math_op<UnaryExpr<Expr,DIM>>::value && is_gemm_epilogue_expr<Expr>::value;
+};
+
+// Expressions that are assigned through the fused kernel. Plain products
+// keep their own assignment
+template<typename Derived>
+struct is_fused_gemm_expr {
+    static constexpr bool value = is_gemm_epilogue_expr<Derived>::value && !is_binary_matmul_op<Derived>::value &&
+                                  !has_common_subexpression<Derived>::value;
+};
+
+// helper
+template<typename Derived>
+static constexpr bool is_fused_gemm_expr_v = is_fused_gemm_expr<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Common subexpressions [linalg_cse.h]
+//----------------------------------------------------------------------------------------------------------//
+// Nodes the elimination pass walks through and rebuilds. Everything else,
+// including views, is treated as an opaque leaf
+template<typename Derived>
+struct is_cse_unary_node {
+    static constexpr bool value = is_unary_math_op<Derived>::value || is_unary_trans_op<Derived>::value ||
+                                  is_unary_ctrans_op<Derived>::value || is_unary_adj_op<Derived>::value  ||
+                                  is_unary_cof_op<Derived>::value    || is_unary_inv_op<Derived>::value;
+};
+
+template<typename Derived>
+struct is_cse_binary_node {
+    static constexpr bool value = false;
+};
+#define FASTOR_MAKE_IS_CSE_BINARY_NODE(NAME)\
+template<typename TLhs, typename TRhs, size_t DIM>\
+struct is_cse_binary_node<Binary ##NAME ## Op<TLhs,TRhs,DIM>> {\
+    static constexpr bool value = true;\
+};\
+
+FASTOR_MAKE_IS_CSE_BINARY_NODE(Add)
+FASTOR_MAKE_IS_CSE_BINARY_NODE(Sub)
+FASTOR_MAKE_IS_CSE_BINARY_NODE(Mul)
+FASTOR_MAKE_IS_CSE_BINARY_NODE(Div)
+FASTOR_MAKE_IS_CSE_BINARY_NODE(MatMul)
+
+// Two occurrences of a node can only be compared at runtime if all of its
+// leaves are scalars or are bound by reference
+template<typename Derived, typename Enable = void>
+struct is_cse_keyable {
+    static constexpr bool value = is_arithmetic_v_<Derived> || std::is_reference<expression_t<Derived>>::value;
+};
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct is_cse_keyable<UnaryExpr<Expr,DIM>,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    static constexpr bool value = is_cse_keyable<Expr>::value;
+};
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM>
+struct is_cse_keyable<BinaryExpr<TLhs,TRhs,DIM>,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    static constexpr bool value = is_cse_keyable<TLhs>::value && is_cse_keyable<TRhs>::value;
+};
+
+// Nodes that are evaluated in to a temporary anyway and are hence worth
+// evaluating only once
+template<typename Derived>
+struct is_cse_candidate {
+    static constexpr bool value = (is_binary_matmul_op<Derived>::value || (is_cse_unary_node<Derived>::value &&
+                                  !is_unary_math_op<Derived>::value)) && is_cse_keyable<Derived>::value;
+};
+
+// Number of occurrences of Node in Expr
+template<typename Node, typename Expr, typename Enable = void>
+struct cse_count {
+    static constexpr size_t value = is_same_v_<Node,Expr>;
+};
+template<typename Node, template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct cse_count<Node,UnaryExpr<Expr,DIM>,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    static constexpr size_t value = is_same_v_<Node,UnaryExpr<Expr,DIM>> + cse_count<Node,Expr>::value;
+};
+template<typename Node, template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM>
+struct cse_count<Node,BinaryExpr<TLhs,TRhs,DIM>,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    static constexpr size_t value = is_same_v_<Node,BinaryExpr<TLhs,TRhs,DIM>> + cse_count<Node,TLhs>::value + cse_count<Node,TRhs>::value;
+};
+
+// Is a candidate that occurs more than once in Root
+template<typename Node, typename Root>
+struct is_cse_repeated {
+    static constexpr bool value = is_cse_candidate<Node>::value && (cse_count<Node,Root>::value > 1);
+};
+
+template<typename Expr, typename Root, typename Enable = void>
+struct has_cse_repeated {
+    static constexpr bool value = false;
+};
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM, typename Root>
+struct has_cse_repeated<UnaryExpr<Expr,DIM>,Root,enable_if_t_<is_cse_unary_node<UnaryExpr<Expr,DIM>>::value>> {
+    static constexpr bool value = is_cse_repeated<UnaryExpr<Expr,DIM>,Root>::value || has_cse_repeated<Expr,Root>::value;
+};
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIM, typename Root>
+struct has_cse_repeated<BinaryExpr<TLhs,TRhs,DIM>,Root,enable_if_t_<is_cse_binary_node<BinaryExpr<TLhs,TRhs,DIM>>::value>> {
+    static constexpr bool value = is_cse_repeated<BinaryExpr<TLhs,TRhs,DIM>,Root>::value ||
+                                  has_cse_repeated<TLhs,Root>::value || has_cse_repeated<TRhs,Root>::value;
+};
+
+// An expression in which a costly node occurs more than once. These are
+// assigned through the elimination pass
+template<typename Derived>
+struct has_common_subexpression {
+    static constexpr bool value = has_cse_repeated<Derived,Derived>::value;
+};
+
+// helper
+template<typename Derived>
+static constexpr bool has_common_subexpression_v = has_common_subexpression<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Chains of matrix products [binary_matmul_chain.h]
+//----------------------------------------------------------------------------------------------------------//
+template<typename Factors0, typename Factors1>
+struct matmul_chain_concat;
+template<typename ... Factors0, typename ... Factors1>
+struct matmul_chain_concat<std::tuple<Factors0...>,std::tuple<Factors1...>> {
+    using type = std::tuple<Factors0...,Factors1...>;
+};
+
+// Factors of nested products from left to right. Any other expression is a
+// single factor
+template<typename Derived>
+struct matmul_chain_factors {
+    using type = std::tuple<Derived>;
+};
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_chain_factors<BinaryMatMulOp<TLhs,TRhs,DIM>> {
+    using type = typename matmul_chain_concat<typename matmul_chain_factors<TLhs>::type,
+                                              typename matmul_chain_factors<TRhs>::type>::type;
+};
+
+// A product of more than two static factors. A vector can only appear at
+// one end of the chain
+template<typename Derived>
+struct is_binary_matmul_chain {
+    static constexpr bool value = false;
+};
+template<typename TLhs, typename TRhs, size_t DIM>
+struct is_binary_matmul_chain<BinaryMatMulOp<TLhs,TRhs,DIM>> {
+    using factors = typename matmul_chain_factors<BinaryMatMulOp<TLhs,TRhs,DIM>>::type;
+    using first_type = typename std::tuple_element<0,factors>::type::result_type;
+    using last_type = typename std::tuple_element<std::tuple_size<factors>::value-1,factors>::type::result_type;
+    static constexpr bool value = (is_binary_matmul_op<TLhs>::value || is_binary_matmul_op<TRhs>::value) &&
+                                  !BinaryMatMulOp<TLhs,TRhs,DIM>::is_dynamic &&
+                                  (first_type::dimension_t::value == 2 || last_type::dimension_t::value == 2);
+};
+
+// helper
+template<typename Derived>
+static constexpr bool is_binary_matmul_chain_v = is_binary_matmul_chain<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
 
 } // end of namespace Fastor
 
@@ -0,0 +1,248 @@
+#ifndef UNARY_CHOL_OP_H
+#define UNARY_CHOL_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/inner.h"
+#include "Fastor/backend/cholfact.h"
+#include "Fastor/backend/trsm.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/Ranges.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include "Fastor/expressions/linalg_ops/unary_trans_op.h"
+#include "Fastor/expressions/linalg_ops/unary_inv_op.h"
+#include "Fastor/expressions/linalg_ops/unary_lu_op.h"
+
+
+namespace Fastor {
+
+namespace internal {
+
+/* Forward substitution of b/B given the lower triangular [non-unit diagonal] Cholesky factor L.
+    The following functions implement L * y = b for single or multiple right sides on top of _trsm
+*/
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> chol_forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M> &b) {
+    Tensor<T,M> y;
+    _trsm<T,M,1,UpLoType::Lower>(L.data(),b.data(),y.data());
+    return y;
+}
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE Tensor<T,M,N> chol_forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B) {
+    Tensor<T,M,N> X;
+    _trsm<T,M,N,UpLoType::Lower>(L.data(),B.data(),X.data());
+    return X;
+}
+
+/* Backward substitution of y/Y given the Cholesky factor L. The following functions implement
+    L^T * x = y reading L by columns instead of transposing it
+*/
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> chol_backward_subs(const Tensor<T,M,M> &L, const Tensor<T,M> &y) {
+    Tensor<T,M> x;
+    _trsm<T,M,1,UpLoType::Lower,true>(L.data(),y.data(),x.data());
+    return x;
+}
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE Tensor<T,M,N> chol_backward_subs(const Tensor<T,M,M> &L, const Tensor<T,M,N> &Y) {
+    Tensor<T,M,N> X;
+    _trsm<T,M,N,UpLoType::Lower,true>(L.data(),Y.data(),X.data());
+    return X;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+/* Block Cholesky factorisation */
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template <typename T, size_t M, enable_if_t_<is_greater_v_<M,0> && is_less_equal_v_<M,8>,bool> = false>
+FASTOR_INLINE void chol_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L) {
+    _cholfact<T,M>(A.data(),L.data());
+}
+
+template <typename T, size_t M, enable_if_t_<is_greater_v_<M,8>,bool> = false>
+FASTOR_INLINE void chol_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L) {
+
+    // We will compute the Cholesky decomposition block-wise
+    //
+    // [A11 A21^T]   [L11    0] [L11^T L21^T]
+    // [A21 A22  ]   [L21  L22] [0     L22^T]
+    //
+    // This results in
+    //
+    // A11 = L11 * L11^T
+    // A21 = L21 * L11^T
+    // A22 = L21 * L21^T + L22 * L22^T
+    //
+    // Hence we need to do Cholesky factorisation once for A11 and once for
+    // the Schur complement A22 - L21 * L21^T which is also positive definite
+
+    // This is to avoid odd sizes for instance for size 35 we would
+    // want to do 35 = 16 + 19 rather than 35 = 32 + 3 if the start size was 32.
+    // For sizes greater than 64 we tile differently to avoid too many recursions
+    constexpr size_t N = M <= 64UL ? (M / 8UL * 8UL) / 2UL : (M / 16UL * 16UL) / 2UL; // start size
+    Tensor<T,N  ,N  > A11 = A(fseq<0,N>(),fseq<0,N>());
+    Tensor<T,M-N,  N> A21 = A(fseq<N,M>(),fseq<0,N>());
+    Tensor<T,M-N,M-N> A22 = A(fseq<N,M>(),fseq<N,M>());
+
+    Tensor<T,N,N> L11(0);
+    chol_block_dispatcher(A11, L11);
+
+    // Solve for L21 = A21*{L11}^(-T) as {L21}^T = {L11}^(-1)*{A21}^T
+    Tensor<T,N  ,M-N> L21T = transpose(A21);
+    _trsm<T,N,M-N,UpLoType::Lower>(L11.data(),L21T.data(),L21T.data());
+    Tensor<T,M-N,  N> L21 = transpose(L21T);
+
+    Tensor<T,M-N,M-N> S   = A22 - matmul(L21,L21T);
+
+    Tensor<T,M-N,M-N> L22(0);
+    chol_block_dispatcher(S, L22);
+
+    L(fseq<0,N>(),fseq<0,N>()) = L11;
+    // L(fseq<0,N>(),fseq<N,M>()) = 0;
+    L(fseq<N,M>(),fseq<0,N>()) = L21;
+    L(fseq<N,M>(),fseq<N,M>()) = L22;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+} // internal
+
+
+/* Cholesky factorisation overloads. The matrix has to be symmetric positive
+    definite, only its lower triangular part is used and no check is performed
+*/
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+cholesky(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L) {
+    L.fill(0);
+    internal::chol_block_dispatcher(src.self(),L);
+}
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+cholesky(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L) {
+    L.fill(0);
+    typename Expr::result_type tmp(src.self());
+    internal::chol_block_dispatcher(tmp,L);
+}
+
+template<typename Expr, size_t DIM0>
+FASTOR_INLINE
+typename Expr::result_type
+cholesky(const AbstractTensor<Expr,DIM0> &src) {
+    typename Expr::result_type L;
+    cholesky(src.self(),L);
+    return L;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Inversion using Cholesky
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M,M> get_chol_inverse(const Tensor<T,M,M> &L) {
+    // We will solve for multiple RHS [B = I]
+    Tensor<T,M,M> I; I.eye2();
+    Tensor<T,M,M> Y = chol_forward_subs(L, I);
+    Tensor<T,M,M> X = chol_backward_subs(L, Y);
+    return X;
+}
+
+} // internal
+
+template<InvCompType InvType = InvCompType::SimpleInv,
+    typename T, size_t M, enable_if_t_<InvType == InvCompType::Chol,bool> = false>
+FASTOR_INLINE Tensor<T,M,M> inverse(const Tensor<T,M,M> &A) {
+    Tensor<T,M,M> L;
+    cholesky(A, L);
+    return internal::get_chol_inverse(L);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Solving linear system of equations using Cholesky
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> get_chol_solve(const Tensor<T,M,M> &L, const Tensor<T,M> &b) {
+    Tensor<T,M> y = chol_forward_subs(L, b);
+    Tensor<T,M> x = chol_backward_subs(L, y);
+    return x;
+}
+
+// Multiple RHS
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE Tensor<T,M,N> get_chol_solve(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B) {
+    Tensor<T,M,N> Y = chol_forward_subs(L, B);
+    Tensor<T,M,N> X = chol_backward_subs(L, Y);
+    return X;
+}
+
+} // internal
+
+// Single RHS
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M,
+    enable_if_t_< SType == SolveCompType::Chol, bool> = false>
+FASTOR_INLINE Tensor<T,M> solve(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    Tensor<T,M,M> L;
+    cholesky(A, L);
+    return internal::get_chol_solve(L, b);
+}
+
+// Multiple RHS
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M, size_t N,
+    enable_if_t_< SType == SolveCompType::Chol, bool> = false>
+FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    Tensor<T,M,M> L;
+    cholesky(A, L);
+    return internal::get_chol_solve(L, B);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Computing determinant using Cholesky
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<DetCompType DetType = DetCompType::Simple, typename T, size_t M,
+    enable_if_t_<DetType == DetCompType::Chol,bool> = false>
+FASTOR_INLINE T determinant(const Tensor<T,M,M> &A) {
+    Tensor<T,M,M> L;
+    cholesky(A, L);
+    const T detL = product(diag(L));
+    return detL * detL;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_CHOL_OP_H
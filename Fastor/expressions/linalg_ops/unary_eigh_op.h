@@ -0,0 +1,55 @@
+#ifndef UNARY_EIGH_OP_H
+#define UNARY_EIGH_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/eigh.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+
+
+namespace Fastor {
+
+/* Eigen decomposition of symmetric 2x2 and 3x3 matrices A = V * diag(w) * V^T.
+    Only the lower triangular part of A is used and no check for symmetry is
+    performed. The eigenvalues are returned in ascending order and the columns
+    of V are the corresponding orthonormal eigenvectors
+*/
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+eigh(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    static_assert(M==2 || M==3, "EIGEN DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    _eigh<T,M>(src.self().data(),w.data(),V.data());
+}
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+eigh(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    static_assert(M==2 || M==3, "EIGEN DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    typename Expr::result_type A(src.self());
+    _eigh<T,M>(A.data(),w.data(),V.data());
+}
+
+/* Eigenvalues only */
+template<typename T, size_t M>
+FASTOR_INLINE
+Tensor<T,M>
+eigvalsh(const Tensor<T,M,M> &A) {
+    Tensor<T,M> w;
+    Tensor<T,M,M> V;
+    eigh(A,w,V);
+    return w;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_EIGH_OP_H
@@ -264,100 +264,10 @@ FASTOR_INLINE void lut_inverse_dispatcher(const Tensor<T,M,M> &in, Tensor<T,M,M>
     out(fseq<N,M>(),fseq<N,M>()) = inv_d;
 }
 
-template<typename T, size_t M, enable_if_t_<is_greater_v_<M,16> && is_less_equal_v_<M,32>,bool> = false>
-FASTOR_INLINE void lut_inverse_dispatcher(const Tensor<T,M,M> &in, Tensor<T,M,M>& out) {
-
-    // constexpr size_t N = 16UL; // start size
-    constexpr size_t N = (M / 8UL * 8UL) / 2UL; // start size
-    Tensor<T,N  ,N  > a = in(fseq<0,N>(),fseq<0,N>());
-    // Tensor<T,N  ,M-N> b = in(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> c = in(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> d = in(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> inv_a;
-    lut_inverse_dispatcher(a, inv_a);
-
-    Tensor<T,M-N,N> c_inva = matmul(c, inv_a);
-
-    Tensor<T,M-N,M-N> inv_d;
-    lut_inverse_dispatcher(d, inv_d);
-
-    out(fseq<0,N>(),fseq<0,N>()) = inv_a;
-    out(fseq<0,N>(),fseq<N,M>()) = 0;
-    out(fseq<N,M>(),fseq<0,N>()) = -matmul(inv_d, c_inva);
-    out(fseq<N,M>(),fseq<N,M>()) = inv_d;
-}
-
-template<typename T, size_t M, enable_if_t_<is_greater_v_<M,32> && is_less_equal_v_<M,64>,bool> = false>
-FASTOR_INLINE void lut_inverse_dispatcher(const Tensor<T,M,M> &in, Tensor<T,M,M>& out) {
-
-    // constexpr size_t N = 32UL; // start size
-    constexpr size_t N = (M / 16UL * 16UL) / 2UL; // start size
-    Tensor<T,N  ,N  > a = in(fseq<0,N>(),fseq<0,N>());
-    // Tensor<T,N  ,M-N> b = in(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> c = in(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> d = in(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> inv_a;
-    lut_inverse_dispatcher(a, inv_a);
-
-    Tensor<T,M-N,N> c_inva = tmatmul<UpLoType::General,UpLoType::Lower>(c, inv_a);
-
-    Tensor<T,M-N,M-N> inv_d;
-    lut_inverse_dispatcher(d, inv_d);
-
-    out(fseq<0,N>(),fseq<0,N>()) = inv_a;
-    out(fseq<0,N>(),fseq<N,M>()) = 0;
-    out(fseq<N,M>(),fseq<0,N>()) = -tmatmul<UpLoType::Lower,UpLoType::General>(inv_d, c_inva);
-    out(fseq<N,M>(),fseq<N,M>()) = inv_d;
-}
-
-template<typename T, size_t M, enable_if_t_<is_greater_v_<M,64> && is_less_equal_v_<M,128>,bool> = false>
-FASTOR_INLINE void lut_inverse_dispatcher(const Tensor<T,M,M> &in, Tensor<T,M,M>& out) {
-
-    // constexpr size_t N = 64UL; // start size
-    constexpr size_t N = (M / 32UL * 32UL) / 2UL; // start size
-    Tensor<T,N  ,N  > a = in(fseq<0,N>(),fseq<0,N>());
-    // Tensor<T,N  ,M-N> b = in(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> c = in(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> d = in(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> inv_a;
-    lut_inverse_dispatcher(a, inv_a);
-
-    Tensor<T,M-N,N> c_inva = tmatmul<UpLoType::General,UpLoType::Lower>(c, inv_a);
-
-    Tensor<T,M-N,M-N> inv_d;
-    lut_inverse_dispatcher(d, inv_d);
-
-    out(fseq<0,N>(),fseq<0,N>()) = inv_a;
-    out(fseq<0,N>(),fseq<N,M>()) = 0;
-    out(fseq<N,M>(),fseq<0,N>()) = -tmatmul<UpLoType::Lower,UpLoType::General>(inv_d, c_inva);
-    out(fseq<N,M>(),fseq<N,M>()) = inv_d;
-}
-
-template<typename T, size_t M, enable_if_t_<is_greater_v_<M,128> && is_less_equal_v_<M,256>,bool> = false>
+// Beyond this size the blocked triangular solve with B = I is cheaper than the recursion
+template<typename T, size_t M, enable_if_t_<is_greater_v_<M,16>,bool> = false>
 FASTOR_INLINE void lut_inverse_dispatcher(const Tensor<T,M,M> &in, Tensor<T,M,M>& out) {
-
-    // constexpr size_t N = 128UL; // start size
-    constexpr size_t N = (M / 64UL * 64UL) / 2UL; // start size
-    Tensor<T,N  ,N  > a = in(fseq<0,N>(),fseq<0,N>());
-    // Tensor<T,N  ,M-N> b = in(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> c = in(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> d = in(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> inv_a;
-    lut_inverse_dispatcher(a, inv_a);
-
-    Tensor<T,M-N,N> c_inva = tmatmul<UpLoType::General,UpLoType::Lower>(c, inv_a);
-
-    Tensor<T,M-N,M-N> inv_d;
-    lut_inverse_dispatcher(d, inv_d);
-
-    out(fseq<0,N>(),fseq<0,N>()) = inv_a;
-    out(fseq<0,N>(),fseq<N,M>()) = 0;
-    out(fseq<N,M>(),fseq<0,N>()) = -tmatmul<UpLoType::Lower,UpLoType::General>(inv_d, c_inva);
-    out(fseq<N,M>(),fseq<N,M>()) = inv_d;
+    _lowunitri_inverse<T,M>(in.data(),out.data());
 }
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
@@ -4,6 +4,7 @@
 #include "Fastor/meta/meta.h"
 #include "Fastor/backend/inner.h"
 #include "Fastor/backend/lufact.h"
+#include "Fastor/backend/trsm.h"
 #include "Fastor/simd_vector/SIMDVector.h"
 #include "Fastor/tensor/AbstractTensor.h"
 #include "Fastor/tensor/Aliasing.h"
@@ -19,157 +20,39 @@ namespace Fastor {
 
 namespace internal {
 
-/* Compile time recursive loop with inner for forward substitution of b/B given the lower unitriangular matrix L.
-    The following meta functions implements L * y = b for single or multiple right sides
+/* Forward substitution of b/B given the lower unitriangular matrix L. The following functions
+    implement L * y = b for single or multiple right sides [optionally pivoted by p] on top of _trsm
 */
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
-template <size_t from, size_t to>
-struct forward_subs_impl {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &L, const Tensor<T,M> &b, Tensor<T,M> &y) {
-        y(from) = b(from) -  _inner<T,from>(&L.data()[from*M],y.data());
-        forward_subs_impl<from+1,to>::do_single_rhs(L, b, y);
-    }
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs_pivot(const Tensor<T,M,M> &L, const Tensor<T,M> &b, const Tensor<size_t,M> &p, Tensor<T,M> &y) {
-        y(from) = b(p(from)) -  _inner<T,from>(&L.data()[from*M],y.data());
-        forward_subs_impl<from+1,to>::do_single_rhs_pivot(L, b, p, y);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(from,j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-        forward_subs_impl<from+1,to>::do_multi_rhs(j, L, B, y, X);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs_pivot(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B,
-            const Tensor<size_t,M> &p, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(p(from),j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-        forward_subs_impl<from+1,to>::do_multi_rhs_pivot(j, L, B, p, y, X);
-    }
-};
-template <size_t from>
-struct forward_subs_impl<from,from> {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &L, const Tensor<T,M> &b, Tensor<T,M> &y) {
-        y(from) = b(from) -  _inner<T,from>(&L.data()[from*M],y.data());
-    }
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs_pivot(const Tensor<T,M,M> &L, const Tensor<T,M> &b, const Tensor<size_t,M> &p, Tensor<T,M> &y) {
-        y(from) = b(p(from)) -  _inner<T,from>(&L.data()[from*M],y.data());
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(from,j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-    }
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs_pivot(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B,
-            const Tensor<size_t,M> &p, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(p(from),j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-    }
-};
-
 template<typename T, size_t M>
 FASTOR_INLINE Tensor<T,M> forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M> &b) {
-
-    Tensor<T,M> y(0);
-
-    forward_subs_impl<0,M-1>::do_single_rhs(L, b, y);
-#if 0
-    // The run-time loop version
-    // Solve for L * y = b
-    for (size_t i=0; i< M; ++i) {
-        T value = 0;
-        for (size_t k=0; k<i; ++k) {
-            value += L(i,k)*y(k);
-        }
-        y(i) = b(i) - value;
-    }
-#endif
+    Tensor<T,M> y;
+    _trsm<T,M,1,UpLoType::UniLower>(L.data(),b.data(),y.data());
     return y;
 }
 template<typename T, size_t M, size_t N>
 FASTOR_INLINE Tensor<T,M,N> forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B) {
-
-    // We keep a separate output tensor X from y [y is columns of X]
-    // to avoid strided access in X for the inner product
     Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        forward_subs_impl<0,M-1>::do_multi_rhs(j, L, B, y, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        // Solve for L * y = b
-        for (size_t i=0; i< M; ++i) {
-            T value = 0;
-            for (size_t k=0; k<i; ++k) {
-                value += L(i,k)*y(k);
-            }
-            y(i) = B(i,j) - value;
-            X(i,j) = y(i);
-        }
-    }
-#endif
+    _trsm<T,M,N,UpLoType::UniLower>(L.data(),B.data(),X.data());
     return X;
 }
 template<typename T, size_t M>
 FASTOR_INLINE Tensor<T,M> forward_subs(const Tensor<T,M,M> &L, const Tensor<size_t,M> &p, const Tensor<T,M> &b) {
-
-    Tensor<T,M> y(0);
-
-    forward_subs_impl<0,M-1>::do_single_rhs_pivot(L, b, p, y);
-#if 0
-    // The run-time loop version
-    // Solve for L * y = b
-    for (size_t i=0; i< M; ++i) {
-        T value = 0;
-        for (size_t k=0; k<i; ++k) {
-            value += L(i,k)*y(k);
-        }
-        y(i) = b(p(i)) - value;
+    Tensor<T,M> y;
+    for (size_t i=0; i<M; ++i) {
+        y(i) = b(p(i));
     }
-#endif
+    _trsm<T,M,1,UpLoType::UniLower>(L.data(),y.data(),y.data());
     return y;
 }
 template<typename T, size_t M, size_t N>
 FASTOR_INLINE Tensor<T,M,N> forward_subs(const Tensor<T,M,M> &L, const Tensor<size_t,M> &p, const Tensor<T,M,N> &B) {
-
-    // We keep a separate output tensor X from y [y is columns of X]
-    // to avoid strided access in X for the inner product
     Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        forward_subs_impl<0,M-1>::do_multi_rhs_pivot(j, L, B, p, y, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        // Solve for L * y = b
-        for (size_t i=0; i< M; ++i) {
-            T value = 0;
-            for (size_t k=0; k<i; ++k) {
-                value += L(i,k)*y(k);
-            }
-            y(i) = B(p(i),j) - value;
-            X(i,j) = y(i);
-        }
+    for (size_t i=0; i<M; ++i) {
+        std::copy(&B.data()[p(i)*N],&B.data()[p(i)*N+N],&X.data()[i*N]);
     }
-#endif
+    _trsm<T,M,N,UpLoType::UniLower>(L.data(),X.data(),X.data());
     return X;
 }
 //-----------------------------------------------------------------------------------------------------------//
@@ -178,97 +61,22 @@ FASTOR_INLINE Tensor<T,M,N> forward_subs(const Tensor<T,M,M> &L, const Tensor<si
 
 
 
-/* Compile time recursive loop with inner for backward substitution of y/Y given the upper triangular matrix U.
-    The following meta functions implements U * x = y for single or multiple right sides
+/* Backward substitution of y/Y given the upper triangular matrix U. The following functions
+    implement U * x = y for single or multiple right sides on top of _trsm
 */
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
-template <int from, int to>
-struct backward_subs_impl {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &U, const Tensor<T,M> &y, Tensor<T,M> &x) {
-        constexpr int idx = (int)M - from;
-        const T value = _inner<T,idx>(&U.data()[from*M+from],&x.data()[from]);
-        x(from) = ( y(from) - value) / U(from, from);
-        backward_subs_impl<from-1,to>::do_single_rhs(U, y, x);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y, Tensor<T,M> &x, Tensor<T,M,N> &X) {
-        constexpr int idx = (int)M - from;
-        const T value = _inner<T,idx>(&U.data()[from*M+from],&x.data()[from]);
-        x(from) = ( Y(from,j) - value ) / U(from, from);
-        X(from,j) = x(from);
-        backward_subs_impl<from-1,to>::do_multi_rhs(j, U, Y, x, X);
-    }
-};
-
-template <>
-struct backward_subs_impl<0,0> {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &U, const Tensor<T,M> &y, Tensor<T,M> &x) {
-        constexpr int idx = (int)M;
-        const T value = _inner<T,idx>(&U.data()[0*M+0],&x.data()[0]);
-        x(0) = ( y(0) - value) / U(0, 0);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y, Tensor<T,M> &x, Tensor<T,M,N> &X) {
-        constexpr int idx = (int)M;
-        const T value = _inner<T,idx>(&U.data()[0*M+0],&x.data()[0]);
-        x(0) = ( Y(0,j) - value ) / U(0, 0);
-        X(0,j) = x(0);
-    }
-};
-
 template<typename T, size_t M>
 FASTOR_INLINE Tensor<T,M> backward_subs(const Tensor<T,M,M> &U, const Tensor<T,M> &y) {
-
-    // We keep a separate output tensor X from x [x is columns of X]
-    // to avoid strided access in X for the inner product
-    Tensor<T,M> x(0);
-    backward_subs_impl<int(M)-1,0>::do_single_rhs(U, y, x);
-#if 0
-    // The run-time loop version
-    // Solve for of U * x = y
-    for (int i= int(M) - 1; i>=0; --i) {
-        T value = 0;
-        for (int k=i; k<int(M); ++k) {
-            value += U(i,k)*x(k);
-        }
-        x(i) = (y(i) - value) / U(i, i);
-    }
-#endif
+    Tensor<T,M> x;
+    _trsm<T,M,1,UpLoType::Upper>(U.data(),y.data(),x.data());
     return x;
 }
 
 template<typename T, size_t M, size_t N>
 FASTOR_INLINE Tensor<T,M,N> backward_subs(const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y) {
-
-    // We keep a separate output tensor X from x [x is columns of X]
-    // to avoid strided access in X for the inner product
     Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> x(0);
-        backward_subs_impl<int(M)-1,0>::do_multi_rhs(j, U, Y, x, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    Tensor<T,M,N> X(0);
-    for (size_t j=0; j < 1; ++j) {
-        // Solve for of U * x = y
-        for (int i= int(M) - 1; i>=0; --i) {
-            T value = 0;
-            for (int k=i; k<int(M); ++k) {
-                value += U(i,k)*X(k,j);
-            }
-            X(i,j) = (Y(i,j) - value) / U(i, i);
-        }
-    }
-#endif
+    _trsm<T,M,N,UpLoType::Upper>(U.data(),Y.data(),X.data());
     return X;
 }
 
@@ -562,14 +370,11 @@ FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L,
     useless::lu_block_simple_dispatcher(A11, L11, U11);
 
     // Solve for U12 = {L11}^(-1)*A12
-    Tensor<T,N  ,M-N> U12 = tmatmul<UpLoType::Lower,UpLoType::General>(tinverse<InvCompType::SimpleInv, UpLoType::UniLower>(L11),A12);
-    // Ideally use forward_subs but its iterative nature makes it less efficient than tmatmul
-    // Tensor<T,N  ,M-N> U12 = forward_subs(L11,A12);
-    // Solve for L21 = A21*{U11}^(-1)
-    Tensor<T,M-N,  N> L21 = tmatmul<UpLoType::General,UpLoType::Upper>(A21,tinverse<InvCompType::SimpleInv, UpLoType::Upper>(U11));
-    // Not quite performant as we can't avoid the matmul here
-    // Tensor<T,N  ,N  > I; I.eye2();
-    // Tensor<T,M-N,  N> L21 = matmul(A21, backward_subs(U11, I));
+    Tensor<T,N  ,M-N> U12 = forward_subs(L11,A12);
+    // Solve for L21 = A21*{U11}^(-1) as {L21}^T = {U11}^(-T)*{A21}^T
+    Tensor<T,N  ,M-N> L21T = transpose(A21);
+    _trsm<T,N,M-N,UpLoType::Upper,true>(U11.data(),L21T.data(),L21T.data());
+    Tensor<T,M-N,  N> L21 = transpose(L21T);
 
     Tensor<T,M-N,M-N> S   = A22 - matmul(L21,U12);
 
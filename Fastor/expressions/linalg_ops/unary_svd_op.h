@@ -0,0 +1,80 @@
+#ifndef UNARY_SVD_OP_H
+#define UNARY_SVD_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/svd.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+
+
+namespace Fastor {
+
+/* Singular value decomposition of 2x2 and 3x3 matrices A = U * diag(s) * V^T.
+    The singular values are non-negative and returned in descending order
+*/
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+svd(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &U, Tensor<T,M> &s, Tensor<T,M,M> &V) {
+    static_assert(M==2 || M==3, "SINGULAR VALUE DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    _svd<T,M>(src.self().data(),U.data(),s.data(),V.data());
+}
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+svd(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &U, Tensor<T,M> &s, Tensor<T,M,M> &V) {
+    static_assert(M==2 || M==3, "SINGULAR VALUE DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    typename Expr::result_type A(src.self());
+    _svd<T,M>(A.data(),U.data(),s.data(),V.data());
+}
+
+/* Singular values only */
+template<typename T, size_t M>
+FASTOR_INLINE
+Tensor<T,M>
+svdvals(const Tensor<T,M,M> &A) {
+    Tensor<T,M,M> U, V;
+    Tensor<T,M> s;
+    svd(A,U,s,V);
+    return s;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+/* Right polar decomposition of 2x2 and 3x3 matrices F = R * U where R is
+    orthogonal and U is the symmetric positive semi-definite stretch tensor
+*/
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+polar(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &R, Tensor<T,M,M> &U) {
+    static_assert(M==2 || M==3, "POLAR DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    _polar<T,M>(src.self().data(),R.data(),U.data());
+}
+template<typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+polar(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &R, Tensor<T,M,M> &U) {
+    static_assert(M==2 || M==3, "POLAR DECOMPOSITION IS ONLY IMPLEMENTED FOR 2x2 AND 3x3 MATRICES");
+    typename Expr::result_type F(src.self());
+    _polar<T,M>(F.data(),R.data(),U.data());
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_SVD_OP_H
@@ -51,6 +51,22 @@ public:\
     FASTOR_INLINE EVAL_TYPE teval_s(const std::array<int,DIM0> &as) const {\
         return SCALAR_OP(_expr.template teval_s<EVAL_TYPE>(as));\
     }\
+    /* The operation itself on a SIMDVector or a scalar, for fused kernels */\
+    template<typename V>\
+    static FASTOR_INLINE V apply(const V &a) {\
+        return SIMD_OP(a);\
+    }\
+    static FASTOR_INLINE EVAL_TYPE apply(EVAL_TYPE a) {\
+        return SCALAR_OP(a);\
+    }\
+};\
+template<typename Expr, size_t DIM0>\
+struct is_unary_math_op<Unary ##STRUCT_NAME ## Op<Expr, DIM0>> {\
+    static constexpr bool value = true;\
+};\
+template<typename Expr, size_t DIM0>\
+struct is_tail_maskable<Unary ##STRUCT_NAME ## Op<Expr, DIM0>> {\
+    static constexpr bool value = is_tail_maskable<Expr>::value;\
 };\
 template<typename Expr, size_t DIM0,\
          typename std::enable_if<!std::is_arithmetic<Expr>::value,bool>::type = 0 >\
@@ -98,7 +114,8 @@ FASTOR_MAKE_UNARY_MATH_OPS(arg , arg , std::arg , Arg , scalar_type)
 
 #define FASTOR_MAKE_UNARY_MATH_OP_ASSIGNMENT(OP, NAME, ASSIGN_TYPE)\
 template<typename Derived, size_t DIM, typename OtherDerived, size_t OtherDIM,\
-    typename std::enable_if<requires_evaluation_v<OtherDerived>,bool>::type = false>\
+    typename std::enable_if<requires_evaluation_v<OtherDerived> &&\
+        !is_fused_gemm_expr_v<Unary ##NAME ## Op<OtherDerived,OtherDIM>>,bool>::type = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Unary ##NAME ## Op<OtherDerived,OtherDIM> &src) {\
     assign ##ASSIGN_TYPE (dst.self(), src.expr().self());\
     trivial_assign(dst.self(), OP(dst.self()));\
@@ -149,7 +166,8 @@ FASTOR_MAKE_UNARY_MATH_OP_ASSIGNMENT(arg , Arg , )
 // arithmetic assignments
 #define FASTOR_MAKE_UNARY_MATH_OP_ARITHMETIC_ASSIGNMENT(OP, NAME, ASSIGN_TYPE)\
 template<typename Derived, size_t DIM, typename OtherDerived, size_t OtherDIM,\
-    typename std::enable_if<requires_evaluation_v<OtherDerived>,bool>::type = false>\
+    typename std::enable_if<requires_evaluation_v<OtherDerived> &&\
+        !is_fused_gemm_expr_v<Unary ##NAME ## Op<OtherDerived,OtherDIM>>,bool>::type = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const Unary ##NAME ## Op<OtherDerived,OtherDIM> &src) {\
     using result_type = typename Unary ##NAME ## Op<OtherDerived,OtherDIM>::result_type;\
     const result_type tmp(src.expr().self());\
@@ -0,0 +1,332 @@
+#ifndef TENSOR_DYNAMIC_VIEWS_H
+#define TENSOR_DYNAMIC_VIEWS_H
+
+
+#include "Fastor/tensor/DynamicTensor.h"
+#include "Fastor/tensor/Ranges.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
+
+namespace Fastor {
+
+
+namespace internal {
+
+/* Maps the flat/multi-dimensional index of a view in to the memory of a dynamic tensor.
+   As the extents of the parent tensor are only known at runtime the strides of
+   the view are computed once at construction
+*/
+template<size_t DIMS>
+struct dynamic_view_indexer {
+    std::array<int,DIMS> _dims;
+    std::array<int,DIMS> _strides;
+    int _offset;
+    int _size;
+
+    template<typename T, int DIM>
+    FASTOR_INLINE void setup(const DynamicTensor<T,DIM> &expr, std::array<seq,DIMS> &seqs) {
+        static_assert(DIMS==DIM,"INDEXING TENSOR WITH INCORRECT NUMBER OF ARGUMENTS");
+        for (FASTOR_INDEX n=0; n<DIMS; ++n) {
+            seq &_seq = seqs[n];
+            const int dim = expr.dimension(n);
+            if (_seq._last < 0 && _seq._first>=0) {
+                _seq._last += dim + 1;
+            }
+            // take care of scalar indexing with -1
+            else if (_seq._last == 0 && _seq._first==-1) {
+                _seq._first = dim-1;
+                _seq._last = dim;
+            }
+            else if (_seq._last < 0 && _seq._first < 0) {
+                _seq._first += dim + 1;
+                _seq._last += dim + 1;
+            }
+#ifndef NDEBUG
+            FASTOR_ASSERT(_seq._last <= dim && _seq._first<dim,"INDEX OUT OF BOUNDS");
+#endif
+        }
+
+        int product = 1;
+        _offset = 0;
+        _size = 1;
+        for (int n=DIMS-1; n>=0; --n) {
+            _dims[n] = seqs[n].size();
+            _strides[n] = product*seqs[n]._step;
+            _offset += product*seqs[n]._first;
+            product *= expr.dimension(n);
+            _size *= _dims[n];
+        }
+    }
+
+    FASTOR_INLINE int index(int idx) const {
+        int ind = _offset;
+        for (int n=DIMS-1; n>=0; --n) {
+            ind += (idx % _dims[n])*_strides[n];
+            idx /= _dims[n];
+        }
+        return ind;
+    }
+    FASTOR_INLINE int index(const std::array<int,DIMS> &as) const {
+        int ind = _offset;
+        for (FASTOR_INDEX n=0; n<DIMS; ++n) {
+            ind += as[n]*_strides[n];
+        }
+        return ind;
+    }
+
+    /* A SIMD load starting at the flat index idx - contiguous when the chunk lies in
+       a single row of unit stride, strided or gathered otherwise
+    */
+    template<typename U, typename ABI, typename T>
+    FASTOR_INLINE SIMDVector<U,ABI> load(const T *data, int idx) const {
+        using V = SIMDVector<U,ABI>;
+        V _vec;
+        const int col = idx % _dims[DIMS-1];
+        if (col + int(V::Size) <= _dims[DIMS-1]) {
+            if (_strides[DIMS-1]==1) _vec.load(&data[index(idx)],false);
+            else vector_setter(_vec,data,index(idx),_strides[DIMS-1]);
+        }
+        else {
+            std::array<int,V::Size> inds;
+            for (FASTOR_INDEX j=0; j<V::Size; ++j) {
+                inds[j] = index(idx+j);
+            }
+            vector_setter(_vec,data,inds);
+        }
+        return _vec;
+    }
+    template<typename U, typename ABI, typename T>
+    FASTOR_INLINE SIMDVector<U,ABI> load(const T *data, const std::array<int,DIMS> &as) const {
+        using V = SIMDVector<U,ABI>;
+        V _vec;
+        if (as[DIMS-1] + int(V::Size) <= _dims[DIMS-1]) {
+            if (_strides[DIMS-1]==1) _vec.load(&data[index(as)],false);
+            else vector_setter(_vec,data,index(as),_strides[DIMS-1]);
+        }
+        else {
+            std::array<int,V::Size> inds;
+            std::array<int,DIMS> as_ = as;
+            for (FASTOR_INDEX j=0; j<V::Size; ++j) {
+                inds[j] = index(as_);
+                for (int jt=DIMS-1; jt>=0; jt--) {
+                    if (++as_[jt]<_dims[jt]) break;
+                    as_[jt]=0;
+                }
+            }
+            vector_setter(_vec,data,inds);
+        }
+        return _vec;
+    }
+};
+
+} // end of namespace internal
+
+
+
+// Generic const views of dynamic tensors based on sequences/slices
+//----------------------------------------------------------------------------------------------//
+template<typename T, int DIM, size_t DIMS>
+struct TensorConstViewExpr<DynamicTensor<T,DIM>,DIMS>: public AbstractTensor<TensorConstViewExpr<DynamicTensor<T,DIM>,DIMS>,DIMS> {
+private:
+    const DynamicTensor<T,DIM> &_expr;
+    std::array<seq,DIMS> _seqs;
+    internal::dynamic_view_indexer<DIMS> _indexer;
+public:
+    using scalar_type = T;
+    using simd_vector_type = typename DynamicTensor<T,DIM>::simd_vector_type;
+    using simd_abi_type = typename simd_vector_type::abi_type;
+    using result_type = DynamicTensor<T,DIMS>;
+    static constexpr FASTOR_INDEX Dimension = DIMS;
+    static constexpr FASTOR_INDEX Stride = simd_vector_type::Size;
+
+    FASTOR_INLINE FASTOR_INDEX size() const {return _indexer._size;}
+    FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {return _indexer._dims[i];}
+    constexpr const DynamicTensor<T,DIM>& expr() const {return _expr;}
+
+    FASTOR_INLINE TensorConstViewExpr(const DynamicTensor<T,DIM> &_ex, std::array<seq,DIMS> _s) : _expr(_ex), _seqs(std::move(_s)) {
+        _indexer.setup(_expr,_seqs);
+    }
+
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),idx);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U eval_s(FASTOR_INDEX idx) const {
+        return _expr.data()[_indexer.index(idx)];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),i*_indexer._dims[DIMS-1]+j);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U eval_s(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return _expr.data()[_indexer.index(i*_indexer._dims[DIMS-1]+j)];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),as);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U teval_s(const std::array<int,DIMS>& as) const {
+        return _expr.data()[_indexer.index(as)];
+    }
+};
+//----------------------------------------------------------------------------------------------//
+
+
+
+
+// Generic non-const views of dynamic tensors based on sequences/slices
+//----------------------------------------------------------------------------------------------//
+template<typename T, int DIM, size_t DIMS>
+struct TensorViewExpr<DynamicTensor<T,DIM>,DIMS>: public AbstractTensor<TensorViewExpr<DynamicTensor<T,DIM>,DIMS>,DIMS> {
+private:
+    DynamicTensor<T,DIM> &_expr;
+    std::array<seq,DIMS> _seqs;
+    internal::dynamic_view_indexer<DIMS> _indexer;
+public:
+    using scalar_type = T;
+    using simd_vector_type = typename DynamicTensor<T,DIM>::simd_vector_type;
+    using simd_abi_type = typename simd_vector_type::abi_type;
+    using result_type = DynamicTensor<T,DIMS>;
+    static constexpr FASTOR_INDEX Dimension = DIMS;
+    static constexpr FASTOR_INDEX Stride = simd_vector_type::Size;
+
+    FASTOR_INLINE FASTOR_INDEX size() const {return _indexer._size;}
+    FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {return _indexer._dims[i];}
+    constexpr const DynamicTensor<T,DIM>& expr() const {return _expr;}
+
+    FASTOR_INLINE TensorViewExpr(DynamicTensor<T,DIM> &_ex, std::array<seq,DIMS> _s) : _expr(_ex), _seqs(std::move(_s)) {
+        _indexer.setup(_expr,_seqs);
+    }
+
+    // View evalution operators
+    // Copy assignment operator [Needed in addition to generic AbstractTensor overload]
+    //----------------------------------------------------------------------------------//
+    FASTOR_HINT_INLINE void operator=(const TensorViewExpr<DynamicTensor<T,DIM>,DIMS> &other) {
+        this->operator=(static_cast<const AbstractTensor<TensorViewExpr<DynamicTensor<T,DIM>,DIMS>,DIMS>&>(other));
+    }
+    //----------------------------------------------------------------------------------//
+
+    // AbstractTensor binders - the view is traversed row by row, where a row is the
+    // last dimension of the view. Rows of unit stride are updated with SIMD loads/stores
+    //----------------------------------------------------------------------------------//
+#define FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(OP, VEC_UPDATE, SCALAR_UPDATE)\
+    template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>\
+    FASTOR_HINT_INLINE void operator OP(const AbstractTensor<Derived,OTHER_DIMS> &other) {\
+        const typename Derived::result_type& tmp = evaluate(other.self());\
+        this->operator OP(tmp);\
+    }\
+    template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && !requires_evaluation_v<Derived>,bool> = false>\
+    FASTOR_HINT_INLINE void operator OP(const AbstractTensor<Derived,OTHER_DIMS> &other) {\
+        using V = SIMDVector<T,simd_abi_type>;\
+        const Derived& other_src = other.self();\
+        FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");\
+        T *_data = _expr.data();\
+        const int ncols = _indexer._dims[DIMS-1];\
+        const int nrows = ncols == 0 ? 0 : size() / ncols;\
+        const int col_stride = _indexer._strides[DIMS-1];\
+        std::array<int,DIMS> as = {};\
+        for (int row=0; row<nrows; ++row) {\
+            as[DIMS-1] = 0;\
+            const int ind = _indexer.index(as);\
+            int j = 0;\
+            if (col_stride==1) {\
+                for (; j<ROUND_DOWN(ncols,int(V::Size)); j+=V::Size) {\
+                    as[DIMS-1] = j;\
+                    V _vec = VEC_UPDATE(&_data[ind+j], other_src.template teval<T>(as));\
+                    _vec.store(&_data[ind+j],false);\
+                }\
+            }\
+            for (; j<ncols; ++j) {\
+                as[DIMS-1] = j;\
+                _data[ind+j*col_stride] SCALAR_UPDATE other_src.template teval_s<T>(as);\
+            }\
+            as[DIMS-1] = 0;\
+            for (int jt=DIMS-2; jt>=0; jt--) {\
+                if (++as[jt]<_indexer._dims[jt]) break;\
+                as[jt] = 0;\
+            }\
+        }\
+    }\
+    template<typename U, enable_if_t_<is_primitive_v_<U>,bool> = false>\
+    FASTOR_HINT_INLINE void operator OP(U num) {\
+        using V = SIMDVector<T,simd_abi_type>;\
+        const V vnum(static_cast<T>(num));\
+        const T snum = static_cast<T>(num);\
+        T *_data = _expr.data();\
+        const int ncols = _indexer._dims[DIMS-1];\
+        const int nrows = ncols == 0 ? 0 : size() / ncols;\
+        const int col_stride = _indexer._strides[DIMS-1];\
+        std::array<int,DIMS> as = {};\
+        for (int row=0; row<nrows; ++row) {\
+            as[DIMS-1] = 0;\
+            const int ind = _indexer.index(as);\
+            int j = 0;\
+            if (col_stride==1) {\
+                for (; j<ROUND_DOWN(ncols,int(V::Size)); j+=V::Size) {\
+                    V _vec = VEC_UPDATE(&_data[ind+j], vnum);\
+                    _vec.store(&_data[ind+j],false);\
+                }\
+            }\
+            for (; j<ncols; ++j) {\
+                _data[ind+j*col_stride] SCALAR_UPDATE snum;\
+            }\
+            for (int jt=DIMS-2; jt>=0; jt--) {\
+                if (++as[jt]<_indexer._dims[jt]) break;\
+                as[jt] = 0;\
+            }\
+        }\
+    }\
+
+#define FASTOR_DYNAMIC_VIEW_ASSIGN(ptr, vec) (vec)
+#define FASTOR_DYNAMIC_VIEW_ADD(ptr, vec) (V(ptr,false) + (vec))
+#define FASTOR_DYNAMIC_VIEW_SUB(ptr, vec) (V(ptr,false) - (vec))
+#define FASTOR_DYNAMIC_VIEW_MUL(ptr, vec) (V(ptr,false) * (vec))
+#define FASTOR_DYNAMIC_VIEW_DIV(ptr, vec) (V(ptr,false) / (vec))
+
+    FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(= , FASTOR_DYNAMIC_VIEW_ASSIGN, = )
+    FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(+=, FASTOR_DYNAMIC_VIEW_ADD   , +=)
+    FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(-=, FASTOR_DYNAMIC_VIEW_SUB   , -=)
+    FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(*=, FASTOR_DYNAMIC_VIEW_MUL   , *=)
+    FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR(/=, FASTOR_DYNAMIC_VIEW_DIV   , /=)
+
+#undef FASTOR_DYNAMIC_VIEW_ASSIGN
+#undef FASTOR_DYNAMIC_VIEW_ADD
+#undef FASTOR_DYNAMIC_VIEW_SUB
+#undef FASTOR_DYNAMIC_VIEW_MUL
+#undef FASTOR_DYNAMIC_VIEW_DIV
+#undef FASTOR_DYNAMIC_VIEW_INPLACE_OPERATOR
+    //----------------------------------------------------------------------------------//
+
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),idx);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U eval_s(FASTOR_INDEX idx) const {
+        return _expr.data()[_indexer.index(idx)];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),i*_indexer._dims[DIMS-1]+j);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U eval_s(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return _expr.data()[_indexer.index(i*_indexer._dims[DIMS-1]+j)];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
+        return _indexer.template load<U,simd_abi_type>(_expr.data(),as);
+    }
+    template<typename U=T>
+    FASTOR_INLINE U teval_s(const std::array<int,DIMS>& as) const {
+        return _expr.data()[_indexer.index(as)];
+    }
+};
+//----------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // TENSOR_DYNAMIC_VIEWS_H
@@ -137,9 +137,7 @@ public:
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
                 auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] = other_src.template eval_s<T>(i);
@@ -200,9 +198,7 @@ public:
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
                 auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] = other_src.template eval_s<T>(i);
@@ -254,10 +250,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] += _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) + other_src.template eval<T>(i);
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] += other_src.template eval_s<T>(i);
@@ -309,10 +303,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] -= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) - other_src.template eval<T>(i);
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] -= other_src.template eval_s<T>(i);
@@ -364,10 +356,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * other_src.template eval<T>(i);
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] *= other_src.template eval_s<T>(i);
@@ -419,10 +409,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] /= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) / other_src.template eval<T>(i);
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] /= other_src.template eval_s<T>(i);
@@ -456,9 +444,7 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] = num;
@@ -489,9 +475,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] += _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) + _vec_other;
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] += num;
@@ -522,9 +507,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] -= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) - _vec_other;
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] -= num;
@@ -555,9 +539,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * _vec_other;
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] *= num;
@@ -589,9 +572,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * _vec_other;
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] *= inum;
@@ -621,9 +603,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                    _data[S0*(i+j) + F0] /= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) / _vec_other;
+                data_setter(_data,_vec,S0*i+F0,S0);
             }
             for (; i <size(); i++) {
                 _data[S0*i+F0] /= num;
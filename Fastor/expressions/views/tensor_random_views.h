@@ -222,9 +222,10 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_expr.data(),_vec_other,inds);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = other_src.template eval_s<T>(i);
@@ -273,9 +274,10 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_expr.data(),_vec_other,inds);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = other_src.template eval_s<T>(i);
@@ -465,9 +467,10 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_expr.data(),_vec_other,inds);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = num;
@@ -750,9 +753,10 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_data,_vec_other,inds);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = other_src.template eval_s<T>(i);
@@ -796,9 +800,10 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_data,_vec_other,inds);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = other_src.template eval_s<T>(i);
@@ -971,9 +976,10 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            std::array<int,SIMDVector<T,simd_abi_type>::Size> inds;
+            for (FASTOR_INDEX j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j)
+                inds[j] = it_expr.data()[i+j];
+            data_setter(_data,_vec_other,inds);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = num;
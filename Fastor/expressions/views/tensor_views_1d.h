@@ -158,10 +158,7 @@ public:
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
                 auto _vec_other = other.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -226,10 +223,7 @@ public:
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
                 auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -283,11 +277,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] += _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) + other_src.template eval<T>(i);
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -341,11 +332,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] -= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) - other_src.template eval<T>(i);
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -399,11 +387,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * other_src.template eval<T>(i);
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -457,11 +442,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                auto _vec_other = other_src.template eval<T>(i);
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] /= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) / other_src.template eval<T>(i);
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -496,10 +478,7 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] = _vec_other[j];
-                }
+                data_setter(_data,_vec_other,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -532,10 +511,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] += _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) + _vec_other;
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -568,10 +545,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] -= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) - _vec_other;
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -604,10 +579,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * _vec_other;
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -641,10 +614,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] *= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) * _vec_other;
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
@@ -676,10 +647,8 @@ public:
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
             FASTOR_INDEX i;
             for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-                for (auto j=0; j<simd_vector_type::Size; ++j) {
-                    auto idx = (i+j)*_seq._step+_seq._first;
-                    _data[idx] /= _vec_other[j];
-                }
+                auto _vec = this->template eval<T>(i) / _vec_other;
+                data_setter(_data,_vec,i*_seq._step+_seq._first,_seq._step);
             }
             for (; i <size(); i++) {
                 auto idx = i*_seq._step+_seq._first;
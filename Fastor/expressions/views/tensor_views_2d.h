@@ -44,14 +44,8 @@ public:
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            auto it = (idx+j) / _seq1.size(), jt = (idx+j) % _seq1.size();
-            inds[j] = _seq0._step*it*N+_seq1._step*jt + _seq0._first*N + _seq1._first;
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        const int ncols = _seq1.size();
+        return this->template teval<U>({int(idx) / ncols, int(idx) % ncols});
     }
 
     template<typename U=T>
@@ -77,8 +71,24 @@ public:
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,2>& as) const {
         SIMDVector<U,simd_abi_type> _vec;
-        if (_seq1._step==1) _vec.load(_expr.data()+_seq0._step*as[0]*N+as[1] + _seq0._first*N + _seq1._first,false);
-        else vector_setter(_vec,_expr.data(),_seq0._step*as[0]*N+_seq1._step*as[1] + _seq0._first*N + _seq1._first,_seq1._step);
+        const int ncols = _seq1.size();
+        if (as[1] + int(SIMDVector<U,simd_abi_type>::Size) <= ncols) {
+            if (_seq1._step==1) _vec.load(_expr.data()+_seq0._step*as[0]*N+as[1] + _seq0._first*N + _seq1._first,false);
+            else vector_setter(_vec,_expr.data(),_seq0._step*as[0]*N+_seq1._step*as[1] + _seq0._first*N + _seq1._first,_seq1._step);
+            return _vec;
+        }
+        // the vector straddles rows, fill the lanes one row segment at a time
+        int it = as[0], jt = as[1];
+        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
+        for (int j=0; j<int(SIMDVector<U,simd_abi_type>::Size);) {
+            const int row = _seq0._step*it*N + _seq0._first*N + _seq1._first;
+            const int n = std::min(int(SIMDVector<U,simd_abi_type>::Size)-j, ncols-jt);
+            for (int k=0; k<n; ++k) {
+                inds[j+k] = row + _seq1._step*(jt+k);
+            }
+            j += n; jt = 0; ++it;
+        }
+        vector_setter(_vec,_expr.data(),inds);
         return _vec;
     }
 
@@ -1112,14 +1122,8 @@ public:
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            auto it = (idx+j) / _seq1.size(), jt = (idx+j) % _seq1.size();
-            inds[j] = _seq0._step*it*N+_seq1._step*jt + _seq0._first*N + _seq1._first;
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        const int ncols = _seq1.size();
+        return this->template teval<U>({int(idx) / ncols, int(idx) % ncols});
     }
 
     template<typename U=T>
@@ -1145,8 +1149,24 @@ public:
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,2>& as) const {
         SIMDVector<U,simd_abi_type> _vec;
-        if (_seq1._step==1) _vec.load(_expr.data()+_seq0._step*as[0]*N+as[1] + _seq0._first*N + _seq1._first,false);
-        else vector_setter(_vec,_expr.data(),_seq0._step*as[0]*N+_seq1._step*as[1] + _seq0._first*N + _seq1._first,_seq1._step);
+        const int ncols = _seq1.size();
+        if (as[1] + int(SIMDVector<U,simd_abi_type>::Size) <= ncols) {
+            if (_seq1._step==1) _vec.load(_expr.data()+_seq0._step*as[0]*N+as[1] + _seq0._first*N + _seq1._first,false);
+            else vector_setter(_vec,_expr.data(),_seq0._step*as[0]*N+_seq1._step*as[1] + _seq0._first*N + _seq1._first,_seq1._step);
+            return _vec;
+        }
+        // the vector straddles rows, fill the lanes one row segment at a time
+        int it = as[0], jt = as[1];
+        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
+        for (int j=0; j<int(SIMDVector<U,simd_abi_type>::Size);) {
+            const int row = _seq0._step*it*N + _seq0._first*N + _seq1._first;
+            const int n = std::min(int(SIMDVector<U,simd_abi_type>::Size)-j, ncols-jt);
+            for (int k=0; k<n; ++k) {
+                inds[j+k] = row + _seq1._step*(jt+k);
+            }
+            j += n; jt = 0; ++it;
+        }
+        vector_setter(_vec,_expr.data(),inds);
         return _vec;
     }
 
@@ -10,6 +10,105 @@
 
 namespace Fastor {
 
+namespace internal {
+
+/* Walks the elements [first,last) of a dynamic view in row major order. The multi-dimensional index
+    is stepped through instead of being recovered from the flat index with a division per dimension
+    and SIMD lane, fv is called on every full SIMD vector, which may straddle rows, and fs on the rest
+*/
+template<typename V, size_t DIMS, typename ViewType, typename FV, typename FS>
+FASTOR_INLINE void view_for_each(const ViewType &src, FASTOR_INDEX first, FASTOR_INDEX last, const FV &fv, const FS &fs) {
+    if (first >= last) return;
+    std::array<int,DIMS> dims, as;
+    for (FASTOR_INDEX n=0; n<DIMS; ++n) dims[n] = src.dimension(n);
+    int remaining = int(first);
+    for (int n = int(DIMS)-1; n >= 0; --n) {
+        as[n] = remaining % dims[n];
+        remaining /= dims[n];
+    }
+
+    FASTOR_INDEX i = first;
+    for (; i + V::Size <= last; i+=V::Size) {
+        fv(i,as);
+        as[DIMS-1] += V::Size;
+        for (int n = int(DIMS)-1; n > 0; --n) {
+            while (as[n] >= dims[n]) {
+                as[n] -= dims[n];
+                ++as[n-1];
+            }
+        }
+    }
+    for (; i < last; ++i) {
+        fs(i,as);
+        for (int n = int(DIMS)-1; n >= 0; --n) {
+            if (++as[n] < dims[n] || n == 0) break;
+            as[n] = 0;
+        }
+    }
+}
+
+} // internal
+
+
+// Assigning multi-dimensional dynamic views
+//-----------------------------------------------------------------------------------------------------------//
+template<typename Derived, size_t DIM, typename ViewType, size_t OtherDIM>
+FASTOR_INLINE void dynamic_view_assign(AbstractTensor<Derived,DIM> &dst, const AbstractTensor<ViewType,OtherDIM> &src_) {
+    using T = typename Derived::scalar_type;
+    using V = typename Derived::simd_vector_type;
+    const ViewType &src = src_.self();
+    FASTOR_ASSERT(src.size()==dst.self().size(), "TENSOR SIZE MISMATCH");
+    T* _data = dst.self().data();
+
+    FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<ViewType>) {
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            internal::view_for_each<V,OtherDIM>(src, first, last,
+                [&](FASTOR_INDEX i, const std::array<int,OtherDIM> &as) {
+                    src.template teval<T>(as).store(&_data[i], false);
+                },
+                [&](FASTOR_INDEX i, const std::array<int,OtherDIM> &as) {
+                    _data[i] = src.template teval_s<T>(as);
+                });
+        });
+    }
+    else {
+        trivial_assign(dst.self(), src);
+    }
+}
+
+#define FASTOR_MAKE_DYNAMIC_VIEW_ASSIGNMENT(ASSIGN_TYPE, OP)\
+template<typename Derived, size_t DIM, typename ViewType, size_t OtherDIM>\
+FASTOR_INLINE void dynamic_view_assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const AbstractTensor<ViewType,OtherDIM> &src_) {\
+    using T = typename Derived::scalar_type;\
+    using V = typename Derived::simd_vector_type;\
+    const ViewType &src = src_.self();\
+    FASTOR_ASSERT(src.size()==dst.self().size(), "TENSOR SIZE MISMATCH");\
+    T* _data = dst.self().data();\
+\
+    FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<ViewType>) {\
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {\
+            internal::view_for_each<V,OtherDIM>(src, first, last,\
+                [&](FASTOR_INDEX i, const std::array<int,OtherDIM> &as) {\
+                    V _vec = V(&_data[i], false) OP src.template teval<T>(as);\
+                    _vec.store(&_data[i], false);\
+                },\
+                [&](FASTOR_INDEX i, const std::array<int,OtherDIM> &as) {\
+                    _data[i] = _data[i] OP src.template teval_s<T>(as);\
+                });\
+        });\
+    }\
+    else {\
+        trivial_assign ##ASSIGN_TYPE (dst.self(), src);\
+    }\
+}\
+
+FASTOR_MAKE_DYNAMIC_VIEW_ASSIGNMENT(_add, +)
+FASTOR_MAKE_DYNAMIC_VIEW_ASSIGNMENT(_sub, -)
+FASTOR_MAKE_DYNAMIC_VIEW_ASSIGNMENT(_mul, *)
+FASTOR_MAKE_DYNAMIC_VIEW_ASSIGNMENT(_div, /)
+//-----------------------------------------------------------------------------------------------------------//
+
+
 #define FASTOR_MAKE_ALL_TENSOR_VIEWS_ASSIGNMENT(ASSIGN_TYPE)\
 template<typename Derived, size_t DIM, typename TensorType, typename Seq>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorConstFixedViewExpr1D<TensorType,Seq,1>& src) {\
@@ -35,14 +134,22 @@ template<typename Derived, size_t DIM, typename TensorType, typename ... Fseq>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorFixedViewExprnD<TensorType,Fseq...>& src) {\
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
-template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM>\
+template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM, enable_if_t_<OtherDIM==1,bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorConstViewExpr<TensorType,OtherDIM>& src) {\
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
-template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM>\
+template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM, enable_if_t_<OtherDIM==1,bool> = false>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorViewExpr<TensorType,OtherDIM>& src) {\
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
 }\
+template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM, enable_if_t_<OtherDIM!=1,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorConstViewExpr<TensorType,OtherDIM>& src) {\
+    dynamic_view_assign ##ASSIGN_TYPE (dst.self(), src.self());\
+}\
+template<typename Derived, size_t DIM, typename TensorType, size_t OtherDIM, enable_if_t_<OtherDIM!=1,bool> = false>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorViewExpr<TensorType,OtherDIM>& src) {\
+    dynamic_view_assign ##ASSIGN_TYPE (dst.self(), src.self());\
+}\
 template<typename Derived, size_t DIM, typename TensorType, typename TensorIndexType>\
 FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const TensorConstRandomViewExpr<TensorType,TensorIndexType,DIM>& src) {\
     trivial_assign ##ASSIGN_TYPE (dst.self(), src.self());\
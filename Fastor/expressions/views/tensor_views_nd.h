@@ -70,86 +70,38 @@ public:
     }
 
 
+    // Splits a flat index in to the multi-dimensional index of the view
+    FASTOR_INLINE std::array<int,DIMS> multi_index(FASTOR_INDEX idx) const {
+        std::array<int,DIMS> as;
+        int remaining = int(idx);
+        for (int n = int(DIMS)-1; n >= 0; --n) {
+            as[n] = remaining % _dims[n];
+            remaining /= _dims[n];
+        }
+        return as;
+    }
+
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
-
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return this->template teval<U>(multi_index(idx));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx) const {
-
-        std::array<int,DIMS> as = {};
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return this->template teval_s<U>(multi_index(idx));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return this->template teval<U>(multi_index(idx+j));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-        idx += j;
-        std::array<int,DIMS> as = {};
-
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return this->template teval_s<U>(multi_index(idx+j));
     }
 
     template<typename U=T>
@@ -158,26 +110,33 @@ public:
         for(int it = 0; it< DIMS; it++) {
             ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
         }
-        if (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else if (_is_strided_vectorisable) {
+        // the vector lies within one row of the view
+        if (!is_same_v_<T,bool> && as[DIMS-1] + int(SIMDVector<U,simd_abi_type>::Size) <= _dims[DIMS-1]) {
+            if (_seqs[DIMS-1]._step==1) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
             SIMDVector<U,simd_abi_type> _vec;
             vector_setter(_vec,_expr.data(),ind,_seqs[DIMS-1]._step);
             return _vec;
         }
         else {
-            // return eval(ind);
-
+            // the vector straddles rows, fill the lanes one row segment at a time and only
+            // carry in to the outer dimensions when a row is exhausted
             SIMDVector<U,simd_abi_type> _vec;
             std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
             std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
+            const int last_stride = products_[DIMS-1]*_seqs[DIMS-1]._step;
+            for (int j=0; j<int(SIMDVector<U,simd_abi_type>::Size);) {
                 int _sum = 0;
                 for(int it = 0; it< DIMS; it++) {
                     _sum += products_[it]*as_[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
                 }
-                inds[j] = _sum;
+                const int n = std::min(int(SIMDVector<U,simd_abi_type>::Size)-j, _dims[DIMS-1]-as_[DIMS-1]);
+                for (int k=0; k<n; ++k) {
+                    inds[j+k] = _sum + k*last_stride;
+                }
+                j += n;
 
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
+                as_[DIMS-1] = 0;
+                for(int jt = (int)DIMS-2; jt>=0; jt--)
                 {
                   as_[jt] +=1;
                   if(as_[jt]<_dims[jt])
@@ -201,6 +160,9 @@ public:
         return _expr.data()[ind];
     }
 };
+
+template<template<typename,size_t...> class TensorType, typename T, size_t DIMS, size_t ... Rest>
+constexpr std::array<size_t,DIMS> TensorConstViewExpr<TensorType<T,Rest...>,DIMS>::products_;
 //----------------------------------------------------------------------------------------------//
 
 
@@ -1537,86 +1499,38 @@ public:
     }
     //----------------------------------------------------------------------------------//
 
+    // Splits a flat index in to the multi-dimensional index of the view
+    FASTOR_INLINE std::array<int,DIMS> multi_index(FASTOR_INDEX idx) const {
+        std::array<int,DIMS> as;
+        int remaining = int(idx);
+        for (int n = int(DIMS)-1; n >= 0; --n) {
+            as[n] = remaining % _dims[n];
+            remaining /= _dims[n];
+        }
+        return as;
+    }
+
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
-
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return this->template teval<U>(multi_index(idx));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx) const {
-
-        std::array<int,DIMS> as = {};
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return this->template teval_s<U>(multi_index(idx));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return this->template teval<U>(multi_index(idx+j));
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        std::array<int,DIMS> as = {};
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return this->template teval_s<U>(multi_index(idx+j));
     }
 
     template<typename U=T>
@@ -1625,26 +1539,33 @@ public:
         for(int it = 0; it< DIMS; it++) {
             ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
         }
-        if (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else if (_is_strided_vectorisable) {
+        // the vector lies within one row of the view
+        if (!is_same_v_<T,bool> && as[DIMS-1] + int(SIMDVector<U,simd_abi_type>::Size) <= _dims[DIMS-1]) {
+            if (_seqs[DIMS-1]._step==1) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
             SIMDVector<U,simd_abi_type> _vec;
             vector_setter(_vec,_expr.data(),ind,_seqs[DIMS-1]._step);
             return _vec;
         }
         else {
-            // return eval(ind);
-
+            // the vector straddles rows, fill the lanes one row segment at a time and only
+            // carry in to the outer dimensions when a row is exhausted
             SIMDVector<U,simd_abi_type> _vec;
             std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
             std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
+            const int last_stride = products_[DIMS-1]*_seqs[DIMS-1]._step;
+            for (int j=0; j<int(SIMDVector<U,simd_abi_type>::Size);) {
                 int _sum = 0;
                 for(int it = 0; it< DIMS; it++) {
                     _sum += products_[it]*as_[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
                 }
-                inds[j] = _sum;
+                const int n = std::min(int(SIMDVector<U,simd_abi_type>::Size)-j, _dims[DIMS-1]-as_[DIMS-1]);
+                for (int k=0; k<n; ++k) {
+                    inds[j+k] = _sum + k*last_stride;
+                }
+                j += n;
 
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
+                as_[DIMS-1] = 0;
+                for(int jt = (int)DIMS-2; jt>=0; jt--)
                 {
                   as_[jt] +=1;
                   if(as_[jt]<_dims[jt])
@@ -455,6 +455,20 @@ template<class Idx0, class Idx1>
 constexpr bool is_pair_reduction_v = is_pair_reduction<Idx0,Idx1>::value;
 
 
+// This is for the outer product of a pair, no index is shared or repeated
+template<class Idx0, class Idx1>
+struct is_pair_outer;
+
+template<size_t ... Idx0, size_t ... Idx1>
+struct is_pair_outer<Index<Idx0...>,Index<Idx1...>> {
+    static constexpr bool value = no_of_unique<Idx0...,Idx1...>::value == sizeof...(Idx0)+sizeof...(Idx1);
+};
+
+// helper
+template<class Idx0, class Idx1>
+constexpr bool is_pair_outer_v = is_pair_outer<Idx0,Idx1>::value;
+
+
 // Reduction for a single tensor
 template<class Idx, class Tens>
 struct is_single_reduction;
@@ -649,6 +663,164 @@ struct is_generalised_matrix_matrix<Index<Idx0...>,Index<Idx1...> > {
     static constexpr bool value = !is_mat_vec && !is_vec_mat && !is_inner && match_indices_from_two_ends(idx0, idx1, ncontracted);
 };
 //--------------------------------------------------------------------------------------------------------------------//
+
+
+// Transpose-transpose-gemm-transpose (TTGT) lowering of by-pair contractions
+//--------------------------------------------------------------------------------------------------------------------//
+//! Any by-pair contraction C = A * B can be computed as a matrix-matrix product
+//! once the free indices of A are grouped in to the rows of a matrix, the contracted
+//! indices in to its columns and vice versa for B. The grouping requires a permutation
+//! of A and/or B which are skipped if they are identities. The result of the matrix-matrix
+//! product has the free indices of A followed by the free indices of B which is
+//! the order einsum returns. Alternatively the transposed product B^T * A^T can be
+//! computed followed by a transpose of the output, if this avoids permuting the operands.
+
+//! Position of value in ind or N if not found
+template<size_t N>
+constexpr inline size_t ttgt_find(const size_t (&ind)[N], size_t value) {
+    for (size_t i=0; i<N; ++i) {
+        if (ind[i] == value) return i;
+    }
+    return N;
+}
+
+//! Position in ind0 of the n-th index of ind0 that is contracted with ind1
+//! if contracted is true or the n-th free index of ind0 otherwise
+template<size_t N0, size_t N1>
+constexpr inline size_t ttgt_nth(const size_t (&ind0)[N0], const size_t (&ind1)[N1], size_t n, bool contracted) {
+    for (size_t i=0; i<N0; ++i) {
+        if ((ttgt_find(ind1,ind0[i]) != N1) == contracted) {
+            if (n == 0) return i;
+            --n;
+        }
+    }
+    return N0;
+}
+
+//! Number of indices of ind0 that are contracted with ind1
+template<size_t N0, size_t N1>
+constexpr inline size_t ttgt_ncontracted(const size_t (&ind0)[N0], const size_t (&ind1)[N1]) {
+    size_t n = 0;
+    for (size_t i=0; i<N0; ++i) {
+        if (ttgt_find(ind1,ind0[i]) != N1) ++n;
+    }
+    return n;
+}
+
+//! Product of the dimensions of ind0 that are contracted with ind1 if contracted
+//! is true or the product of the free dimensions otherwise
+template<size_t N0, size_t N1>
+constexpr inline size_t ttgt_product(const size_t (&ind0)[N0], const size_t (&ind1)[N1], const size_t (&dims0)[N0], bool contracted) {
+    size_t prod = 1;
+    for (size_t i=0; i<N0; ++i) {
+        if ((ttgt_find(ind1,ind0[i]) != N1) == contracted) prod *= dims0[i];
+    }
+    return prod;
+}
+
+//! The position in ind0 of the p-th dimension of its matrix layout. The free indices
+//! come first if free_first is true and the contracted indices are ordered as they appear
+//! in ind0 if contracted_as_in_0 is true or as they appear in ind1 otherwise
+template<size_t N0, size_t N1>
+constexpr inline size_t ttgt_permutation(const size_t (&ind0)[N0], const size_t (&ind1)[N1],
+    size_t p, bool free_first, bool contracted_as_in_0) {
+    const size_t ncontracted = ttgt_ncontracted(ind0,ind1);
+    const size_t nfree = N0 - ncontracted;
+    const bool is_free = free_first ? p < nfree : p >= ncontracted;
+    if (is_free) {
+        return ttgt_nth(ind0, ind1, free_first ? p : p - ncontracted, false);
+    }
+    const size_t n = free_first ? p - nfree : p;
+    return contracted_as_in_0 ? ttgt_nth(ind0, ind1, n, true) : ttgt_find(ind0, ind1[ttgt_nth(ind1, ind0, n, true)]);
+}
+
+//! Is the matrix layout of ind0 the same as its memory layout
+template<size_t N0, size_t N1>
+constexpr inline bool ttgt_is_identity(const size_t (&ind0)[N0], const size_t (&ind1)[N1],
+    bool free_first, bool contracted_as_in_0) {
+    for (size_t p=0; p<N0; ++p) {
+        if (ttgt_permutation(ind0, ind1, p, free_first, contracted_as_in_0) != p) return false;
+    }
+    return true;
+}
+
+//! Number of elements that are copied for a given layout: the operands that need to be
+//! permuted and the output if the transposed product is computed
+template<size_t N0, size_t N1>
+constexpr inline size_t ttgt_cost(const size_t (&ind0)[N0], const size_t (&ind1)[N1],
+    size_t M, size_t K, size_t N, bool transposed, bool contracted_as_in_0) {
+    return (ttgt_is_identity(ind0, ind1, !transposed,  contracted_as_in_0) ? 0 : M*K) +
+           (ttgt_is_identity(ind1, ind0,  transposed, !contracted_as_in_0) ? 0 : K*N) +
+           (transposed && M != 1 && N != 1 ? M*N : 0);
+}
+
+
+//! Is the by-pair contraction one that is lowered to a matrix-matrix product.
+//! Every index has to appear once per tensor, at least one index has to be
+//! contracted and the contraction should not be one that is already dispatched
+//! to a matrix-matrix/matrix-vector product or an inner product
+template<class Idx0, class Idx1>
+struct is_ttgt_contraction;
+
+template<size_t ... Idx0, size_t ... Idx1>
+struct is_ttgt_contraction<Index<Idx0...>,Index<Idx1...> > {
+    static constexpr bool value = no_of_unique<Idx0...>::value == sizeof...(Idx0) &&
+                                  no_of_unique<Idx1...>::value == sizeof...(Idx1) &&
+                                  no_of_unique<Idx0...,Idx1...>::value != sizeof...(Idx0)+sizeof...(Idx1) &&
+                                  !is_pair_reduction<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_matrix_vector<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_vector_matrix<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_matrix_matrix<Index<Idx0...>,Index<Idx1...>>::value;
+};
+
+template<class Idx0, class Idx1, class Seq, bool FreeFirst, bool ContractedAsIn0>
+struct ttgt_permutation_index;
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... ss, bool FreeFirst, bool ContractedAsIn0>
+struct ttgt_permutation_index<Index<Idx0...>,Index<Idx1...>,std_ext::index_sequence<ss...>,FreeFirst,ContractedAsIn0> {
+    static constexpr size_t idx0[sizeof...(Idx0)] = {Idx0...};
+    static constexpr size_t idx1[sizeof...(Idx1)] = {Idx1...};
+    using type = Index<ttgt_permutation(idx0, idx1, ss, FreeFirst, ContractedAsIn0)...>;
+};
+
+//! The TTGT plan of a contraction: sizes of the matrix-matrix product, whether the
+//! transposed product is computed and the permutations of the operands. The permutations
+//! are given by position so they can be used directly with permute
+template<class Idx0, class Idx1, class Dims0, class Dims1>
+struct ttgt_contraction;
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... Rest0, size_t ... Rest1>
+struct ttgt_contraction<Index<Idx0...>,Index<Idx1...>,Index<Rest0...>,Index<Rest1...> > {
+    static constexpr size_t idx0[sizeof...(Idx0)] = {Idx0...};
+    static constexpr size_t idx1[sizeof...(Idx1)] = {Idx1...};
+    static constexpr size_t dims0[sizeof...(Rest0)] = {Rest0...};
+    static constexpr size_t dims1[sizeof...(Rest1)] = {Rest1...};
+
+    static constexpr size_t M = ttgt_product(idx0, idx1, dims0, false);
+    static constexpr size_t K = ttgt_product(idx0, idx1, dims0, true);
+    static constexpr size_t N = ttgt_product(idx1, idx0, dims1, false);
+
+    // pick the cheapest of the four layouts
+    static constexpr size_t cost00 = ttgt_cost(idx0, idx1, M, K, N, false, true);
+    static constexpr size_t cost01 = ttgt_cost(idx0, idx1, M, K, N, false, false);
+    static constexpr size_t cost10 = ttgt_cost(idx0, idx1, M, K, N, true,  true);
+    static constexpr size_t cost11 = ttgt_cost(idx0, idx1, M, K, N, true,  false);
+    static constexpr size_t cost0  = cost00 <= cost01 ? cost00 : cost01;
+    static constexpr size_t cost1  = cost10 <= cost11 ? cost10 : cost11;
+
+    static constexpr bool is_transposed = cost1 < cost0;
+    static constexpr bool contracted_as_in_0 = is_transposed ? cost10 <= cost11 : cost00 <= cost01;
+
+    static constexpr bool requires_permutation_0 = !ttgt_is_identity(idx0, idx1, !is_transposed,  contracted_as_in_0);
+    static constexpr bool requires_permutation_1 = !ttgt_is_identity(idx1, idx0,  is_transposed, !contracted_as_in_0);
+    static constexpr bool requires_transpose = is_transposed && M != 1 && N != 1;
+
+    using permutation_0 = typename ttgt_permutation_index<Index<Idx0...>,Index<Idx1...>,
+        typename std_ext::make_index_sequence<sizeof...(Idx0)>::type, !is_transposed,  contracted_as_in_0>::type;
+    using permutation_1 = typename ttgt_permutation_index<Index<Idx1...>,Index<Idx0...>,
+        typename std_ext::make_index_sequence<sizeof...(Idx1)>::type,  is_transposed, !contracted_as_in_0>::type;
+};
+//--------------------------------------------------------------------------------------------------------------------//
 } // namespace internal
 
 
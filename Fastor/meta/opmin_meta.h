@@ -49,513 +49,302 @@ struct pair_flop_cost<Index<>,Index<>,Tensor<T>,Tensor<T>,std_ext::index_sequenc
 
 
 
-// Cost of triplet tensor contraction (single evaluation)
+// Cost model for tensor network contraction
 //------------------------------------------------------------------------------------------------------------//
-template<class Ind0, class Ind1, class Ind2, class Tensor0, class Tensor1, class Tensor2>
-struct single_evaluation_triplet_cost;
-
-template<class T, size_t... Idx0, size_t... Idx1, size_t... Idx2, size_t ...Rest0, size_t ...Rest1, size_t ...Rest2>
-struct single_evaluation_triplet_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,
-        Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>> {
-
-    using concat_tensor_01 = typename no_of_loops_to_set<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<no_of_unique<Idx0...,Idx1...>::value>::type>::type;
-
-    using concat_index_01 = typename no_of_loops_to_set<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<no_of_unique<Idx0...,Idx1...>::value>::type>::indices;
-
-    static constexpr size_t value = pair_flop_cost<concat_index_01,Index<Idx2...>,concat_tensor_01,Tensor<T,Rest2...>,
-                    typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
+// The network is described by the flattened indices of all its operands. Sub-networks
+// (intermediate tensors) are represented as bitmasks of the operands they are made of
+// and the contraction order is found at compile time, exhaustively using dynamic
+// programming over all sub-networks for small networks and greedily otherwise.
+// The cost of contracting two sub-networks is the number of loop iterations plus the
+// number of elements read from both operands and written to the result, so that among
+// orderings with similar flop counts the one producing smaller intermediates wins
+namespace internal {
+
+constexpr size_t opmin_popcount(size_t mask) {
+    size_t count = 0;
+    for (; mask; mask &= mask - 1) ++count;
+    return count;
+}
+
+constexpr size_t opmin_first(size_t mask) {
+    size_t i = 0;
+    for (; !(mask & 1); mask >>= 1) ++i;
+    return i;
+}
+
+template<size_t NT, size_t NI>
+struct opmin_network {
+    // dimension of every index
+    size_t dims[NI];
+    // the operand every index belongs to
+    size_t owner[NI];
+    // the operand the index is contracted with and NT for free indices
+    size_t partner[NI];
+    // product of the dimensions of the indices shared between two operands
+    size_t link[NT][NT];
 };
-//------------------------------------------------------------------------------------------------------------//
-
-
-
-
-// Cost model for triplet tensor network contraction
-//------------------------------------------------------------------------------------------------------------//
-template<class Ind0, class Ind1, class Ind2, class Tensor0, class Tensor1, class Tensor2>
-struct triplet_flop_cost;
-
-template<class T, size_t... Idx0, size_t... Idx1, size_t... Idx2, size_t ...Rest0, size_t ...Rest1, size_t ...Rest2>
-struct triplet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,
-        Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>> {
-
-    // Perform depth-first search
-    //---------------------------------------------------------------------
-    // first two tensors contracted first
-    using resulting_tensor_0 =  typename get_resuling_tensor<Index<Idx0...>,Index<Idx1...>,
-                                    Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-    using resulting_index_0 =  typename get_resuling_index<Index<Idx0...>,Index<Idx1...>,
-                                    Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-
-    static constexpr size_t flop_count_01_0 = pair_flop_cost<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::value;
-
-    static constexpr size_t flop_count_01_1 = pair_flop_cost<resulting_index_0,Index<Idx2...>,resulting_tensor_0,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_01 = flop_count_01_0 + flop_count_01_1;
-
-
-    // first and last tensors contracted first
-    using resulting_tensor_1 =  typename get_resuling_tensor<Index<Idx0...>,Index<Idx2...>,
-                                    Tensor<T,Rest0...>,Tensor<T,Rest2...>>::type;
-    using resulting_index_1 =  typename get_resuling_index<Index<Idx0...>,Index<Idx2...>,
-                                    Tensor<T,Rest0...>,Tensor<T,Rest2...>>::type;
-
-    static constexpr size_t flop_count_02_0 = pair_flop_cost<Index<Idx0...>,Index<Idx2...>,Tensor<T,Rest0...>,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_02_1 = pair_flop_cost<resulting_index_1,Index<Idx1...>,resulting_tensor_1,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::value;
-
-    static constexpr size_t flop_count_02 = flop_count_02_0 + flop_count_02_1;
-
-
-    // second and last tensors contracted first
-    using resulting_tensor_2 =  typename get_resuling_tensor<Index<Idx1...>,Index<Idx2...>,
-                                    Tensor<T,Rest1...>,Tensor<T,Rest2...>>::type;
-    using resulting_index_2 =  typename get_resuling_index<Index<Idx1...>,Index<Idx2...>,
-                                    Tensor<T,Rest1...>,Tensor<T,Rest2...>>::type;
-
-    static constexpr size_t flop_count_12_0 = pair_flop_cost<Index<Idx1...>,Index<Idx2...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_12_1 = pair_flop_cost<resulting_index_2,Index<Idx0...>,resulting_tensor_2,Tensor<T,Rest0...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest0)>::type>::value;
-
-    static constexpr size_t flop_count_12 = flop_count_12_0 + flop_count_12_1;
-
-    static constexpr size_t flop_count_012 = single_evaluation_triplet_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>>::value;
-
-    static constexpr size_t min_cost = meta_min<flop_count_01,flop_count_02,flop_count_12,flop_count_012>::value;
-    static constexpr int which_variant = meta_argmin<flop_count_01,flop_count_02,flop_count_12,flop_count_012>::value;
-
-    // this is the overall resulting tensor and index from overall triplet contraction
-    using resulting_tensor = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_tensor<resulting_index_0,Index<Idx2...>,resulting_tensor_0,Tensor<T,Rest2...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_tensor<Index<Idx1...>,resulting_index_1,Tensor<T,Rest1...>,resulting_tensor_1>::type,
-            typename get_resuling_tensor<Index<Idx0...>,resulting_index_2,Tensor<T,Rest0...>,resulting_tensor_2>::type
-            >::type
-        >::type;
-
-    using resulting_index = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_index<resulting_index_0,Index<Idx2...>,resulting_tensor_0,Tensor<T,Rest2...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_index<Index<Idx1...>,resulting_index_1,Tensor<T,Rest1...>,resulting_tensor_1>::type,
-            typename get_resuling_index<Index<Idx0...>,resulting_index_2,Tensor<T,Rest0...>,resulting_tensor_2>::type
-            >::type
-        >::type;
 
+template<size_t NT, size_t NI>
+constexpr opmin_network<NT,NI> make_opmin_network(const std::array<size_t,NI> &idx,
+    const std::array<size_t,NI> &dims, const std::array<size_t,NT> &sizes) {
+    opmin_network<NT,NI> net{};
+    for (size_t p=0; p<NT; ++p)
+        for (size_t q=0; q<NT; ++q)
+            net.link[p][q] = 1;
+    for (size_t p=0, i=0; p<NT; ++p) {
+        for (size_t k=0; k<sizes[p]; ++k, ++i) {
+            net.dims[i] = dims[i];
+            net.owner[i] = p;
+        }
+    }
+    for (size_t i=0; i<NI; ++i) {
+        net.partner[i] = NT;
+        for (size_t j=0; j<NI; ++j) {
+            if (j != i && idx[j] == idx[i]) {
+                net.partner[i] = net.owner[j];
+                break;
+            }
+        }
+        if (net.partner[i] != NT && net.partner[i] != net.owner[i] && net.owner[i] < net.partner[i]) {
+            net.link[net.owner[i]][net.partner[i]] *= dims[i];
+            net.link[net.partner[i]][net.owner[i]] *= dims[i];
+        }
+    }
+    return net;
+}
+
+// number of elements of the tensor resulting from contracting all operands in mask
+template<size_t NT, size_t NI>
+constexpr size_t opmin_size(const opmin_network<NT,NI> &net, size_t mask) {
+    size_t size = 1;
+    for (size_t i=0; i<NI; ++i) {
+        if (((mask >> net.owner[i]) & 1) && (net.partner[i] == NT || !((mask >> net.partner[i]) & 1))) {
+            size *= net.dims[i];
+        }
+    }
+    return size;
+}
+
+template<size_t NT, size_t NI>
+constexpr size_t opmin_shared(const opmin_network<NT,NI> &net, size_t mask0, size_t mask1) {
+    size_t shared = 1;
+    for (size_t p=0; p<NT; ++p) {
+        if (!((mask0 >> p) & 1)) continue;
+        for (size_t q=0; q<NT; ++q) {
+            if ((mask1 >> q) & 1) shared *= net.link[p][q];
+        }
+    }
+    return shared;
+}
+
+// flops plus memory traffic of contracting two intermediates of size0 and size1
+template<size_t NT, size_t NI>
+constexpr size_t opmin_pair_cost(const opmin_network<NT,NI> &net, size_t mask0, size_t size0, size_t mask1, size_t size1) {
+    const size_t shared = opmin_shared(net, mask0, mask1);
+    const size_t flops  = size0 * size1 / shared;
+    return flops + size0 + size1 + flops / shared;
+}
+
+// A contraction path is a binary tree stored as the list of its internal nodes
+// with every node given by the masks of its two children. By convention the
+// left child is always the one containing the lowest numbered operand
+template<size_t NT>
+struct opmin_path {
+    size_t left[NT];
+    size_t right[NT];
+    size_t nodes;
+    size_t cost;
 };
-//------------------------------------------------------------------------------------------------------------//
-
-
-
-
-
-// Cost model for quartet tensor network contraction
-//------------------------------------------------------------------------------------------------------------//
-template<class Ind0, class Ind1, class Ind2, class Ind3, class Tensor0, class Tensor1, class Tensor2, class Tensor3>
-struct quartet_flop_cost;
-
-template<class T, size_t... Idx0, size_t... Idx1, size_t... Idx2, size_t... Idx3,
-         size_t ...Rest0, size_t ...Rest1, size_t ...Rest2, size_t ...Rest3>
-struct quartet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,
-        Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>> {
-
-    // Perform depth-first search
-    //---------------------------------------------------------------------
-    // first three tensors contracted first
-    using triplet_cost_012 = triplet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>>;
-
-    using resulting_tensor_0 = typename triplet_cost_012::resulting_tensor;
-    using resulting_index_0  = typename triplet_cost_012::resulting_index;
-
-    static constexpr size_t flop_count_012 = triplet_cost_012::min_cost;
-    static constexpr size_t flop_count_012_3 = pair_flop_cost<resulting_index_0,Index<Idx3...>,resulting_tensor_0,Tensor<T,Rest3...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest3)>::type>::value;
-
-    static constexpr size_t flop_count_0 = flop_count_012 + flop_count_012_3;
-
-
-    // first, second and last tensors contracted first
-    using triplet_cost_013 = triplet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest3...>>;
-
-    using resulting_tensor_1 = typename triplet_cost_013::resulting_tensor;
-    using resulting_index_1  = typename triplet_cost_013::resulting_index;
-
-    static constexpr size_t flop_count_013 = triplet_cost_013::min_cost;
-    static constexpr size_t flop_count_013_2 = pair_flop_cost<resulting_index_1,Index<Idx2...>,resulting_tensor_1,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_1 = flop_count_013 + flop_count_013_2;
-
-
-    // first, third and last tensors contracted first
-    using triplet_cost_023 = triplet_flop_cost<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>>;
-
-    using resulting_tensor_2 = typename triplet_cost_023::resulting_tensor;
-    using resulting_index_2  = typename triplet_cost_023::resulting_index;
-
-    static constexpr size_t flop_count_023 = triplet_cost_023::min_cost;
-    static constexpr size_t flop_count_023_1 = pair_flop_cost<resulting_index_2,Index<Idx1...>,resulting_tensor_2,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::value;
-
-    static constexpr size_t flop_count_2 = flop_count_023 + flop_count_023_1;
-
-
-    // last three tensors contracted first
-    using triplet_cost_123 = triplet_flop_cost<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,
-            Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>>;
-
-    using resulting_tensor_3 = typename triplet_cost_123::resulting_tensor;
-    using resulting_index_3  = typename triplet_cost_123::resulting_index;
-
-    static constexpr size_t flop_count_123 = triplet_cost_123::min_cost;
-    static constexpr size_t flop_count_123_0 = pair_flop_cost<resulting_index_3,Index<Idx0...>,resulting_tensor_3,Tensor<T,Rest0...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest0)>::type>::value;
-
-    static constexpr size_t flop_count_3 = flop_count_123 + flop_count_123_0;
-
-    static constexpr size_t min_cost = meta_min<flop_count_0,flop_count_1,flop_count_2,flop_count_3>::value;
-    static constexpr int which_variant = meta_argmin<flop_count_0,flop_count_1,flop_count_2,flop_count_3>::value;
-
-
-    // this is the overall resulting tensor and index from overall quartet contraction
-    using resulting_tensor = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_tensor<resulting_index_0,Index<Idx3...>,resulting_tensor_0,Tensor<T,Rest3...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_tensor<Index<Idx2...>,resulting_index_1,Tensor<T,Rest2...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_tensor<Index<Idx1...>,resulting_index_2,Tensor<T,Rest1...>,resulting_tensor_2>::type,
-                typename get_resuling_tensor<Index<Idx0...>,resulting_index_3,Tensor<T,Rest0...>,resulting_tensor_3>::type
-                >::type
-            >::type
-        >::type;
-
-    using resulting_index = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_index<resulting_index_0,Index<Idx3...>,resulting_tensor_0,Tensor<T,Rest3...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_index<Index<Idx2...>,resulting_index_1,Tensor<T,Rest2...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_index<Index<Idx1...>,resulting_index_2,Tensor<T,Rest1...>,resulting_tensor_2>::type,
-                typename get_resuling_index<Index<Idx0...>,resulting_index_3,Tensor<T,Rest0...>,resulting_tensor_3>::type
-                >::type
-            >::type
-        >::type;
 
+template<size_t NT>
+constexpr void opmin_add_node(opmin_path<NT> &path, size_t mask0, size_t mask1) {
+    if (opmin_first(mask1) < opmin_first(mask0)) {
+        const size_t tmp = mask0; mask0 = mask1; mask1 = tmp;
+    }
+    path.left[path.nodes]  = mask0;
+    path.right[path.nodes] = mask1;
+    ++path.nodes;
+}
+
+// exhaustive search
+template<size_t NT, size_t NI, enable_if_t_<(NT <= FASTOR_OPMIN_MAX_DP_OPERANDS), bool> = false>
+constexpr opmin_path<NT> opmin_find_path(const opmin_network<NT,NI> &net) {
+    constexpr size_t nmasks = size_t(1) << NT;
+    size_t size[nmasks] = {};
+    size_t cost[nmasks] = {};
+    size_t best[nmasks] = {};
+
+    for (size_t mask=1; mask<nmasks; ++mask) {
+        size[mask] = opmin_size(net, mask);
+    }
+    // sub-networks are visited after all of their own sub-networks
+    for (size_t mask=1; mask<nmasks; ++mask) {
+        if (opmin_popcount(mask) < 2) continue;
+        const size_t lowest = mask & (~mask + 1);
+        cost[mask] = size_t(-1);
+        for (size_t sub=(mask-1) & mask; sub; sub=(sub-1) & mask) {
+            if (!(sub & lowest)) continue;
+            const size_t other = mask ^ sub;
+            const size_t c = cost[sub] + cost[other] + opmin_pair_cost(net, sub, size[sub], other, size[other]);
+            if (c < cost[mask]) {
+                cost[mask] = c;
+                best[mask] = sub;
+            }
+        }
+    }
+
+    opmin_path<NT> path{};
+    path.cost = cost[nmasks-1];
+    size_t stack[NT] = {};
+    size_t top = 0;
+    stack[top++] = nmasks-1;
+    while (top) {
+        const size_t mask = stack[--top];
+        if (opmin_popcount(mask) < 2) continue;
+        opmin_add_node(path, best[mask], mask ^ best[mask]);
+        stack[top++] = best[mask];
+        stack[top++] = mask ^ best[mask];
+    }
+    return path;
+}
+
+// greedy search, contracts the cheapest pair of intermediates first
+template<size_t NT, size_t NI, enable_if_t_<(NT > FASTOR_OPMIN_MAX_DP_OPERANDS), bool> = false>
+constexpr opmin_path<NT> opmin_find_path(const opmin_network<NT,NI> &net) {
+    static_assert(NT <= sizeof(size_t)*8, "TOO MANY TENSORS IN THE NETWORK");
+    size_t masks[NT] = {};
+    size_t sizes[NT] = {};
+    for (size_t p=0; p<NT; ++p) {
+        masks[p] = size_t(1) << p;
+        sizes[p] = opmin_size(net, masks[p]);
+    }
+
+    opmin_path<NT> path{};
+    for (size_t n=NT; n>1; --n) {
+        size_t best_cost = size_t(-1), best_i = 0, best_j = 1;
+        for (size_t i=0; i<n; ++i) {
+            for (size_t j=i+1; j<n; ++j) {
+                const size_t c = opmin_pair_cost(net, masks[i], sizes[i], masks[j], sizes[j]);
+                if (c < best_cost) {
+                    best_cost = c; best_i = i; best_j = j;
+                }
+            }
+        }
+        opmin_add_node(path, masks[best_i], masks[best_j]);
+        path.cost += best_cost;
+        masks[best_i] |= masks[best_j];
+        sizes[best_i] = opmin_size(net, masks[best_i]);
+        masks[best_j] = masks[n-1];
+        sizes[best_j] = sizes[n-1];
+    }
+    return path;
+}
+
+// the left child of the node that produces mask
+template<size_t NT>
+constexpr size_t opmin_left(const opmin_path<NT> &path, size_t mask) {
+    for (size_t i=0; i<path.nodes; ++i) {
+        if ((path.left[i] | path.right[i]) == mask) return path.left[i];
+    }
+    return 0;
+}
+
+} // internal
+
+
+// The contraction path as a type. opmin_operand<I> is the I-th operand of the
+// network and opmin_contract<Left,Right> is the by-pair einsum of two sub-paths
+template<size_t I>
+struct opmin_operand {};
+
+template<class Left, class Right>
+struct opmin_contract {};
+
+namespace internal {
+template<class Network, size_t Mask, bool = (opmin_popcount(Mask) == 1)>
+struct opmin_tree {
+    using type = opmin_operand<opmin_first(Mask)>;
 };
-//------------------------------------------------------------------------------------------------------------//
-
-
-
-
-
-
-// Cost model for quintet tensor contraction
-//------------------------------------------------------------------------------------------------------------//
-template<class Ind0, class Ind1, class Ind2, class Ind3, class Ind4,
-         class Tensor0, class Tensor1, class Tensor2, class Tensor3, class Tensor4>
-struct quintet_flop_cost;
-
-template<class T, size_t... Idx0, size_t... Idx1, size_t... Idx2, size_t... Idx3, size_t... Idx4,
-         size_t ...Rest0, size_t ...Rest1, size_t ...Rest2, size_t ...Rest3, size_t ...Rest4>
-struct quintet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>, Index<Idx4...>,
-        Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>> {
-
-    // Perform depth-first search
-    //---------------------------------------------------------------------
-    // first four tensors contracted first
-    using quartet_cost_0123 = quartet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>>;
-
-    using resulting_tensor_0 = typename quartet_cost_0123::resulting_tensor;
-    using resulting_index_0  = typename quartet_cost_0123::resulting_index;
-
-    static constexpr size_t flop_count_0123 = quartet_cost_0123::min_cost;
-    static constexpr size_t flop_count_0123_4 = pair_flop_cost<resulting_index_0,Index<Idx4...>,resulting_tensor_0,Tensor<T,Rest4...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest4)>::type>::value;
-
-    static constexpr size_t flop_count_0 = flop_count_0123 + flop_count_0123_4;
-
-
-    // 1st, 2nd, 3rd, 5th tensors contracted first
-    using quartet_cost_0124 = quartet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx4...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest4...>>;
-
-    using resulting_tensor_1 = typename quartet_cost_0124::resulting_tensor;
-    using resulting_index_1  = typename quartet_cost_0124::resulting_index;
-
-    static constexpr size_t flop_count_0124 = quartet_cost_0124::min_cost;
-    static constexpr size_t flop_count_0124_3 = pair_flop_cost<resulting_index_1,Index<Idx3...>,resulting_tensor_1,Tensor<T,Rest3...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest3)>::type>::value;
-
-    static constexpr size_t flop_count_1 = flop_count_0124 + flop_count_0124_3;
-
-
-    // 1st, 2nd, 4th, 5th tensors contracted first
-    using quartet_cost_0134 = quartet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>,Index<Idx4...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>;
-
-    using resulting_tensor_2 = typename quartet_cost_0134::resulting_tensor;
-    using resulting_index_2  = typename quartet_cost_0134::resulting_index;
-
-    static constexpr size_t flop_count_0134 = quartet_cost_0134::min_cost;
-    static constexpr size_t flop_count_0134_2 = pair_flop_cost<resulting_index_2,Index<Idx2...>,resulting_tensor_2,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_2 = flop_count_0134 + flop_count_0134_2;
-
-
-    // 1st, 3rd, 4th, 5th tensors contracted first
-    using quartet_cost_0234 = quartet_flop_cost<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>;
-
-    using resulting_tensor_3 = typename quartet_cost_0234::resulting_tensor;
-    using resulting_index_3  = typename quartet_cost_0234::resulting_index;
-
-    static constexpr size_t flop_count_0234 = quartet_cost_0234::min_cost;
-    static constexpr size_t flop_count_0234_1 = pair_flop_cost<resulting_index_3,Index<Idx1...>,resulting_tensor_3,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::value;
-
-    static constexpr size_t flop_count_3 = flop_count_0234 + flop_count_0234_1;
-
-
-    // last four tensors contracted first
-    using quartet_cost_1234 = quartet_flop_cost<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,
-            Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>;
-
-    using resulting_tensor_4 = typename quartet_cost_1234::resulting_tensor;
-    using resulting_index_4  = typename quartet_cost_1234::resulting_index;
-
-    static constexpr size_t flop_count_1234 = quartet_cost_1234::min_cost;
-    static constexpr size_t flop_count_1234_0 = pair_flop_cost<resulting_index_4,Index<Idx0...>,resulting_tensor_4,Tensor<T,Rest0...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest0)>::type>::value;
-
-    static constexpr size_t flop_count_4 = flop_count_1234 + flop_count_1234_0;
-
-
-    static constexpr size_t min_cost = meta_min<flop_count_0,flop_count_1,flop_count_2,flop_count_3,flop_count_4>::value;
-    static constexpr int which_variant = meta_argmin<flop_count_0,flop_count_1,flop_count_2,flop_count_3,flop_count_4>::value;
-
-
-    // this is the overall resulting tensor and index from overall quintet contraction
-    using resulting_tensor = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_tensor<resulting_index_0,Index<Idx4...>,resulting_tensor_0,Tensor<T,Rest4...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_tensor<Index<Idx3...>,resulting_index_1,Tensor<T,Rest3...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_tensor<Index<Idx2...>,resulting_index_2,Tensor<T,Rest2...>,resulting_tensor_2>::type,
-                typename std::conditional<
-                    which_variant==3,
-                    typename get_resuling_tensor<Index<Idx1...>,resulting_index_3,Tensor<T,Rest1...>,resulting_tensor_3>::type,
-                    typename get_resuling_tensor<Index<Idx0...>,resulting_index_4,Tensor<T,Rest0...>,resulting_tensor_4>::type
-                    >::type
-                >::type
-            >::type
-        >::type;
-
-    using resulting_index = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_index<resulting_index_0,Index<Idx4...>,resulting_tensor_0,Tensor<T,Rest4...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_index<Index<Idx3...>,resulting_index_1,Tensor<T,Rest3...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_index<Index<Idx2...>,resulting_index_2,Tensor<T,Rest2...>,resulting_tensor_2>::type,
-                typename std::conditional<
-                    which_variant==3,
-                    typename get_resuling_index<Index<Idx1...>,resulting_index_3,Tensor<T,Rest1...>,resulting_tensor_3>::type,
-                    typename get_resuling_index<Index<Idx0...>,resulting_index_4,Tensor<T,Rest0...>,resulting_tensor_4>::type
-                    >::type
-                >::type
-            >::type
-        >::type;
 
+template<class Network, size_t Mask>
+struct opmin_tree<Network,Mask,false> {
+    static constexpr size_t left_mask = opmin_left(Network::path, Mask);
+    using type = opmin_contract<typename opmin_tree<Network,left_mask>::type,
+                                typename opmin_tree<Network,Mask ^ left_mask>::type>;
 };
-//------------------------------------------------------------------------------------------------------------//
-
-
-
-
-// Cost model for sixtet tensor contraction
-//------------------------------------------------------------------------------------------------------------//
-template<class Ind0, class Ind1, class Ind2, class Ind3, class Ind4, class Ind5,
-         class Tensor0, class Tensor1, class Tensor2, class Tensor3, class Tensor4, class Tensor5>
-struct sixtet_flop_cost;
-
-template<class T, size_t... Idx0, size_t... Idx1, size_t... Idx2, size_t... Idx3, size_t... Idx4, size_t... Idx5,
-         size_t ...Rest0, size_t ...Rest1, size_t ...Rest2, size_t ...Rest3, size_t ...Rest4, size_t ...Rest5>
-struct sixtet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>, Index<Idx4...>, Index<Idx5...>,
-        Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>> {
-
-    // Perform depth-first search
-    //---------------------------------------------------------------------
-    // first 5 tensors contracted first
-    using quintet_cost_01234 = quintet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>;
-
-    using resulting_tensor_0 = typename quintet_cost_01234::resulting_tensor;
-    using resulting_index_0  = typename quintet_cost_01234::resulting_index;
-
-    static constexpr size_t flop_count_01234 = quintet_cost_01234::min_cost;
-    static constexpr size_t flop_count_01234_5 = pair_flop_cost<resulting_index_0,Index<Idx5...>,resulting_tensor_0,Tensor<T,Rest5...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest5)>::type>::value;
-
-    static constexpr size_t flop_count_0 = flop_count_01234 + flop_count_01234_5;
-
-
-    // 1st, 2nd, 3rd, 4th, 6th tensors contracted first
-    using quintet_cost_01235 = quintet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx5...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest5...>>;
-
-    using resulting_tensor_1 = typename quintet_cost_01235::resulting_tensor;
-    using resulting_index_1  = typename quintet_cost_01235::resulting_index;
-
-    static constexpr size_t flop_count_01235 = quintet_cost_01235::min_cost;
-    static constexpr size_t flop_count_01235_4 = pair_flop_cost<resulting_index_1,Index<Idx4...>,resulting_tensor_1,Tensor<T,Rest4...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest4)>::type>::value;
-
-    static constexpr size_t flop_count_1 = flop_count_01235 + flop_count_01235_4;
-
+} // internal
 
-    // 1st, 2nd, 3rd, 5th, 6th tensors contracted first
-    using quintet_cost_01245 = quintet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx4...>,Index<Idx5...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>;
 
-    using resulting_tensor_2 = typename quintet_cost_01245::resulting_tensor;
-    using resulting_index_2  = typename quintet_cost_01245::resulting_index;
+template<class Indices, class Tensors>
+struct network_opmin;
 
-    static constexpr size_t flop_count_01245 = quintet_cost_01235::min_cost;
-    static constexpr size_t flop_count_01245_3 = pair_flop_cost<resulting_index_2,Index<Idx3...>,resulting_tensor_2,Tensor<T,Rest3...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest3)>::type>::value;
+template<class ... Ind, class ... Tens>
+struct network_opmin<typelist<Ind...>,typelist<Tens...>> {
+    static constexpr size_t no_of_operands = sizeof...(Tens);
+    using index_type = typename concat_<Ind...>::type;
+    using dims_type  = typename concat_<typename put_dims_in_Index<Tens>::type...>::type;
+    static constexpr size_t no_of_indices = index_type::Size;
 
-    static constexpr size_t flop_count_2 = flop_count_01245 + flop_count_01245_3;
+    static_assert(sizeof...(Ind)==sizeof...(Tens), "NUMBER OF INDICES AND TENSORS IN THE NETWORK DO NOT MATCH");
 
+    using network_type = internal::opmin_network<no_of_operands,no_of_indices>;
+    using path_storage = internal::opmin_path<no_of_operands>;
 
-    // 1st, 2nd, 4th, 5th, 6th tensors contracted first
-    using quintet_cost_01345 = quintet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>;
+    static constexpr network_type network =
+        internal::make_opmin_network(index_type::values, dims_type::values,
+            std::array<size_t,no_of_operands>{{Ind::Size...}});
+    static constexpr path_storage path = internal::opmin_find_path(network);
 
-    using resulting_tensor_3 = typename quintet_cost_01345::resulting_tensor;
-    using resulting_index_3  = typename quintet_cost_01345::resulting_index;
+    // cost of the chosen path
+    static constexpr size_t min_cost = path.cost;
+    // the chosen path
+    using path_type = typename internal::opmin_tree<network_opmin,(size_t(1) << (no_of_operands-1))*2-1>::type;
 
-    static constexpr size_t flop_count_01345 = quintet_cost_01235::min_cost;
-    static constexpr size_t flop_count_01345_2 = pair_flop_cost<resulting_index_3,Index<Idx2...>,resulting_tensor_3,Tensor<T,Rest2...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest2)>::type>::value;
-
-    static constexpr size_t flop_count_3 = flop_count_01345 + flop_count_01345_2;
-
-
-    // 1st, 3rd, 4th, 5th, 6th tensors contracted first
-    using quintet_cost_02345 = quintet_flop_cost<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>;
-
-    using resulting_tensor_4 = typename quintet_cost_02345::resulting_tensor;
-    using resulting_index_4  = typename quintet_cost_02345::resulting_index;
-
-    static constexpr size_t flop_count_02345 = quintet_cost_01235::min_cost;
-    static constexpr size_t flop_count_02345_1 = pair_flop_cost<resulting_index_4,Index<Idx1...>,resulting_tensor_4,Tensor<T,Rest1...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::value;
-
-    static constexpr size_t flop_count_4 = flop_count_02345 + flop_count_02345_1;
-
-
-    // last 5 tensors contracted first
-    using quintet_cost_12345 = quintet_flop_cost<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>,
-            Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>;
-
-    using resulting_tensor_5 = typename quintet_cost_12345::resulting_tensor;
-    using resulting_index_5  = typename quintet_cost_12345::resulting_index;
-
-    static constexpr size_t flop_count_12345 = quintet_cost_01235::min_cost;
-    static constexpr size_t flop_count_12345_0 = pair_flop_cost<resulting_index_5,Index<Idx0...>,resulting_tensor_5,Tensor<T,Rest0...>,
-            typename std_ext::make_index_sequence<sizeof...(Rest0)>::type>::value;
-
-    static constexpr size_t flop_count_5 = flop_count_12345 + flop_count_12345_0;
-
-
-    static constexpr size_t min_cost = meta_min<flop_count_0,flop_count_1,flop_count_2,flop_count_3,flop_count_4,flop_count_5>::value;
-    static constexpr int which_variant = meta_argmin<flop_count_0,flop_count_1,flop_count_2,flop_count_3,flop_count_4,flop_count_5>::value;
-
-
-    // this is the overall resulting tensor and index from overall sextet contraction
-    using resulting_tensor = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_tensor<resulting_index_0,Index<Idx5...>,resulting_tensor_0,Tensor<T,Rest5...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_tensor<Index<Idx4...>,resulting_index_1,Tensor<T,Rest4...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_tensor<Index<Idx3...>,resulting_index_2,Tensor<T,Rest3...>,resulting_tensor_2>::type,
-                typename std::conditional<
-                    which_variant==3,
-                    typename get_resuling_tensor<Index<Idx2...>,resulting_index_3,Tensor<T,Rest2...>,resulting_tensor_3>::type,
-                    typename std::conditional<
-                        which_variant==4,
-                        typename get_resuling_tensor<Index<Idx1...>,resulting_index_4,Tensor<T,Rest1...>,resulting_tensor_4>::type,
-                        typename get_resuling_tensor<Index<Idx0...>,resulting_index_5,Tensor<T,Rest0...>,resulting_tensor_5>::type
-                        >::type
-                    >::type
-                >::type
-            >::type
-        >::type;
-
-    using resulting_index = typename std::conditional<
-        which_variant==0,
-        typename get_resuling_index<resulting_index_0,Index<Idx5...>,resulting_tensor_0,Tensor<T,Rest5...>>::type,
-        typename std::conditional<
-            which_variant==1,
-            typename get_resuling_index<Index<Idx4...>,resulting_index_1,Tensor<T,Rest4...>,resulting_tensor_1>::type,
-            typename std::conditional<
-                which_variant==2,
-                typename get_resuling_index<Index<Idx3...>,resulting_index_2,Tensor<T,Rest3...>,resulting_tensor_2>::type,
-                typename std::conditional<
-                    which_variant==3,
-                    typename get_resuling_index<Index<Idx2...>,resulting_index_3,Tensor<T,Rest2...>,resulting_tensor_3>::type,
-                    typename std::conditional<
-                        which_variant==4,
-                        typename get_resuling_index<Index<Idx1...>,resulting_index_4,Tensor<T,Rest1...>,resulting_tensor_4>::type,
-                        typename get_resuling_index<Index<Idx0...>,resulting_index_5,Tensor<T,Rest0...>,resulting_tensor_5>::type
-                        >::type
-                    >::type
-                >::type
-            >::type
-        >::type;
+    using scalar_type = typename get_nth_type<0,Tens...>::scalar_type;
+    template<size_t ... Dims>
+    static auto unpack_helper(Index<Dims...>) -> Tensor<scalar_type,Dims...>;
+    using concat_tensor = decltype(unpack_helper(dims_type{}));
 
+    // the overall resulting tensor and index with the free indices in the order they appear
+    using resulting_tensor = typename contraction_impl<index_type, concat_tensor,
+        typename std_ext::make_index_sequence<no_of_indices>::type>::type;
+    using resulting_index = typename contraction_impl<index_type, concat_tensor,
+        typename std_ext::make_index_sequence<no_of_indices>::type>::indices;
 };
-//------------------------------------------------------------------------------------------------------------//
 
+template<class ... Ind, class ... Tens>
+constexpr typename network_opmin<typelist<Ind...>,typelist<Tens...>>::network_type
+network_opmin<typelist<Ind...>,typelist<Tens...>>::network;
 
+template<class ... Ind, class ... Tens>
+constexpr typename network_opmin<typelist<Ind...>,typelist<Tens...>>::path_storage
+network_opmin<typelist<Ind...>,typelist<Tens...>>::path;
+//------------------------------------------------------------------------------------------------------------//
 
 
 
 // einsum helper to extract the resulting index and the resulting tensor
 //------------------------------------------------------------------------------------------------------------//
+namespace internal {
+template<class Seq, class ... Ts>
+struct network_opmin_split;
+
+template<size_t ... ss, class ... Ts>
+struct network_opmin_split<std_ext::index_sequence<ss...>,Ts...> {
+    using type = network_opmin<typelist<get_nth_type<ss,Ts...>...>,
+                               typelist<get_nth_type<sizeof...(ss)+ss,Ts...>...>>;
+};
+} // internal
+
+// networks: einsum_helper<Ind0,...,IndN,Tensor0,...,TensorN>
 template<typename ...Ts>
-struct einsum_helper;
+struct einsum_helper {
+    using cost_model = typename internal::network_opmin_split<
+        typename std_ext::make_index_sequence<sizeof...(Ts)/2>::type,Ts...>::type;
+    using resulting_index  = typename cost_model::resulting_index;
+    using resulting_tensor = typename cost_model::resulting_tensor;
+    using path_type        = typename cost_model::path_type;
+};
 
 template<class Ind0,
          typename T, size_t ... Rest0>
@@ -572,42 +361,6 @@ struct einsum_helper<Ind0,Ind1,Tensor0,Tensor1> {
     using resulting_index  = typename get_resuling_index<Ind0,Ind1,Tensor0,Tensor1>::type;
     using resulting_tensor = typename get_resuling_tensor<Ind0,Ind1,Tensor0,Tensor1>::type;
 };
-
-template<class Ind0, class Ind1, class Ind2,
-         class Tensor0, class Tensor1, class Tensor2>
-struct einsum_helper<Ind0,Ind1,Ind2,Tensor0,Tensor1,Tensor2> {
-    using cost_model = triplet_flop_cost<Ind0,Ind1,Ind2,
-                                Tensor0,Tensor1,Tensor2>;
-    using resulting_index  = typename cost_model::resulting_index;
-    using resulting_tensor = typename cost_model::resulting_tensor;
-};
-
-template<class Ind0, class Ind1, class Ind2, class Ind3,
-         class Tensor0, class Tensor1, class Tensor2, class Tensor3>
-struct einsum_helper<Ind0,Ind1,Ind2,Ind3,Tensor0,Tensor1,Tensor2,Tensor3> {
-    using cost_model = quartet_flop_cost<Ind0,Ind1,Ind2,Ind3,
-                                Tensor0,Tensor1,Tensor2,Tensor3>;
-    using resulting_index  = typename cost_model::resulting_index;
-    using resulting_tensor = typename cost_model::resulting_tensor;
-};
-
-template<class Ind0, class Ind1, class Ind2, class Ind3, class Ind4,
-         class Tensor0, class Tensor1, class Tensor2, class Tensor3, class Tensor4>
-struct einsum_helper<Ind0,Ind1,Ind2,Ind3,Ind4,Tensor0,Tensor1,Tensor2,Tensor3,Tensor4> {
-    using cost_model = quintet_flop_cost<Ind0,Ind1,Ind2,Ind3,Ind4,
-                                Tensor0,Tensor1,Tensor2,Tensor3,Tensor4>;
-    using resulting_index  = typename cost_model::resulting_index;
-    using resulting_tensor = typename cost_model::resulting_tensor;
-};
-
-template<class Ind0, class Ind1, class Ind2, class Ind3, class Ind4, class Ind5,
-         class Tensor0, class Tensor1, class Tensor2, class Tensor3, class Tensor4, class Tensor5>
-struct einsum_helper<Ind0,Ind1,Ind2,Ind3,Ind4,Ind5,Tensor0,Tensor1,Tensor2,Tensor3,Tensor4,Tensor5> {
-    using cost_model = sixtet_flop_cost<Ind0,Ind1,Ind2,Ind3,Ind4,Ind5,
-                                Tensor0,Tensor1,Tensor2,Tensor3,Tensor4,Tensor5>;
-    using resulting_index  = typename cost_model::resulting_index;
-    using resulting_tensor = typename cost_model::resulting_tensor;
-};
 //------------------------------------------------------------------------------------------------------------//
 
 
@@ -93,6 +93,69 @@ FASTOR_INLINE SIMDVector<double,simd_abi::avx512> min(const SIMDVector<double,si
     return _mm512_min_pd(a.value,b.value);
 }
 #endif
+// 8 and 16 bit integers
+#ifdef FASTOR_SSE2_IMPL
+#ifdef FASTOR_SSE4_1_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::sse> min(const SIMDVector<int8_t,simd_abi::sse> &a, const SIMDVector<int8_t,simd_abi::sse> &b) {
+    return _mm_min_epi8(a.value,b.value);
+}
+#endif
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::sse> min(const SIMDVector<uint8_t,simd_abi::sse> &a, const SIMDVector<uint8_t,simd_abi::sse> &b) {
+    return _mm_min_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::sse> min(const SIMDVector<int16_t,simd_abi::sse> &a, const SIMDVector<int16_t,simd_abi::sse> &b) {
+    return _mm_min_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_AVX2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::avx> min(const SIMDVector<int8_t,simd_abi::avx> &a, const SIMDVector<int8_t,simd_abi::avx> &b) {
+    return _mm256_min_epi8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::avx> min(const SIMDVector<uint8_t,simd_abi::avx> &a, const SIMDVector<uint8_t,simd_abi::avx> &b) {
+    return _mm256_min_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::avx> min(const SIMDVector<int16_t,simd_abi::avx> &a, const SIMDVector<int16_t,simd_abi::avx> &b) {
+    return _mm256_min_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_AVX512BW_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::avx512> min(const SIMDVector<int8_t,simd_abi::avx512> &a, const SIMDVector<int8_t,simd_abi::avx512> &b) {
+    return _mm512_min_epi8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::avx512> min(const SIMDVector<uint8_t,simd_abi::avx512> &a, const SIMDVector<uint8_t,simd_abi::avx512> &b) {
+    return _mm512_min_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::avx512> min(const SIMDVector<int16_t,simd_abi::avx512> &a, const SIMDVector<int16_t,simd_abi::avx512> &b) {
+    return _mm512_min_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> min(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    return vminq_s32(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> min(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    return vminq_s64x(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> min(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return vminq_f32(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> min(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return vminq_f64(a.value,b.value);
+}
+#endif
 //----------------------------------------------------------------------------------------------------------//
 
 
@@ -174,6 +237,69 @@ FASTOR_INLINE SIMDVector<double,simd_abi::avx512> max(const SIMDVector<double,si
     return _mm512_max_pd(a.value,b.value);
 }
 #endif
+// 8 and 16 bit integers
+#ifdef FASTOR_SSE2_IMPL
+#ifdef FASTOR_SSE4_1_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::sse> max(const SIMDVector<int8_t,simd_abi::sse> &a, const SIMDVector<int8_t,simd_abi::sse> &b) {
+    return _mm_max_epi8(a.value,b.value);
+}
+#endif
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::sse> max(const SIMDVector<uint8_t,simd_abi::sse> &a, const SIMDVector<uint8_t,simd_abi::sse> &b) {
+    return _mm_max_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::sse> max(const SIMDVector<int16_t,simd_abi::sse> &a, const SIMDVector<int16_t,simd_abi::sse> &b) {
+    return _mm_max_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_AVX2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::avx> max(const SIMDVector<int8_t,simd_abi::avx> &a, const SIMDVector<int8_t,simd_abi::avx> &b) {
+    return _mm256_max_epi8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::avx> max(const SIMDVector<uint8_t,simd_abi::avx> &a, const SIMDVector<uint8_t,simd_abi::avx> &b) {
+    return _mm256_max_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::avx> max(const SIMDVector<int16_t,simd_abi::avx> &a, const SIMDVector<int16_t,simd_abi::avx> &b) {
+    return _mm256_max_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_AVX512BW_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::avx512> max(const SIMDVector<int8_t,simd_abi::avx512> &a, const SIMDVector<int8_t,simd_abi::avx512> &b) {
+    return _mm512_max_epi8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<uint8_t,simd_abi::avx512> max(const SIMDVector<uint8_t,simd_abi::avx512> &a, const SIMDVector<uint8_t,simd_abi::avx512> &b) {
+    return _mm512_max_epu8(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::avx512> max(const SIMDVector<int16_t,simd_abi::avx512> &a, const SIMDVector<int16_t,simd_abi::avx512> &b) {
+    return _mm512_max_epi16(a.value,b.value);
+}
+#endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> max(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    return vmaxq_s32(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> max(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    return vmaxq_s64x(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> max(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return vmaxq_f32(a.value,b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> max(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return vmaxq_f64(a.value,b.value);
+}
+#endif
 //----------------------------------------------------------------------------------------------------------//
 
 
@@ -216,6 +342,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::avx> ceil(const SIMDVector<double,simd
 //     return _mm512_ceil_pd(a.value);
 // }
 // #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> ceil(const SIMDVector<float,simd_abi::neon> &a) {
+    return vrndpq_f32(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> ceil(const SIMDVector<double,simd_abi::neon> &a) {
+    return vrndpq_f64(a.value);
+}
+#endif
 //----------------------------------------------------------------------------------------------------------//
 
 
@@ -278,6 +414,77 @@ FASTOR_INLINE SIMDVector<double,simd_abi::avx> floor(const SIMDVector<double,sim
     return _mm256_floor_pd(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> floor(const SIMDVector<float,simd_abi::neon> &a) {
+    return vrndmq_f32(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> floor(const SIMDVector<double,simd_abi::neon> &a) {
+    return vrndmq_f64(a.value);
+}
+#endif
+//----------------------------------------------------------------------------------------------------------//
+
+
+// copysign
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> copysign(const SIMDVector<T,ABI> &a, const SIMDVector<T,ABI> &b) {
+    SIMDVector<T,ABI> out;
+    for (FASTOR_INDEX i=0; i<SIMDVector<T,ABI>::Size; i++) { ((T*)&out)[i] = std::copysign(((T*)&a)[i],((T*)&b)[i]);}
+    return out;
+}
+#ifdef FASTOR_SSE2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::sse> copysign(const SIMDVector<float,simd_abi::sse> &a, const SIMDVector<float,simd_abi::sse> &b) {
+    const __m128 sign_mask = _mm_set1_ps(-0.f);
+    return _mm_or_ps(_mm_andnot_ps(sign_mask,a.value),_mm_and_ps(sign_mask,b.value));
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::sse> copysign(const SIMDVector<double,simd_abi::sse> &a, const SIMDVector<double,simd_abi::sse> &b) {
+    const __m128d sign_mask = _mm_set1_pd(-0.);
+    return _mm_or_pd(_mm_andnot_pd(sign_mask,a.value),_mm_and_pd(sign_mask,b.value));
+}
+#endif
+#ifdef FASTOR_AVX_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx> copysign(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
+    const __m256 sign_mask = _mm256_set1_ps(-0.f);
+    return _mm256_or_ps(_mm256_andnot_ps(sign_mask,a.value),_mm256_and_ps(sign_mask,b.value));
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::avx> copysign(const SIMDVector<double,simd_abi::avx> &a, const SIMDVector<double,simd_abi::avx> &b) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.);
+    return _mm256_or_pd(_mm256_andnot_pd(sign_mask,a.value),_mm256_and_pd(sign_mask,b.value));
+}
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+// Bitwise select sign_mask ? b : a in one instruction [0xCA], the
+// floating point and/andnot/or need AVX512DQ
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx512> copysign(const SIMDVector<float,simd_abi::avx512> &a, const SIMDVector<float,simd_abi::avx512> &b) {
+    const __m512i sign_mask = _mm512_set1_epi32(int(0x80000000u));
+    return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(sign_mask,_mm512_castps_si512(b.value),_mm512_castps_si512(a.value),0xCA));
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::avx512> copysign(const SIMDVector<double,simd_abi::avx512> &a, const SIMDVector<double,simd_abi::avx512> &b) {
+    const __m512i sign_mask = _mm512_set1_epi64(int64_t(0x8000000000000000ull));
+    return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(sign_mask,_mm512_castpd_si512(b.value),_mm512_castpd_si512(a.value),0xCA));
+}
+#endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> copysign(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    const uint32x4_t sign_mask = vdupq_n_u32(0x80000000u);
+    return vbslq_f32(sign_mask,b.value,a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> copysign(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    const uint64x2_t sign_mask = vdupq_n_u64(0x8000000000000000ull);
+    return vbslq_f64(sign_mask,b.value,a.value);
+}
+#endif
 //----------------------------------------------------------------------------------------------------------//
 
 
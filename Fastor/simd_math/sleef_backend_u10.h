@@ -19,6 +19,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> exp(const SIMDVector<double,simd_
     return Sleef_expd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> exp(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_expf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> exp(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_expd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> exp(const SIMDVector<float,simd_abi::avx> &a) {
@@ -54,6 +64,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> exp2(const SIMDVector<double,simd
     return Sleef_exp2d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> exp2(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_exp2f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> exp2(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_exp2d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> exp2(const SIMDVector<float,simd_abi::avx> &a) {
@@ -89,6 +109,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> expm1(const SIMDVector<double,sim
     return Sleef_expm1d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> expm1(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_expm1f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> expm1(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_expm1d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> expm1(const SIMDVector<float,simd_abi::avx> &a) {
@@ -124,6 +154,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log(const SIMDVector<double,simd_
     return Sleef_logd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_logf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_logd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log(const SIMDVector<float,simd_abi::avx> &a) {
@@ -159,6 +199,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log10(const SIMDVector<double,sim
     return Sleef_log10d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log10(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log10f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log10(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log10d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log10(const SIMDVector<float,simd_abi::avx> &a) {
@@ -194,6 +244,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log2(const SIMDVector<double,simd
     return Sleef_log2d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log2(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log2f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log2(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log2d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log2(const SIMDVector<float,simd_abi::avx> &a) {
@@ -229,6 +289,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log1p(const SIMDVector<double,sim
     return Sleef_log1pd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log1p(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log1pf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log1p(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log1pd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log1p(const SIMDVector<float,simd_abi::avx> &a) {
@@ -264,6 +334,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> pow(const SIMDVector<double,simd_
     return Sleef_powd2_u10(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> pow(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_powf4_u10(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> pow(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_powd2_u10(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> pow(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
@@ -299,6 +379,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cbrt(const SIMDVector<double,simd
     return Sleef_cbrtd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cbrt(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_cbrtf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cbrt(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_cbrtd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cbrt(const SIMDVector<float,simd_abi::avx> &a) {
@@ -334,6 +424,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> sin(const SIMDVector<double,simd_
     return Sleef_sind2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> sin(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_sinf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> sin(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_sind2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> sin(const SIMDVector<float,simd_abi::avx> &a) {
@@ -369,6 +469,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cos(const SIMDVector<double,simd_
     return Sleef_cosd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cos(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_cosf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cos(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_cosd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cos(const SIMDVector<float,simd_abi::avx> &a) {
@@ -404,6 +514,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tan(const SIMDVector<double,simd_
     return Sleef_tand2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tan(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tanf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tan(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tand2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tan(const SIMDVector<float,simd_abi::avx> &a) {
@@ -439,6 +559,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> asin(const SIMDVector<double,simd
     return Sleef_asind2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> asin(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_asinf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> asin(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_asind2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> asin(const SIMDVector<float,simd_abi::avx> &a) {
@@ -474,6 +604,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> acos(const SIMDVector<double,simd
     return Sleef_acosd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> acos(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_acosf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> acos(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_acosd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> acos(const SIMDVector<float,simd_abi::avx> &a) {
@@ -509,6 +649,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atan(const SIMDVector<double,simd
     return Sleef_atand2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atan(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_atanf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atan(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_atand2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atan(const SIMDVector<float,simd_abi::avx> &a) {
@@ -544,6 +694,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atan2(const SIMDVector<double,sim
     return Sleef_atan2d2_u10(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atan2(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_atan2f4_u10(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atan2(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_atan2d2_u10(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atan2(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
@@ -579,6 +739,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> sinh(const SIMDVector<double,simd
     return Sleef_sinhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> sinh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_sinhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> sinh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_sinhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> sinh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -614,6 +784,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cosh(const SIMDVector<double,simd
     return Sleef_coshd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cosh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_coshf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cosh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_coshd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cosh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -649,6 +829,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tanh(const SIMDVector<double,simd
     return Sleef_tanhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tanh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tanhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tanh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tanhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tanh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -684,6 +874,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> asinh(const SIMDVector<double,sim
     return Sleef_asinhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> asinh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_asinhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> asinh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_asinhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> asinh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -719,6 +919,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> acosh(const SIMDVector<double,sim
     return Sleef_acoshd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> acosh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_acoshf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> acosh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_acoshd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> acosh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -754,6 +964,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atanh(const SIMDVector<double,sim
     return Sleef_atanhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atanh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_atanhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atanh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_atanhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atanh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -789,6 +1009,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> erf(const SIMDVector<double,simd_
     return Sleef_erfd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> erf(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_erff4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> erf(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_erfd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> erf(const SIMDVector<float,simd_abi::avx> &a) {
@@ -824,6 +1054,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tgamma(const SIMDVector<double,si
     return Sleef_tgammad2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tgamma(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tgammaf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tgamma(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tgammad2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tgamma(const SIMDVector<float,simd_abi::avx> &a) {
@@ -859,6 +1099,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> lgamma(const SIMDVector<double,si
     return Sleef_lgammad2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> lgamma(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_lgammaf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> lgamma(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_lgammad2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> lgamma(const SIMDVector<float,simd_abi::avx> &a) {
@@ -894,6 +1144,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> hypot(const SIMDVector<double,sim
     return Sleef_hypotd2_u05(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> hypot(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_hypotf4_u05(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> hypot(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_hypotd2_u05(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX2_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> hypot(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
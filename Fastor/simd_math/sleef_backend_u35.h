@@ -20,6 +20,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> exp(const SIMDVector<double,simd_
     return Sleef_expd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> exp(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_expf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> exp(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_expd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> exp(const SIMDVector<float,simd_abi::avx> &a) {
@@ -55,6 +65,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> exp2(const SIMDVector<double,simd
     return Sleef_exp2d2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> exp2(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_exp2f4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> exp2(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_exp2d2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> exp2(const SIMDVector<float,simd_abi::avx> &a) {
@@ -90,6 +110,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> expm1(const SIMDVector<double,sim
     return Sleef_expm1d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> expm1(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_expm1f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> expm1(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_expm1d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> expm1(const SIMDVector<float,simd_abi::avx> &a) {
@@ -125,6 +155,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log(const SIMDVector<double,simd_
     return Sleef_logd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_logf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_logd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log(const SIMDVector<float,simd_abi::avx> &a) {
@@ -160,6 +200,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log10(const SIMDVector<double,sim
     return Sleef_log10d2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log10(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log10f4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log10(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log10d2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log10(const SIMDVector<float,simd_abi::avx> &a) {
@@ -195,6 +245,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log2(const SIMDVector<double,simd
     return Sleef_log2d2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log2(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log2f4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log2(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log2d2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log2(const SIMDVector<float,simd_abi::avx> &a) {
@@ -230,6 +290,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> log1p(const SIMDVector<double,sim
     return Sleef_log1pd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> log1p(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_log1pf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> log1p(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_log1pd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> log1p(const SIMDVector<float,simd_abi::avx> &a) {
@@ -265,6 +335,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> pow(const SIMDVector<double,simd_
     return Sleef_powd2_u10(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> pow(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_powf4_u10(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> pow(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_powd2_u10(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> pow(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
@@ -300,6 +380,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cbrt(const SIMDVector<double,simd
     return Sleef_cbrtd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cbrt(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_cbrtf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cbrt(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_cbrtd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cbrt(const SIMDVector<float,simd_abi::avx> &a) {
@@ -335,6 +425,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> sin(const SIMDVector<double,simd_
     return Sleef_sind2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> sin(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_sinf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> sin(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_sind2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> sin(const SIMDVector<float,simd_abi::avx> &a) {
@@ -370,6 +470,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cos(const SIMDVector<double,simd_
     return Sleef_cosd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cos(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_cosf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cos(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_cosd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cos(const SIMDVector<float,simd_abi::avx> &a) {
@@ -405,6 +515,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tan(const SIMDVector<double,simd_
     return Sleef_tand2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tan(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tanf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tan(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tand2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tan(const SIMDVector<float,simd_abi::avx> &a) {
@@ -440,6 +560,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> asin(const SIMDVector<double,simd
     return Sleef_asind2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> asin(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_asinf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> asin(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_asind2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> asin(const SIMDVector<float,simd_abi::avx> &a) {
@@ -475,6 +605,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> acos(const SIMDVector<double,simd
     return Sleef_acosd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> acos(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_acosf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> acos(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_acosd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> acos(const SIMDVector<float,simd_abi::avx> &a) {
@@ -510,6 +650,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atan(const SIMDVector<double,simd
     return Sleef_atand2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atan(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_atanf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atan(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_atand2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atan(const SIMDVector<float,simd_abi::avx> &a) {
@@ -545,6 +695,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atan2(const SIMDVector<double,sim
     return Sleef_atan2d2_u35(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atan2(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_atan2f4_u35(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atan2(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_atan2d2_u35(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atan2(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
@@ -580,6 +740,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> sinh(const SIMDVector<double,simd
     return Sleef_sinhd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> sinh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_sinhf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> sinh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_sinhd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> sinh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -615,6 +785,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> cosh(const SIMDVector<double,simd
     return Sleef_coshd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> cosh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_coshf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> cosh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_coshd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> cosh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -650,6 +830,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tanh(const SIMDVector<double,simd
     return Sleef_tanhd2_u35(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tanh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tanhf4_u35(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tanh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tanhd2_u35(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tanh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -685,6 +875,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> asinh(const SIMDVector<double,sim
     return Sleef_asinhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> asinh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_asinhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> asinh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_asinhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> asinh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -720,6 +920,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> acosh(const SIMDVector<double,sim
     return Sleef_acoshd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> acosh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_acoshf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> acosh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_acoshd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> acosh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -755,6 +965,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> atanh(const SIMDVector<double,sim
     return Sleef_atanhd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> atanh(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_atanhf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> atanh(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_atanhd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> atanh(const SIMDVector<float,simd_abi::avx> &a) {
@@ -790,6 +1010,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> erf(const SIMDVector<double,simd_
     return Sleef_erfd2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> erf(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_erff4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> erf(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_erfd2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> erf(const SIMDVector<float,simd_abi::avx> &a) {
@@ -825,6 +1055,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> tgamma(const SIMDVector<double,si
     return Sleef_tgammad2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> tgamma(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_tgammaf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> tgamma(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_tgammad2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> tgamma(const SIMDVector<float,simd_abi::avx> &a) {
@@ -860,6 +1100,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> lgamma(const SIMDVector<double,si
     return Sleef_lgammad2_u10(a.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> lgamma(const SIMDVector<float,simd_abi::neon> &a) {
+    return Sleef_lgammaf4_u10(a.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> lgamma(const SIMDVector<double,simd_abi::neon> &a) {
+    return Sleef_lgammad2_u10(a.value);
+}
+#endif
 #ifdef FASTOR_AVX_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> lgamma(const SIMDVector<float,simd_abi::avx> &a) {
@@ -895,6 +1145,16 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> hypot(const SIMDVector<double,sim
     return Sleef_hypotd2_u05(a.value, b.value);
 }
 #endif
+#ifdef FASTOR_NEON_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> hypot(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    return Sleef_hypotf4_u05(a.value, b.value);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> hypot(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    return Sleef_hypotd2_u05(a.value, b.value);
+}
+#endif
 #ifdef FASTOR_AVX2_IMPL
 template<>
 FASTOR_INLINE SIMDVector<float,simd_abi::avx> hypot(const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
@@ -7,6 +7,8 @@
 #include "Fastor/simd_vector/simd_vector_double.h"
 #include "Fastor/simd_vector/simd_vector_int32.h"
 #include "Fastor/simd_vector/simd_vector_int64.h"
+#include "Fastor/simd_vector/simd_vector_narrow_int.h"
+#include "Fastor/simd_vector/simd_vector_half.h"
 #include "Fastor/simd_vector/simd_vector_complex_scalar.h"
 #include "Fastor/simd_vector/simd_vector_complex_float.h"
 #include "Fastor/simd_vector/simd_vector_complex_double.h"
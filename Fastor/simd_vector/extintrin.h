@@ -681,11 +681,18 @@ FASTOR_INLINE __m128i _mm_mul_epi32x(__m128i a, __m128i b)
 
 #ifdef FASTOR_SSE2_IMPL
 FASTOR_INLINE __m128i _mm_mul_epi64(__m128i _a, __m128i _b) {
-    __m128i out;
-   for (FASTOR_INDEX i=0; i<2; i++) {
-       ((int64_t*)&out)[i] = (((int64_t*)&_a)[i])*(((int64_t*)&_b)[i]);
-   }
-    return out;
+#if defined(FASTOR_AVX512DQ_IMPL) && defined(FASTOR_AVX512VL_IMPL)
+    return _mm_mullo_epi64(_a,_b);
+#else
+    // Go through memory, writing the lanes of an __m128i through an int64_t*
+    // is miscompiled at -O2
+    int64_t a[2], b[2];
+    _mm_storeu_si128((__m128i*)a,_a);
+    _mm_storeu_si128((__m128i*)b,_b);
+    a[0] *= b[0];
+    a[1] *= b[1];
+    return _mm_loadu_si128((const __m128i*)a);
+#endif
 }
 #endif
 
@@ -797,6 +804,53 @@ FASTOR_INLINE __m256i _mm256_mul_epi64x(__m256i _a, __m256i _b) {
 //----------------------------------------------------------------------------------------------------------------//
 
 
+// 8 bit integer multiplication, there is no instruction for it so the even and odd bytes are
+// multiplied as 16 bit integers and the low bytes of the products are merged back
+//----------------------------------------------------------------------------------------------------------------//
+#ifdef FASTOR_SSE2_IMPL
+FASTOR_INLINE __m128i _mm_mullo_epi8x(__m128i a, __m128i b) {
+    __m128i even = _mm_mullo_epi16(a,b);
+    __m128i odd  = _mm_mullo_epi16(_mm_srli_epi16(a,8),_mm_srli_epi16(b,8));
+    return _mm_or_si128(_mm_slli_epi16(odd,8),_mm_and_si128(even,_mm_set1_epi16(0xFF)));
+}
+#endif
+#ifdef FASTOR_AVX2_IMPL
+FASTOR_INLINE __m256i _mm256_mullo_epi8x(__m256i a, __m256i b) {
+    __m256i even = _mm256_mullo_epi16(a,b);
+    __m256i odd  = _mm256_mullo_epi16(_mm256_srli_epi16(a,8),_mm256_srli_epi16(b,8));
+    return _mm256_or_si256(_mm256_slli_epi16(odd,8),_mm256_and_si256(even,_mm256_set1_epi16(0xFF)));
+}
+#endif
+#ifdef FASTOR_AVX512BW_IMPL
+FASTOR_INLINE __m512i _mm512_mullo_epi8x(__m512i a, __m512i b) {
+    __m512i even = _mm512_mullo_epi16(a,b);
+    __m512i odd  = _mm512_mullo_epi16(_mm512_srli_epi16(a,8),_mm512_srli_epi16(b,8));
+    return _mm512_or_si512(_mm512_slli_epi16(odd,8),_mm512_and_si512(even,_mm512_set1_epi16(0xFF)));
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------//
+
+
+
+// Masks with all bits set in the lanes below n and cleared in the rest, for maskstore and blendv
+//----------------------------------------------------------------------------------------------------------------//
+#ifdef FASTOR_AVX2_IMPL
+FASTOR_INLINE __m128i _mm_lanemask_epi32(int n) {
+    return _mm_cmpgt_epi32(_mm_set1_epi32(n),_mm_setr_epi32(0,1,2,3));
+}
+FASTOR_INLINE __m128i _mm_lanemask_epi64(int n) {
+    return _mm_cmpgt_epi64(_mm_set1_epi64x(n),_mm_set_epi64x(1,0));
+}
+FASTOR_INLINE __m256i _mm256_lanemask_epi32(int n) {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),_mm256_setr_epi32(0,1,2,3,4,5,6,7));
+}
+FASTOR_INLINE __m256i _mm256_lanemask_epi64(int n) {
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),_mm256_setr_epi64x(0,1,2,3));
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------//
+
+
 
 //! Some further auxilary functions C++ only
 //----------------------------------------------------------------------------------------------------------------//
@@ -1017,6 +1071,73 @@ FASTOR_INLINE void arrange_for_store(__m512d &lo, __m512d &hi, __m512d value_r,
 //----------------------------------------------------------------------------------------------------------------//
 
 
+//----------------------------------------------------------------------------------------------------------------//
+// NEON helpers, the horizontal sum/min/max are native on AArch64 [vaddvq, vminvq, vmaxvq]
+#ifdef FASTOR_NEON_IMPL
+FASTOR_INLINE float32x4_t vreverseq_f32(float32x4_t a) {
+    // 2OPS
+    float32x4_t rev = vrev64q_f32(a);
+    return vextq_f32(rev,rev,2);
+}
+FASTOR_INLINE float64x2_t vreverseq_f64(float64x2_t a) {
+    // 1OP
+    return vextq_f64(a,a,1);
+}
+FASTOR_INLINE int32x4_t vreverseq_s32(int32x4_t a) {
+    // 2OPS
+    int32x4_t rev = vrev64q_s32(a);
+    return vextq_s32(rev,rev,2);
+}
+FASTOR_INLINE int64x2_t vreverseq_s64(int64x2_t a) {
+    // 1OP
+    return vextq_s64(a,a,1);
+}
+
+FASTOR_INLINE float vprodvq_f32(float32x4_t a) {
+    // 3OPS
+    float32x2_t prod = vmul_f32(vget_low_f32(a),vget_high_f32(a));
+    return vget_lane_f32(prod,0)*vget_lane_f32(prod,1);
+}
+FASTOR_INLINE double vprodvq_f64(float64x2_t a) {
+    return vgetq_lane_f64(a,0)*vgetq_lane_f64(a,1);
+}
+FASTOR_INLINE int32_t vprodvq_s32(int32x4_t a) {
+    int32x2_t prod = vmul_s32(vget_low_s32(a),vget_high_s32(a));
+    return vget_lane_s32(prod,0)*vget_lane_s32(prod,1);
+}
+FASTOR_INLINE int64_t vprodvq_s64(int64x2_t a) {
+    return vgetq_lane_s64(a,0)*vgetq_lane_s64(a,1);
+}
+
+// Shift lanes up by i filling in zeros, equivalent of _mm_shifti_ps
+FASTOR_INLINE float32x4_t vshift1q_f32(float32x4_t a) {
+    return vextq_f32(vdupq_n_f32(0.f),a,3);
+}
+FASTOR_INLINE float32x4_t vshift2q_f32(float32x4_t a) {
+    return vextq_f32(vdupq_n_f32(0.f),a,2);
+}
+FASTOR_INLINE float32x4_t vshift3q_f32(float32x4_t a) {
+    return vextq_f32(vdupq_n_f32(0.f),a,1);
+}
+FASTOR_INLINE float64x2_t vshift1q_f64(float64x2_t a) {
+    return vextq_f64(vdupq_n_f64(0.0),a,1);
+}
+
+// 64 bit integer multiplication and min/max have no NEON instruction
+FASTOR_INLINE int64x2_t vmulq_s64x(int64x2_t a, int64x2_t b) {
+    return vsetq_lane_s64(vgetq_lane_s64(a,1)*vgetq_lane_s64(b,1),
+                vdupq_n_s64(vgetq_lane_s64(a,0)*vgetq_lane_s64(b,0)),1);
+}
+FASTOR_INLINE int64x2_t vminq_s64x(int64x2_t a, int64x2_t b) {
+    return vbslq_s64(vcltq_s64(a,b),a,b);
+}
+FASTOR_INLINE int64x2_t vmaxq_s64x(int64x2_t a, int64x2_t b) {
+    return vbslq_s64(vcgtq_s64(a,b),a,b);
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------//
+
+
 //----------------------------------------------------------------------------------------------------------------//
 // Additional math functions for scalars -> the name sqrts is to remove ambiguity with libm sqrt
 template<typename T, enable_if_t_<is_primitive_v_<T>,bool> = false>
@@ -15,6 +15,7 @@ struct sse {};
 struct avx {};
 struct avx512 {};
 struct mic {};
+struct neon {};
 template<size_t N> struct fixed_size {};
 
 #ifndef FASTOR_DONT_VECTORISE
@@ -24,6 +25,8 @@ using native = simd_abi::avx512;
 using native = simd_abi::avx;
 #elif defined(FASTOR_SSE2_IMPL)
 using native = simd_abi::sse;
+#elif defined(FASTOR_NEON_IMPL)
+using native = simd_abi::neon;
 #else
 using native = simd_abi::scalar;
 #endif
@@ -49,7 +52,8 @@ struct get_simd_vector_size<__svec<T,ABI>> {
     static constexpr size_t bitsize = std::is_same<ABI,simd_abi::avx512>::value
                                                 ? FASTOR_AVX512_BITSIZE : (std::is_same<ABI,simd_abi::avx>::value
                                                     ? FASTOR_AVX_BITSIZE : (std::is_same<ABI,simd_abi::sse>::value
-                                                        ? FASTOR_SSE_BITSIZE : sizeof(T)*8));
+                                                        ? FASTOR_SSE_BITSIZE : (std::is_same<ABI,simd_abi::neon>::value
+                                                            ? FASTOR_NEON_BITSIZE : sizeof(T)*8)));
 
     // Size should be at least 1UL
     static constexpr size_t value = (bitsize / sizeof(T) / 8UL) != 0 ? (bitsize / sizeof(T) / 8UL) : 1UL;
@@ -60,7 +64,8 @@ struct get_simd_vector_size<__svec<T,simd_abi::fixed_size<N> > > {
     static constexpr size_t bitsize = N*8UL;
     static constexpr size_t value = N;
 };
-// Specialisation for complex simd vectors
+// Specialisation for complex simd vectors. There are no NEON complex simd vectors
+// so these fall back to scalar for simd_abi::neon
 template<template<typename, typename> class __svec, typename ABI>
 struct get_simd_vector_size<__svec<std::complex<float>,ABI>> {
     using T = float;
@@ -174,11 +179,12 @@ struct choose_best_simd_type<__svec<TT,ABI>,N> {
     //                 >::type
     //              >::type;
 
-    using type = typename std::conditional< std::is_same<T,float>::value                    ||
-                                            std::is_same<T,double>::value                   ||
-                                            std::is_same<T,std::complex<float>>::value      ||
-                                            std::is_same<T,std::complex<double>>::value     ||
-                                            std::is_same<T,int32_t>::value                  ||
+    static constexpr bool has_complex = !std::is_same<ABI,simd_abi::neon>::value;
+    using type = typename std::conditional< std::is_same<T,float>::value                                    ||
+                                            std::is_same<T,double>::value                                   ||
+                                            (has_complex && std::is_same<T,std::complex<float>>::value)     ||
+                                            (has_complex && std::is_same<T,std::complex<double>>::value)    ||
+                                            std::is_same<T,int32_t>::value                                  ||
                                             std::is_same<T,int64_t>::value,
                                             size_based_type,
                                             __svec<T,simd_abi::scalar>
@@ -8,6 +8,8 @@
 #include "Fastor/simd_vector/simd_vector_double.h"
 #include "Fastor/simd_vector/simd_vector_int32.h"
 #include "Fastor/simd_vector/simd_vector_int64.h"
+#include "Fastor/simd_vector/simd_vector_narrow_int.h"
+#include "Fastor/simd_vector/simd_vector_half.h"
 #include "Fastor/simd_vector/simd_vector_complex_scalar.h"
 #include "Fastor/simd_vector/simd_vector_complex_float.h"
 #include "Fastor/simd_vector/simd_vector_complex_double.h"
@@ -24,12 +26,21 @@ namespace Fastor {
 template<typename TT>
 struct choose_best_simd_vector {
     using T = remove_cv_ref_t<TT>;
-    using type = typename std::conditional< std::is_same<T,float>::value                    ||
-                                            std::is_same<T,double>::value                   ||
-                                            std::is_same<T,std::complex<float>>::value      ||
-                                            std::is_same<T,std::complex<double>>::value     ||
-                                            std::is_same<T,int32_t>::value                  ||
-                                            std::is_same<T,int64_t>::value,
+    // There are no NEON complex simd vectors
+    static constexpr bool has_complex = !std::is_same<simd_abi::native,simd_abi::neon>::value;
+    // 8 and 16 bit integers and half precision floats are only vectorised for x86
+    static constexpr bool has_narrow_int = internal::has_narrow_int_simd<simd_abi::native>::value;
+    static constexpr bool has_half = internal::has_half_simd<simd_abi::native>::value;
+    using type = typename std::conditional< std::is_same<T,float>::value                                    ||
+                                            std::is_same<T,double>::value                                   ||
+                                            (has_complex && std::is_same<T,std::complex<float>>::value)     ||
+                                            (has_complex && std::is_same<T,std::complex<double>>::value)    ||
+                                            std::is_same<T,int32_t>::value                                  ||
+                                            std::is_same<T,int64_t>::value                                  ||
+                                            (has_narrow_int && std::is_same<T,int8_t>::value)               ||
+                                            (has_narrow_int && std::is_same<T,uint8_t>::value)              ||
+                                            (has_narrow_int && std::is_same<T,int16_t>::value)              ||
+                                            (has_half && is_half_precision<T>::value),
                                             SIMDVector<T,simd_abi::native>,
                                             SIMDVector<T,simd_abi::scalar>
                 >::type;
@@ -251,6 +262,18 @@ FASTOR_INLINE void vector_setter(SIMDVector<T,ABI> &vec, const T *data, int idx,
             data[idx+3*general_stride],data[idx+2*general_stride],
             data[idx+general_stride],data[idx]);
 }
+
+// 2 word, 16 bit integers have as many lanes as the register allows while half precision
+// floats have as many as float does so the lanes are filled through memory using Size
+template<typename T, typename ABI,
+         typename std::enable_if<sizeof(T)==2,bool>::type=0>
+FASTOR_INLINE void vector_setter(SIMDVector<T,ABI> &vec, const T *data, int idx, int general_stride) {
+    T vals[SIMDVector<T,ABI>::Size];
+    for (FASTOR_INDEX j=0; j<SIMDVector<T,ABI>::Size; ++j) {
+        vals[j] = data[idx+j*general_stride];
+    }
+    vec.load(vals,false);
+}
 //----------------------------------------------------------------------------------------------------------------
 
 
@@ -336,10 +359,97 @@ FASTOR_INLINE void vector_setter(SIMDVector<T,ABI> &vec, const T *data, const st
     vec.set(data[a[7]],data[a[6]],data[a[5]],data[a[4]],
             data[a[3]],data[a[2]],data[a[1]],data[a[0]]);
 }
+
+// 1 and 2 word
+template<typename T, typename ABI, size_t N,
+         typename std::enable_if<(sizeof(T)==1 || sizeof(T)==2) && N==SIMDVector<T,ABI>::Size,bool>::type=0>
+FASTOR_INLINE void vector_setter(SIMDVector<T,ABI> &vec, const T *data, const std::array<int,N> &a) {
+    T vals[N];
+    for (size_t j=0; j<N; ++j) {
+        vals[j] = data[a[j]];
+    }
+    vec.load(vals,false);
+}
 //----------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------
 
 
+// Hardware gathers, these are preferred over the generic versions above by overload resolution
+//----------------------------------------------------------------------------------------------------------------
+#if defined(FASTOR_AVX2_IMPL) && !defined(FASTOR_NO_HARDWARE_GATHER)
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx> &vec, const float *data, int idx, int general_stride) {
+    __m256i vindex = _mm256_add_epi32(_mm256_set1_epi32(idx),
+        _mm256_mullo_epi32(_mm256_set1_epi32(general_stride),_mm256_setr_epi32(0,1,2,3,4,5,6,7)));
+    vec.value = _mm256_i32gather_ps(data,vindex,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx> &vec, const float *data, const std::array<int,8> &a) {
+    vec.value = _mm256_i32gather_ps(data,_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx> &vec, const double *data, int idx, int general_stride) {
+    __m128i vindex = _mm_add_epi32(_mm_set1_epi32(idx),
+        _mm_mullo_epi32(_mm_set1_epi32(general_stride),_mm_setr_epi32(0,1,2,3)));
+    vec.value = _mm256_i32gather_pd(data,vindex,8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx> &vec, const double *data, const std::array<int,4> &a) {
+    vec.value = _mm256_i32gather_pd(data,_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int32_t,simd_abi::avx> &vec, const int32_t *data, int idx, int general_stride) {
+    __m256i vindex = _mm256_add_epi32(_mm256_set1_epi32(idx),
+        _mm256_mullo_epi32(_mm256_set1_epi32(general_stride),_mm256_setr_epi32(0,1,2,3,4,5,6,7)));
+    vec.value = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data),vindex,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int32_t,simd_abi::avx> &vec, const int32_t *data, const std::array<int,8> &a) {
+    vec.value = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int64_t,simd_abi::avx> &vec, const int64_t *data, int idx, int general_stride) {
+    __m128i vindex = _mm_add_epi32(_mm_set1_epi32(idx),
+        _mm_mullo_epi32(_mm_set1_epi32(general_stride),_mm_setr_epi32(0,1,2,3)));
+    vec.value = _mm256_i32gather_epi64(reinterpret_cast<const long long int*>(data),vindex,8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int64_t,simd_abi::avx> &vec, const int64_t *data, const std::array<int,4> &a) {
+    vec.value = _mm256_i32gather_epi64(reinterpret_cast<const long long int*>(data),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),8);
+}
+#endif
+
+#if defined(FASTOR_AVX512F_IMPL) && !defined(FASTOR_NO_HARDWARE_GATHER)
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx512> &vec, const float *data, int idx, int general_stride) {
+    __m512i vindex = _mm512_add_epi32(_mm512_set1_epi32(idx),
+        _mm512_mullo_epi32(_mm512_set1_epi32(general_stride),_mm512_setr_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)));
+    vec.value = _mm512_i32gather_ps(vindex,data,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx512> &vec, const float *data, const std::array<int,16> &a) {
+    vec.value = _mm512_i32gather_ps(_mm512_loadu_si512(a.data()),data,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx512> &vec, const double *data, int idx, int general_stride) {
+    __m256i vindex = _mm256_add_epi32(_mm256_set1_epi32(idx),
+        _mm256_mullo_epi32(_mm256_set1_epi32(general_stride),_mm256_setr_epi32(0,1,2,3,4,5,6,7)));
+    vec.value = _mm512_i32gather_pd(vindex,data,8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx512> &vec, const double *data, const std::array<int,8> &a) {
+    vec.value = _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),data,8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int32_t,simd_abi::avx512> &vec, const int32_t *data, int idx, int general_stride) {
+    __m512i vindex = _mm512_add_epi32(_mm512_set1_epi32(idx),
+        _mm512_mullo_epi32(_mm512_set1_epi32(general_stride),_mm512_setr_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)));
+    vec.value = _mm512_i32gather_epi32(vindex,data,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int32_t,simd_abi::avx512> &vec, const int32_t *data, const std::array<int,16> &a) {
+    vec.value = _mm512_i32gather_epi32(_mm512_loadu_si512(a.data()),data,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int64_t,simd_abi::avx512> &vec, const int64_t *data, int idx, int general_stride) {
+    __m256i vindex = _mm256_add_epi32(_mm256_set1_epi32(idx),
+        _mm256_mullo_epi32(_mm256_set1_epi32(general_stride),_mm256_setr_epi32(0,1,2,3,4,5,6,7)));
+    vec.value = _mm512_i32gather_epi64(vindex,data,8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<int64_t,simd_abi::avx512> &vec, const int64_t *data, const std::array<int,8> &a) {
+    vec.value = _mm512_i32gather_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),data,8);
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------
+
+
 
 
 // Scatter operations
@@ -459,6 +569,27 @@ FASTOR_INLINE void data_setter(T *FASTOR_RESTRICT data, const SIMDVector<T,ABI>
     data[idx+2*general_stride] = vec[2];
     data[idx+3*general_stride] = vec[3];
 }
+
+// 1 and 2 word
+template<typename T, typename ABI, typename Int,
+         typename std::enable_if<sizeof(T)==1 || sizeof(T)==2,bool>::type=0>
+FASTOR_INLINE void data_setter(T *FASTOR_RESTRICT data, const SIMDVector<T,ABI> &vec, Int idx, int general_stride=1) {
+    T vals[SIMDVector<T,ABI>::Size];
+    vec.store(vals,false);
+    for (FASTOR_INDEX j=0; j<SIMDVector<T,ABI>::Size; ++j) {
+        data[idx+j*general_stride] = vals[j];
+    }
+}
+
+// [Scatter operations], when strides are not constant (i.e totally random). Lanes are written in
+// order so that repeated indices end up with the value of the last lane like the scalar loop.
+// AVX-512 scatter instructions are not used here as they turned out slower than lane stores
+template<typename T, typename ABI, size_t N>
+FASTOR_INLINE void data_setter(T *FASTOR_RESTRICT data, const SIMDVector<T,ABI> &vec, const std::array<int,N> &a) {
+    for (size_t j=0; j<N; ++j) {
+        data[a[j]] = vec[j];
+    }
+}
 //----------------------------------------------------------------------------------------------------------------
 
 
@@ -692,6 +823,151 @@ void maskstore(int * FASTOR_RESTRICT a, const int (&maska)[4], SIMDVector<int,si
 
 
 
+// Non-temporal stores that write around the cache hierarchy, used for outputs too large to stay
+// in the last level cache. The destination must be aligned to the vector width and a stream_fence
+// is needed before the data is read by another thread. Vectors without a streaming instruction
+// fall back to regular aligned stores. The vector may hold const values when evaluated from a
+// read-only map
+//----------------------------------------------------------------------------------------------------------------
+template<typename T, typename U, typename ABI>
+FASTOR_INLINE void stream_store(T * FASTOR_RESTRICT a, const SIMDVector<U,ABI> &v) {
+    v.store(a, true);
+}
+
+#define FASTOR_MAKE_STREAM_STORE(TYPE, ABI, STREAM, PTR_TYPE)\
+FASTOR_INLINE void stream_store(TYPE * FASTOR_RESTRICT a, const SIMDVector<TYPE,simd_abi::ABI> &v) {\
+    STREAM(reinterpret_cast<PTR_TYPE*>(a), v.value);\
+}\
+
+#ifdef FASTOR_SSE2_IMPL
+FASTOR_MAKE_STREAM_STORE(float  , sse, _mm_stream_ps   , float  )
+FASTOR_MAKE_STREAM_STORE(double , sse, _mm_stream_pd   , double )
+FASTOR_MAKE_STREAM_STORE(int32_t, sse, _mm_stream_si128, __m128i)
+FASTOR_MAKE_STREAM_STORE(int64_t, sse, _mm_stream_si128, __m128i)
+FASTOR_MAKE_STREAM_STORE(int16_t, sse, _mm_stream_si128, __m128i)
+FASTOR_MAKE_STREAM_STORE(int8_t , sse, _mm_stream_si128, __m128i)
+FASTOR_MAKE_STREAM_STORE(uint8_t, sse, _mm_stream_si128, __m128i)
+#endif
+#ifdef FASTOR_AVX_IMPL
+FASTOR_MAKE_STREAM_STORE(float  , avx, _mm256_stream_ps   , float  )
+FASTOR_MAKE_STREAM_STORE(double , avx, _mm256_stream_pd   , double )
+#endif
+#ifdef FASTOR_AVX2_IMPL
+FASTOR_MAKE_STREAM_STORE(int32_t, avx, _mm256_stream_si256, __m256i)
+FASTOR_MAKE_STREAM_STORE(int64_t, avx, _mm256_stream_si256, __m256i)
+FASTOR_MAKE_STREAM_STORE(int16_t, avx, _mm256_stream_si256, __m256i)
+FASTOR_MAKE_STREAM_STORE(int8_t , avx, _mm256_stream_si256, __m256i)
+FASTOR_MAKE_STREAM_STORE(uint8_t, avx, _mm256_stream_si256, __m256i)
+#endif
+#ifdef FASTOR_AVX512_IMPL
+FASTOR_MAKE_STREAM_STORE(float  , avx512, _mm512_stream_ps   , float  )
+FASTOR_MAKE_STREAM_STORE(double , avx512, _mm512_stream_pd   , double )
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+FASTOR_MAKE_STREAM_STORE(int32_t, avx512, _mm512_stream_si512, __m512i)
+FASTOR_MAKE_STREAM_STORE(int64_t, avx512, _mm512_stream_si512, __m512i)
+#endif
+#ifdef FASTOR_AVX512BW_IMPL
+FASTOR_MAKE_STREAM_STORE(int16_t, avx512, _mm512_stream_si512, __m512i)
+FASTOR_MAKE_STREAM_STORE(int8_t , avx512, _mm512_stream_si512, __m512i)
+FASTOR_MAKE_STREAM_STORE(uint8_t, avx512, _mm512_stream_si512, __m512i)
+#endif
+
+/* Orders the non-temporal stores issued so far before any store that follows */
+FASTOR_INLINE void stream_fence() {
+#ifdef FASTOR_SSE2_IMPL
+    _mm_sfence();
+#endif
+}
+//----------------------------------------------------------------------------------------------------------------
+
+
+
+
+// Masked tails. Storing or keeping only the first n lanes of a vector lets loops finish their
+// remainder with one vector operation instead of a scalar loop. Vectors that can do so using
+// AVX-512 masks or AVX2 maskstore and blendv report has_masked_tail, the generic versions go
+// through memory and exist so that every vector type compiles
+//----------------------------------------------------------------------------------------------------------------
+namespace internal {
+template<typename V>
+struct has_masked_tail {
+    static constexpr bool value = false;
+};
+} // end of namespace internal
+
+/* Stores the first n lanes of v to a leaving the memory past them untouched */
+template<typename T, typename U, typename ABI>
+FASTOR_INLINE void tail_store(T * FASTOR_RESTRICT a, const SIMDVector<U,ABI> &v, FASTOR_INDEX n) {
+    typename SIMDVector<U,ABI>::scalar_value_type tmp[SIMDVector<U,ABI>::Size];
+    v.store(tmp,false);
+    for (FASTOR_INDEX k=0; k<n; ++k) a[k] = tmp[k];
+}
+/* Keeps the first n lanes of v and sets the rest to fill */
+template<typename U, typename ABI>
+FASTOR_INLINE SIMDVector<U,ABI> tail_blend(const SIMDVector<U,ABI> &v, FASTOR_INDEX n,
+    typename SIMDVector<U,ABI>::scalar_value_type fill) {
+    typename SIMDVector<U,ABI>::scalar_value_type tmp[SIMDVector<U,ABI>::Size];
+    v.store(tmp,false);
+    for (FASTOR_INDEX k=n; k<SIMDVector<U,ABI>::Size; ++k) tmp[k] = fill;
+    return SIMDVector<U,ABI>(tmp,false);
+}
+
+#if defined(FASTOR_HAS_AVX512_MASKS)
+#define FASTOR_MAKE_MASKED_TAIL(TYPE, ABI, MM, EPI, SET1)\
+namespace internal {\
+template<> struct has_masked_tail<SIMDVector<TYPE,simd_abi::ABI>> {\
+    static constexpr bool value = true;\
+};\
+}\
+FASTOR_INLINE void tail_store(TYPE * FASTOR_RESTRICT a, const SIMDVector<TYPE,simd_abi::ABI> &v, FASTOR_INDEX n) {\
+    MM ##_mask_storeu_ ##EPI (a, (1U << n) - 1U, v.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> tail_blend(const SIMDVector<TYPE,simd_abi::ABI> &v, FASTOR_INDEX n, TYPE fill) {\
+    return MM ##_mask_mov_ ##EPI (SET1(fill), (1U << n) - 1U, v.value);\
+}\
+
+FASTOR_MAKE_MASKED_TAIL(float  , sse   , _mm   , ps   , _mm_set1_ps        )
+FASTOR_MAKE_MASKED_TAIL(float  , avx   , _mm256, ps   , _mm256_set1_ps     )
+FASTOR_MAKE_MASKED_TAIL(float  , avx512, _mm512, ps   , _mm512_set1_ps     )
+FASTOR_MAKE_MASKED_TAIL(double , sse   , _mm   , pd   , _mm_set1_pd        )
+FASTOR_MAKE_MASKED_TAIL(double , avx   , _mm256, pd   , _mm256_set1_pd     )
+FASTOR_MAKE_MASKED_TAIL(double , avx512, _mm512, pd   , _mm512_set1_pd     )
+FASTOR_MAKE_MASKED_TAIL(int32_t, sse   , _mm   , epi32, _mm_set1_epi32     )
+FASTOR_MAKE_MASKED_TAIL(int32_t, avx   , _mm256, epi32, _mm256_set1_epi32  )
+FASTOR_MAKE_MASKED_TAIL(int32_t, avx512, _mm512, epi32, _mm512_set1_epi32  )
+FASTOR_MAKE_MASKED_TAIL(int64_t, sse   , _mm   , epi64, _mm_set1_epi64x    )
+FASTOR_MAKE_MASKED_TAIL(int64_t, avx   , _mm256, epi64, _mm256_set1_epi64x )
+FASTOR_MAKE_MASKED_TAIL(int64_t, avx512, _mm512, epi64, _mm512_set1_epi64  )
+
+#elif defined(FASTOR_AVX2_IMPL)
+#define FASTOR_MAKE_MASKED_TAIL(TYPE, ABI, MM, EPI, PTR_TYPE, BLENDV, CAST, LANEMASK, SET1)\
+namespace internal {\
+template<> struct has_masked_tail<SIMDVector<TYPE,simd_abi::ABI>> {\
+    static constexpr bool value = true;\
+};\
+}\
+FASTOR_INLINE void tail_store(TYPE * FASTOR_RESTRICT a, const SIMDVector<TYPE,simd_abi::ABI> &v, FASTOR_INDEX n) {\
+    MM ##_maskstore_ ##EPI (reinterpret_cast<PTR_TYPE*>(a), LANEMASK(int(n)), v.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> tail_blend(const SIMDVector<TYPE,simd_abi::ABI> &v, FASTOR_INDEX n, TYPE fill) {\
+    return BLENDV(SET1(fill), v.value, CAST(LANEMASK(int(n))));\
+}\
+
+FASTOR_MAKE_MASKED_TAIL(float  , sse, _mm   , ps   , float    , _mm_blendv_ps     , _mm_castsi128_ps   , _mm_lanemask_epi32   , _mm_set1_ps       )
+FASTOR_MAKE_MASKED_TAIL(float  , avx, _mm256, ps   , float    , _mm256_blendv_ps  , _mm256_castsi256_ps, _mm256_lanemask_epi32, _mm256_set1_ps    )
+FASTOR_MAKE_MASKED_TAIL(double , sse, _mm   , pd   , double   , _mm_blendv_pd     , _mm_castsi128_pd   , _mm_lanemask_epi64   , _mm_set1_pd       )
+FASTOR_MAKE_MASKED_TAIL(double , avx, _mm256, pd   , double   , _mm256_blendv_pd  , _mm256_castsi256_pd, _mm256_lanemask_epi64, _mm256_set1_pd    )
+FASTOR_MAKE_MASKED_TAIL(int32_t, sse, _mm   , epi32, int      , _mm_blendv_epi8   ,                    , _mm_lanemask_epi32   , _mm_set1_epi32    )
+FASTOR_MAKE_MASKED_TAIL(int32_t, avx, _mm256, epi32, int      , _mm256_blendv_epi8,                    , _mm256_lanemask_epi32, _mm256_set1_epi32 )
+FASTOR_MAKE_MASKED_TAIL(int64_t, sse, _mm   , epi64, long long, _mm_blendv_epi8   ,                    , _mm_lanemask_epi64   , _mm_set1_epi64x   )
+FASTOR_MAKE_MASKED_TAIL(int64_t, avx, _mm256, epi64, long long, _mm256_blendv_epi8,                    , _mm256_lanemask_epi64, _mm256_set1_epi64x)
+#endif
+//----------------------------------------------------------------------------------------------------------------
+
+
+
+
 
 
 
@@ -710,6 +986,52 @@ FASTOR_INLINE SIMDVector<T,ABI> fnmadd(const SIMDVector<T,ABI> &a, const SIMDVec
     return c-a*b;
 }
 
+#ifdef FASTOR_NEON_IMPL
+// FMA is part of AArch64
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> fmadd<float,simd_abi::neon>(
+    const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b, const SIMDVector<float,simd_abi::neon> &c) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vfmaq_f32(c.value,a.value,b.value);
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> fmadd<double,simd_abi::neon>(
+    const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b, const SIMDVector<double,simd_abi::neon> &c) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vfmaq_f64(c.value,a.value,b.value);
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> fmsub<float,simd_abi::neon>(
+    const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b, const SIMDVector<float,simd_abi::neon> &c) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vnegq_f32(vfmsq_f32(c.value,a.value,b.value));
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> fmsub<double,simd_abi::neon>(
+    const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b, const SIMDVector<double,simd_abi::neon> &c) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vnegq_f64(vfmsq_f64(c.value,a.value,b.value));
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> fnmadd<float,simd_abi::neon>(
+    const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b, const SIMDVector<float,simd_abi::neon> &c) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vfmsq_f32(c.value,a.value,b.value);
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> fnmadd<double,simd_abi::neon>(
+    const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b, const SIMDVector<double,simd_abi::neon> &c) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vfmsq_f64(c.value,a.value,b.value);
+    return out;
+}
+#endif
+
 #ifdef FASTOR_FMA_IMPL
 // fmadd
 template<>
@@ -182,8 +182,16 @@ struct SIMDVector<double, simd_abi::avx512> {
     FASTOR_INLINE SIMDVector<double,simd_abi::avx512> reverse() {
         return _mm512_reverse_pd(value);
     }
-    // FASTOR_INLINE double minimum() {return _mm512_hmin_pd(value);}
-    // FASTOR_INLINE double maximum() {return _mm512_hmax_pd(value);}
+    FASTOR_INLINE double minimum() {
+        __m256d low  = _mm512_castpd512_pd256(value);
+        __m256d high = _mm512_extractf64x4_pd(value,1);
+        return _mm256_hmin_pd(_mm256_min_pd(low,high));
+    }
+    FASTOR_INLINE double maximum() {
+        __m256d low  = _mm512_castpd512_pd256(value);
+        __m256d high = _mm512_extractf64x4_pd(value,1);
+        return _mm256_hmax_pd(_mm256_max_pd(low,high));
+    }
 
     FASTOR_INLINE double dot(const SIMDVector<double,simd_abi::avx512> &other) {
         __m512d res =  _mm512_mul_pd(value,other.value);
@@ -909,6 +917,270 @@ FASTOR_INLINE SIMDVector<double,simd_abi::sse> abs(const SIMDVector<double,simd_
 #endif
 
 
+// NEON VERSION
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FASTOR_NEON_IMPL
+
+template <>
+struct SIMDVector<double,simd_abi::neon> {
+    using value_type = float64x2_t;
+    using scalar_value_type = double;
+    using abi_type = simd_abi::neon;
+    static constexpr FASTOR_INDEX Size = internal::get_simd_vector_size<SIMDVector<double,simd_abi::neon>>::value;
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return internal::get_simd_vector_size<SIMDVector<double,simd_abi::neon>>::value;}
+
+    FASTOR_INLINE SIMDVector() : value(vdupq_n_f64(0.0)) {}
+    FASTOR_INLINE SIMDVector(double num) : value(vdupq_n_f64(num)) {}
+    FASTOR_INLINE SIMDVector(float64x2_t regi) : value(regi) {}
+    // NEON loads/stores have no alignment requirement
+    FASTOR_INLINE SIMDVector(const double *data, bool Aligned=true) : value(vld1q_f64(data)) {
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator=(double num) {
+        value = vdupq_n_f64(num);
+        return *this;
+    }
+    FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator=(float64x2_t regi) {
+        value = regi;
+        return *this;
+    }
+
+    FASTOR_INLINE void load(const double *data, bool Aligned=true) {
+        value = vld1q_f64(data);
+        unused(Aligned);
+    }
+    FASTOR_INLINE void store(double *data, bool Aligned=true) const {
+        vst1q_f64(data,value);
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE void aligned_load(const double *data) {
+        value = vld1q_f64(data);
+    }
+    FASTOR_INLINE void aligned_store(double *data) const {
+        vst1q_f64(data,value);
+    }
+
+    FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        value = vdupq_n_f64(0.0);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                ((scalar_value_type*)&value)[Size - i - 1] = a[Size - i - 1];
+            }
+        }
+        unused(Aligned);
+    }
+    FASTOR_INLINE void mask_store(scalar_value_type *a, uint8_t mask, bool Aligned=false) const {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                a[Size - i - 1] = ((const scalar_value_type*)&value)[Size - i - 1];
+            }
+            else {
+                a[Size - i - 1] = 0;
+            }
+        }
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE double operator[](FASTOR_INDEX i) const {return reinterpret_cast<const double*>(&value)[i];}
+    FASTOR_INLINE double operator()(FASTOR_INDEX i) const {return reinterpret_cast<const double*>(&value)[i];}
+
+    FASTOR_INLINE void set(double num) {
+        value = vdupq_n_f64(num);
+    }
+    FASTOR_INLINE void set(double num0, double num1) {
+        const double data[2] = {num1,num0};
+        value = vld1q_f64(data);
+    }
+    FASTOR_INLINE void set_sequential(double num0) {
+        const double data[2] = {num0,num0+1.0};
+        value = vld1q_f64(data);
+    }
+    FASTOR_INLINE void broadcast(const double *data) {
+        value = vld1q_dup_f64(data);
+    }
+
+    // In-place operators
+    FASTOR_INLINE void operator+=(double num) {
+        value = vaddq_f64(value,vdupq_n_f64(num));
+    }
+    FASTOR_INLINE void operator+=(float64x2_t regi) {
+        value = vaddq_f64(value,regi);
+    }
+    FASTOR_INLINE void operator+=(const SIMDVector<double,simd_abi::neon> &a) {
+        value = vaddq_f64(value,a.value);
+    }
+
+    FASTOR_INLINE void operator-=(double num) {
+        value = vsubq_f64(value,vdupq_n_f64(num));
+    }
+    FASTOR_INLINE void operator-=(float64x2_t regi) {
+        value = vsubq_f64(value,regi);
+    }
+    FASTOR_INLINE void operator-=(const SIMDVector<double,simd_abi::neon> &a) {
+        value = vsubq_f64(value,a.value);
+    }
+
+    FASTOR_INLINE void operator*=(double num) {
+        value = vmulq_n_f64(value,num);
+    }
+    FASTOR_INLINE void operator*=(float64x2_t regi) {
+        value = vmulq_f64(value,regi);
+    }
+    FASTOR_INLINE void operator*=(const SIMDVector<double,simd_abi::neon> &a) {
+        value = vmulq_f64(value,a.value);
+    }
+
+    FASTOR_INLINE void operator/=(double num) {
+        value = vdivq_f64(value,vdupq_n_f64(num));
+    }
+    FASTOR_INLINE void operator/=(float64x2_t regi) {
+        value = vdivq_f64(value,regi);
+    }
+    FASTOR_INLINE void operator/=(const SIMDVector<double,simd_abi::neon> &a) {
+        value = vdivq_f64(value,a.value);
+    }
+    // end of in-place operators
+
+    FASTOR_INLINE SIMDVector<double,simd_abi::neon> shift(FASTOR_INDEX i) {
+        SIMDVector<double,simd_abi::neon> out;
+        FASTOR_ASSERT(i==1,"INCORRECT SHIFT INDEX");
+            out.value = vshift1q_f64(value);
+        return out;
+    }
+    FASTOR_INLINE double sum() {return vaddvq_f64(value);}
+    FASTOR_INLINE double product() {return vprodvq_f64(value);}
+    FASTOR_INLINE SIMDVector<double,simd_abi::neon> reverse() {
+        SIMDVector<double,simd_abi::neon> out;
+        out.value = vreverseq_f64(value);
+        return out;
+    }
+    FASTOR_INLINE double minimum() {return vminvq_f64(value);}
+    FASTOR_INLINE double maximum() {return vmaxvq_f64(value);}
+
+    FASTOR_INLINE double dot(const SIMDVector<double,simd_abi::neon> &other) {
+        return vaddvq_f64(vmulq_f64(value,other.value));
+    }
+
+    float64x2_t value;
+};
+
+
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<double,simd_abi::neon> a) {
+    double value[2];
+    vst1q_f64(value,a.value);
+    os << "[" << value[0] <<  " " << value[1] << "]\n";
+    return os;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator+(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vaddq_f64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator+(const SIMDVector<double,simd_abi::neon> &a, double b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vaddq_f64(a.value,vdupq_n_f64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator+(double a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vaddq_f64(vdupq_n_f64(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator+(const SIMDVector<double,simd_abi::neon> &b) {
+    return b;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator-(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vsubq_f64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator-(const SIMDVector<double,simd_abi::neon> &a, double b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vsubq_f64(a.value,vdupq_n_f64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator-(double a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vsubq_f64(vdupq_n_f64(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator-(const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vnegq_f64(b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator*(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vmulq_f64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator*(const SIMDVector<double,simd_abi::neon> &a, double b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vmulq_n_f64(a.value,b);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator*(double a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vmulq_n_f64(b.value,a);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator/(const SIMDVector<double,simd_abi::neon> &a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vdivq_f64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator/(const SIMDVector<double,simd_abi::neon> &a, double b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vdivq_f64(a.value,vdupq_n_f64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> operator/(double a, const SIMDVector<double,simd_abi::neon> &b) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vdivq_f64(vdupq_n_f64(a),b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> rcp(const SIMDVector<double,simd_abi::neon> &a) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vrecpeq_f64(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> sqrt(const SIMDVector<double,simd_abi::neon> &a) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vsqrtq_f64(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> rsqrt(const SIMDVector<double,simd_abi::neon> &a) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vrsqrteq_f64(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<double,simd_abi::neon> abs(const SIMDVector<double,simd_abi::neon> &a) {
+    SIMDVector<double,simd_abi::neon> out;
+    out.value = vabsq_f64(a.value);
+    return out;
+}
+
+
+#endif
+
+
 } // end of namespace Fastor
 
 #endif // // SIMD_VECTOR_DOUBLE_H
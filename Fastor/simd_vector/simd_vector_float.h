@@ -178,8 +178,16 @@ struct SIMDVector<float,simd_abi::avx512> {
     FASTOR_INLINE SIMDVector<float,simd_abi::avx512> reverse() {
         return _mm512_reverse_ps(value);
     }
-    // FASTOR_INLINE float minimum() {return _mm512_hmin_ps(value);}
-    // FASTOR_INLINE float maximum() {return _mm512_hmax_ps(value);}
+    FASTOR_INLINE float minimum() {
+        __m256 low  = _mm512_castps512_ps256(value);
+        __m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value),1));
+        return _mm256_hmin_ps(_mm256_min_ps(low,high));
+    }
+    FASTOR_INLINE float maximum() {
+        __m256 low  = _mm512_castps512_ps256(value);
+        __m256 high = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(value),1));
+        return _mm256_hmax_ps(_mm256_max_ps(low,high));
+    }
 
     FASTOR_INLINE float dot(const SIMDVector<float,simd_abi::avx512> &other) {
         __m512 res =  _mm512_mul_ps(value,other.value);
@@ -912,6 +920,275 @@ FASTOR_INLINE SIMDVector<float,simd_abi::sse> abs(const SIMDVector<float,simd_ab
 #endif
 
 
+// NEON VERSION
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FASTOR_NEON_IMPL
+
+template <>
+struct SIMDVector<float,simd_abi::neon> {
+    using value_type = float32x4_t;
+    using scalar_value_type = float;
+    using abi_type = simd_abi::neon;
+    static constexpr FASTOR_INDEX Size = internal::get_simd_vector_size<SIMDVector<float,simd_abi::neon>>::value;
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return internal::get_simd_vector_size<SIMDVector<float,simd_abi::neon>>::value;}
+
+    FASTOR_INLINE SIMDVector() : value(vdupq_n_f32(0.f)) {}
+    FASTOR_INLINE SIMDVector(float num) : value(vdupq_n_f32(num)) {}
+    FASTOR_INLINE SIMDVector(float32x4_t regi) : value(regi) {}
+    // NEON loads/stores have no alignment requirement
+    FASTOR_INLINE SIMDVector(const float *data, bool Aligned=true) : value(vld1q_f32(data)) {
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator=(float num) {
+        value = vdupq_n_f32(num);
+        return *this;
+    }
+    FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator=(float32x4_t regi) {
+        value = regi;
+        return *this;
+    }
+
+    FASTOR_INLINE void load(const float *data, bool Aligned=true) {
+        value = vld1q_f32(data);
+        unused(Aligned);
+    }
+    FASTOR_INLINE void store(float *data, bool Aligned=true) const {
+        vst1q_f32(data,value);
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE void aligned_load(const float *data) {
+        value = vld1q_f32(data);
+    }
+    FASTOR_INLINE void aligned_store(float *data) const {
+        vst1q_f32(data,value);
+    }
+
+    FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        value = vdupq_n_f32(0.f);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                ((scalar_value_type*)&value)[Size - i - 1] = a[Size - i - 1];
+            }
+        }
+        unused(Aligned);
+    }
+    FASTOR_INLINE void mask_store(scalar_value_type *a, uint8_t mask, bool Aligned=false) const {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                a[Size - i - 1] = ((const scalar_value_type*)&value)[Size - i - 1];
+            }
+            else {
+                a[Size - i - 1] = 0;
+            }
+        }
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE float operator[](FASTOR_INDEX i) const {return reinterpret_cast<const float*>(&value)[i];}
+    FASTOR_INLINE float operator()(FASTOR_INDEX i) const {return reinterpret_cast<const float*>(&value)[i];}
+
+    FASTOR_INLINE void set(float num) {
+        value = vdupq_n_f32(num);
+    }
+    FASTOR_INLINE void set(float num0, float num1, float num2, float num3) {
+        const float data[4] = {num3,num2,num1,num0};
+        value = vld1q_f32(data);
+    }
+    FASTOR_INLINE void set_sequential(float num0) {
+        const float data[4] = {num0,num0+1.f,num0+2.f,num0+3.f};
+        value = vld1q_f32(data);
+    }
+    FASTOR_INLINE void broadcast(const float *data) {
+        value = vld1q_dup_f32(data);
+    }
+
+    // In-place operators
+    FASTOR_INLINE void operator+=(float num) {
+        value = vaddq_f32(value,vdupq_n_f32(num));
+    }
+    FASTOR_INLINE void operator+=(float32x4_t regi) {
+        value = vaddq_f32(value,regi);
+    }
+    FASTOR_INLINE void operator+=(const SIMDVector<float,simd_abi::neon> &a) {
+        value = vaddq_f32(value,a.value);
+    }
+
+    FASTOR_INLINE void operator-=(float num) {
+        value = vsubq_f32(value,vdupq_n_f32(num));
+    }
+    FASTOR_INLINE void operator-=(float32x4_t regi) {
+        value = vsubq_f32(value,regi);
+    }
+    FASTOR_INLINE void operator-=(const SIMDVector<float,simd_abi::neon> &a) {
+        value = vsubq_f32(value,a.value);
+    }
+
+    FASTOR_INLINE void operator*=(float num) {
+        value = vmulq_n_f32(value,num);
+    }
+    FASTOR_INLINE void operator*=(float32x4_t regi) {
+        value = vmulq_f32(value,regi);
+    }
+    FASTOR_INLINE void operator*=(const SIMDVector<float,simd_abi::neon> &a) {
+        value = vmulq_f32(value,a.value);
+    }
+
+    FASTOR_INLINE void operator/=(float num) {
+        value = vdivq_f32(value,vdupq_n_f32(num));
+    }
+    FASTOR_INLINE void operator/=(float32x4_t regi) {
+        value = vdivq_f32(value,regi);
+    }
+    FASTOR_INLINE void operator/=(const SIMDVector<float,simd_abi::neon> &a) {
+        value = vdivq_f32(value,a.value);
+    }
+    // end of in-place operators
+
+    FASTOR_INLINE SIMDVector<float,simd_abi::neon> shift(FASTOR_INDEX i) {
+        SIMDVector<float,simd_abi::neon> out;
+        if (i==1)
+            out.value = vshift1q_f32(value);
+        else if (i==2)
+            out.value = vshift2q_f32(value);
+        else if (i==3)
+            out.value = vshift3q_f32(value);
+        return out;
+    }
+    FASTOR_INLINE float sum() {return vaddvq_f32(value);}
+    FASTOR_INLINE float product() {return vprodvq_f32(value);}
+    FASTOR_INLINE SIMDVector<float,simd_abi::neon> reverse() {
+        SIMDVector<float,simd_abi::neon> out;
+        out.value = vreverseq_f32(value);
+        return out;
+    }
+    FASTOR_INLINE float minimum() {return vminvq_f32(value);}
+    FASTOR_INLINE float maximum() {return vmaxvq_f32(value);}
+
+    FASTOR_INLINE float dot(const SIMDVector<float,simd_abi::neon> &other) {
+        return vaddvq_f32(vmulq_f32(value,other.value));
+    }
+
+    float32x4_t value;
+};
+
+
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<float,simd_abi::neon> a) {
+    float value[4];
+    vst1q_f32(value,a.value);
+    os << "[" << value[0] <<  " " << value[1] << " "
+       << value[2] << " " << value[3] << "]\n";
+    return os;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator+(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vaddq_f32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator+(const SIMDVector<float,simd_abi::neon> &a, float b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vaddq_f32(a.value,vdupq_n_f32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator+(float a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vaddq_f32(vdupq_n_f32(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator+(const SIMDVector<float,simd_abi::neon> &b) {
+    return b;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator-(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vsubq_f32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator-(const SIMDVector<float,simd_abi::neon> &a, float b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vsubq_f32(a.value,vdupq_n_f32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator-(float a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vsubq_f32(vdupq_n_f32(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator-(const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vnegq_f32(b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator*(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vmulq_f32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator*(const SIMDVector<float,simd_abi::neon> &a, float b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vmulq_n_f32(a.value,b);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator*(float a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vmulq_n_f32(b.value,a);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator/(const SIMDVector<float,simd_abi::neon> &a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vdivq_f32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator/(const SIMDVector<float,simd_abi::neon> &a, float b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vdivq_f32(a.value,vdupq_n_f32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> operator/(float a, const SIMDVector<float,simd_abi::neon> &b) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vdivq_f32(vdupq_n_f32(a),b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> rcp(const SIMDVector<float,simd_abi::neon> &a) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vrecpeq_f32(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> sqrt(const SIMDVector<float,simd_abi::neon> &a) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vsqrtq_f32(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> rsqrt(const SIMDVector<float,simd_abi::neon> &a) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vrsqrteq_f32(a.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<float,simd_abi::neon> abs(const SIMDVector<float,simd_abi::neon> &a) {
+    SIMDVector<float,simd_abi::neon> out;
+    out.value = vabsq_f32(a.value);
+    return out;
+}
+
+
+#endif
+
+
 } // end of namespace Fastor
 
 
@@ -0,0 +1,502 @@
+#ifndef SIMD_VECTOR_HALF_H
+#define SIMD_VECTOR_HALF_H
+
+#include "Fastor/simd_vector/simd_vector_base.h"
+#include "Fastor/simd_vector/simd_vector_scalar.h"
+#include "Fastor/simd_vector/simd_vector_float.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Fastor {
+
+/* Half precision storage types, float16 is IEEE binary16 and bfloat16 is the upper half of a
+   float. They are meant for large tensors of field data that are read and written at half the
+   memory traffic of float. All arithmetic is done in single precision, values are widened on
+   load and rounded to nearest [ties to even] on store
+*/
+//-----------------------------------------------------------------------------------------------
+
+namespace internal {
+
+FASTOR_INLINE uint32_t float_as_bits(float a) {
+    uint32_t bits; std::memcpy(&bits,&a,sizeof(float));
+    return bits;
+}
+FASTOR_INLINE float bits_as_float(uint32_t bits) {
+    float a; std::memcpy(&a,&bits,sizeof(float));
+    return a;
+}
+
+FASTOR_INLINE uint16_t float_to_float16_bits(float a) {
+#ifdef FASTOR_F16C_IMPL
+    return (uint16_t)_cvtss_sh(a,_MM_FROUND_TO_NEAREST_INT);
+#else
+    const uint32_t bits = float_as_bits(a);
+    const uint16_t sign = (uint16_t)((bits >> 16) & 0x8000u);
+    uint32_t abits = bits & 0x7FFFFFFFu;
+    // inf and nan, keeping nans quiet
+    if (abits >= 0x7F800000u) {
+        return sign | 0x7C00u | (abits > 0x7F800000u ? 0x0200u | ((abits >> 13) & 0x03FFu) : 0u);
+    }
+    // rounds up to 65520 and beyond
+    if (abits >= 0x477FF000u) {
+        return sign | 0x7C00u;
+    }
+    // subnormals, adding 0.5 lines the mantissa up with the 2^-24 spacing of half subnormals
+    // and lets the floating point addition do the rounding
+    if (abits < 0x38800000u) {
+        return sign | (uint16_t)(float_as_bits(bits_as_float(abits) + 0.5f) - 0x3F000000u);
+    }
+    // normals, rebias the exponent and round the 13 dropped bits
+    abits += 0xC8000FFFu + ((abits >> 13) & 1u);
+    return sign | (uint16_t)(abits >> 13);
+#endif
+}
+
+FASTOR_INLINE float float16_bits_to_float(uint16_t h) {
+#ifdef FASTOR_F16C_IMPL
+    return _cvtsh_ss(h);
+#else
+    const uint32_t sign = uint32_t(h & 0x8000u) << 16;
+    const uint32_t abits = h & 0x7FFFu;
+    if (abits >= 0x7C00u) {
+        return bits_as_float(sign | 0x7F800000u | ((abits & 0x03FFu) << 13));
+    }
+    if (abits >= 0x0400u) {
+        return bits_as_float(sign | ((abits << 13) + 0x38000000u));
+    }
+    return bits_as_float(sign | float_as_bits(float(abits)*5.9604644775390625e-8f));
+#endif
+}
+
+FASTOR_INLINE uint16_t float_to_bfloat16_bits(float a) {
+    const uint32_t bits = float_as_bits(a);
+    // nans are made quiet rather than rounded as rounding could turn them in to infs
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u) {
+        return (uint16_t)((bits >> 16) | 0x0040u);
+    }
+    return (uint16_t)((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+}
+
+FASTOR_INLINE float bfloat16_bits_to_float(uint16_t h) {
+    return bits_as_float(uint32_t(h) << 16);
+}
+
+} // internal
+
+
+#define FASTOR_MAKE_HALF_TYPE(HALF)\
+struct HALF {\
+    HALF() = default;\
+    FASTOR_INLINE HALF(float a) : bits(internal::float_to_##HALF##_bits(a)) {}\
+    FASTOR_INLINE operator float() const {return internal::HALF##_bits_to_float(bits);}\
+\
+    static FASTOR_INLINE HALF from_bits(uint16_t b) {HALF out; out.bits = b; return out;}\
+\
+    FASTOR_INLINE HALF& operator+=(float a) {return *this = float(*this) + a;}\
+    FASTOR_INLINE HALF& operator-=(float a) {return *this = float(*this) - a;}\
+    FASTOR_INLINE HALF& operator*=(float a) {return *this = float(*this) * a;}\
+    FASTOR_INLINE HALF& operator/=(float a) {return *this = float(*this) / a;}\
+\
+    uint16_t bits;\
+};\
+
+FASTOR_MAKE_HALF_TYPE(float16)
+FASTOR_MAKE_HALF_TYPE(bfloat16)
+
+template<typename T>
+struct is_half_precision {
+    static constexpr bool value = std::is_same<T,float16>::value || std::is_same<T,bfloat16>::value;
+};
+template<typename T>
+static constexpr bool is_half_precision_v = is_half_precision<T>::value;
+
+// So that half precision scalars can be used in tensor expressions
+template<> struct is_primitive<float16>  { static constexpr bool value = true; };
+template<> struct is_primitive<bfloat16> { static constexpr bool value = true; };
+
+
+namespace internal {
+
+// Half precision SIMDVectors hold a float SIMDVector so they have as many lanes as float does
+template<template<typename, typename> class __svec, typename ABI>
+struct get_simd_vector_size<__svec<float16,ABI>> {
+    static constexpr size_t bitsize = get_simd_vector_size<__svec<float,ABI>>::bitsize;
+    static constexpr size_t value = get_simd_vector_size<__svec<float,ABI>>::value;
+};
+template<template<typename, typename> class __svec, typename ABI>
+struct get_simd_vector_size<__svec<bfloat16,ABI>> {
+    static constexpr size_t bitsize = get_simd_vector_size<__svec<float,ABI>>::bitsize;
+    static constexpr size_t value = get_simd_vector_size<__svec<float,ABI>>::value;
+};
+
+
+// Widening loads and narrowing stores, the generic versions go through memory
+//-----------------------------------------------------------------------------------------------
+template<typename HALF, typename ABI>
+FASTOR_INLINE SIMDVector<float,ABI> half_to_float(const HALF *data) {
+    float vals[SIMDVector<float,ABI>::Size];
+    for (FASTOR_INDEX i=0; i<SIMDVector<float,ABI>::Size; ++i) {
+        vals[i] = float(data[i]);
+    }
+    return SIMDVector<float,ABI>(vals,false);
+}
+template<typename HALF, typename ABI>
+FASTOR_INLINE void float_to_half(HALF *data, const SIMDVector<float,ABI> &a) {
+    float vals[SIMDVector<float,ABI>::Size];
+    a.store(vals,false);
+    for (FASTOR_INDEX i=0; i<SIMDVector<float,ABI>::Size; ++i) {
+        data[i] = HALF(vals[i]);
+    }
+}
+
+// float16 with F16C
+#ifdef FASTOR_F16C_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::sse> half_to_float<float16,simd_abi::sse>(const float16 *data) {
+    return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)data));
+}
+template<>
+FASTOR_INLINE void float_to_half<float16,simd_abi::sse>(float16 *data, const SIMDVector<float,simd_abi::sse> &a) {
+    _mm_storel_epi64((__m128i*)data,_mm_cvtps_ph(a.value,_MM_FROUND_TO_NEAREST_INT));
+}
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx> half_to_float<float16,simd_abi::avx>(const float16 *data) {
+    return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)data));
+}
+template<>
+FASTOR_INLINE void float_to_half<float16,simd_abi::avx>(float16 *data, const SIMDVector<float,simd_abi::avx> &a) {
+    _mm_storeu_si128((__m128i*)data,_mm256_cvtps_ph(a.value,_MM_FROUND_TO_NEAREST_INT));
+}
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx512> half_to_float<float16,simd_abi::avx512>(const float16 *data) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)data));
+}
+template<>
+FASTOR_INLINE void float_to_half<float16,simd_abi::avx512>(float16 *data, const SIMDVector<float,simd_abi::avx512> &a) {
+    _mm256_storeu_si256((__m256i*)data,_mm512_cvtps_ph(a.value,_MM_FROUND_TO_NEAREST_INT));
+}
+#endif
+
+// bfloat16 is widened by shifting it in to the upper half of a float. Without AVX512_BF16 it is
+// rounded with integer arithmetic in the same way as float_to_bfloat16_bits
+#ifdef FASTOR_SSE2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::sse> half_to_float<bfloat16,simd_abi::sse>(const bfloat16 *data) {
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(),_mm_loadl_epi64((const __m128i*)data)));
+}
+template<>
+FASTOR_INLINE void float_to_half<bfloat16,simd_abi::sse>(bfloat16 *data, const SIMDVector<float,simd_abi::sse> &a) {
+#if defined(FASTOR_AVX512BF16_IMPL) && defined(FASTOR_AVX512VL_IMPL)
+    _mm_storel_epi64((__m128i*)data,(__m128i)_mm_cvtneps_pbh(a.value));
+#else
+    const __m128i bits = _mm_castps_si128(a.value);
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits,16),_mm_set1_epi32(1));
+    __m128i rounded = _mm_srli_epi32(_mm_add_epi32(bits,_mm_add_epi32(lsb,_mm_set1_epi32(0x7FFF))),16);
+    const __m128i nans = _mm_castps_si128(_mm_cmpunord_ps(a.value,a.value));
+    const __m128i quiet = _mm_or_si128(_mm_srli_epi32(bits,16),_mm_set1_epi32(0x0040));
+    rounded = _mm_or_si128(_mm_and_si128(nans,quiet),_mm_andnot_si128(nans,rounded));
+    // sign extend the low 16 bits first as packing saturates
+    rounded = _mm_srai_epi32(_mm_slli_epi32(rounded,16),16);
+    _mm_storel_epi64((__m128i*)data,_mm_packs_epi32(rounded,rounded));
+#endif
+}
+#endif
+#ifdef FASTOR_AVX2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx> half_to_float<bfloat16,simd_abi::avx>(const bfloat16 *data) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)data)),16));
+}
+template<>
+FASTOR_INLINE void float_to_half<bfloat16,simd_abi::avx>(bfloat16 *data, const SIMDVector<float,simd_abi::avx> &a) {
+#if defined(FASTOR_AVX512BF16_IMPL) && defined(FASTOR_AVX512VL_IMPL)
+    _mm_storeu_si128((__m128i*)data,(__m128i)_mm256_cvtneps_pbh(a.value));
+#else
+    const __m256i bits = _mm256_castps_si256(a.value);
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits,16),_mm256_set1_epi32(1));
+    __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits,_mm256_add_epi32(lsb,_mm256_set1_epi32(0x7FFF))),16);
+    const __m256i nans = _mm256_castps_si256(_mm256_cmp_ps(a.value,a.value,_CMP_UNORD_Q));
+    const __m256i quiet = _mm256_or_si256(_mm256_srli_epi32(bits,16),_mm256_set1_epi32(0x0040));
+    rounded = _mm256_blendv_epi8(rounded,quiet,nans);
+    // sign extend the low 16 bits first as packing saturates, packing works within 128 bit
+    // lanes so the two halves are brought together afterwards
+    rounded = _mm256_srai_epi32(_mm256_slli_epi32(rounded,16),16);
+    rounded = _mm256_permute4x64_epi64(_mm256_packs_epi32(rounded,rounded),0xD8);
+    _mm_storeu_si128((__m128i*)data,_mm256_castsi256_si128(rounded));
+#endif
+}
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx512> half_to_float<bfloat16,simd_abi::avx512>(const bfloat16 *data) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)data)),16));
+}
+template<>
+FASTOR_INLINE void float_to_half<bfloat16,simd_abi::avx512>(bfloat16 *data, const SIMDVector<float,simd_abi::avx512> &a) {
+#if defined(FASTOR_AVX512BF16_IMPL)
+    _mm256_storeu_si256((__m256i*)data,(__m256i)_mm512_cvtneps_pbh(a.value));
+#else
+    const __m512i bits = _mm512_castps_si512(a.value);
+    const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits,16),_mm512_set1_epi32(1));
+    __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(bits,_mm512_add_epi32(lsb,_mm512_set1_epi32(0x7FFF))),16);
+    const __mmask16 nans = _mm512_cmp_ps_mask(a.value,a.value,_CMP_UNORD_Q);
+    rounded = _mm512_mask_mov_epi32(rounded,nans,_mm512_or_si512(_mm512_srli_epi32(bits,16),_mm512_set1_epi32(0x0040)));
+    _mm256_storeu_si256((__m256i*)data,_mm512_cvtepi32_epi16(rounded));
+#endif
+}
+#endif
+//-----------------------------------------------------------------------------------------------
+
+
+template<typename HALF, typename ABI>
+struct half_simd_vector {
+    using value_type = SIMDVector<float,ABI>;
+    using scalar_value_type = HALF;
+    using abi_type = ABI;
+    static constexpr FASTOR_INDEX Size = SIMDVector<float,ABI>::Size;
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return SIMDVector<float,ABI>::Size;}
+
+    FASTOR_INLINE half_simd_vector() : value() {}
+    FASTOR_INLINE half_simd_vector(HALF num) : value(float(num)) {}
+    // Without this a literal 0 is ambiguous between a HALF and a null pointer
+    template<typename U, enable_if_t_<std::is_arithmetic<U>::value,bool> = false>
+    FASTOR_INLINE half_simd_vector(U num) : value(float(num)) {}
+    FASTOR_INLINE half_simd_vector(const SIMDVector<float,ABI> &a) : value(a) {}
+    FASTOR_INLINE half_simd_vector(const HALF *data, bool Aligned=true) : value(half_to_float<HALF,ABI>(data)) {unused(Aligned);}
+
+    FASTOR_INLINE void load(const HALF *data, bool Aligned=true) {
+        value = half_to_float<HALF,ABI>(data);
+        unused(Aligned);
+    }
+    FASTOR_INLINE void store(HALF *data, bool Aligned=true) const {
+        float_to_half<HALF,ABI>(data,value);
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE void aligned_load(const HALF *data) {
+        value = half_to_float<HALF,ABI>(data);
+    }
+    FASTOR_INLINE void aligned_store(HALF *data) const {
+        float_to_half<HALF,ABI>(data,value);
+    }
+
+    FASTOR_INLINE HALF operator[](FASTOR_INDEX i) const {return HALF(value[i]);}
+    FASTOR_INLINE HALF operator()(FASTOR_INDEX i) const {return HALF(value[i]);}
+
+    FASTOR_INLINE void set(HALF num) {
+        value = SIMDVector<float,ABI>(float(num));
+    }
+    // Like the _mm_set intrinsics the first value goes in to the last lane
+    template<typename ... Args>
+    FASTOR_INLINE void set(HALF first, Args ... args) {
+        static_assert(sizeof...(args)+1==Size,"CANNOT SET VECTOR WITH SPECIFIED NUMBER OF VALUES DUE TO ABI CONSIDERATION");
+        HALF vals[Size] = {first, HALF(args)...};
+        std::reverse(vals,vals+Size);
+        load(vals,false);
+    }
+    FASTOR_INLINE void set_sequential(HALF num0) {
+        value.set_sequential(float(num0));
+    }
+
+    // In-place operators
+    FASTOR_INLINE void operator+=(HALF num) {value += float(num);}
+    FASTOR_INLINE void operator+=(const half_simd_vector<HALF,ABI> &a) {value += a.value;}
+    FASTOR_INLINE void operator-=(HALF num) {value -= float(num);}
+    FASTOR_INLINE void operator-=(const half_simd_vector<HALF,ABI> &a) {value -= a.value;}
+    FASTOR_INLINE void operator*=(HALF num) {value *= float(num);}
+    FASTOR_INLINE void operator*=(const half_simd_vector<HALF,ABI> &a) {value *= a.value;}
+    FASTOR_INLINE void operator/=(HALF num) {value /= float(num);}
+    FASTOR_INLINE void operator/=(const half_simd_vector<HALF,ABI> &a) {value /= a.value;}
+    // end of in-place operators
+
+    FASTOR_INLINE HALF minimum() {return HALF(value.minimum());}
+    FASTOR_INLINE HALF maximum() {return HALF(value.maximum());}
+    FASTOR_INLINE SIMDVector<HALF,ABI> reverse() {return SIMDVector<HALF,ABI>(value.reverse());}
+
+    FASTOR_INLINE HALF sum() {return HALF(value.sum());}
+    FASTOR_INLINE HALF product() {return HALF(value.product());}
+    FASTOR_INLINE HALF dot(const half_simd_vector<HALF,ABI> &other) {return HALF(value.dot(other.value));}
+
+    SIMDVector<float,ABI> value;
+};
+
+template<typename HALF, typename ABI>
+constexpr FASTOR_INDEX half_simd_vector<HALF,ABI>::Size;
+
+
+// Whether a half precision SIMDVector exists for an ABI
+template<typename ABI>
+struct has_half_simd {
+    static constexpr bool value = false;
+};
+
+} // internal
+
+
+#define FASTOR_MAKE_HALF_SIMDVECTOR(HALF, ABI)\
+template<>\
+struct SIMDVector<HALF,simd_abi::ABI> : public internal::half_simd_vector<HALF,simd_abi::ABI> {\
+    using internal::half_simd_vector<HALF,simd_abi::ABI>::half_simd_vector;\
+};\
+
+#define FASTOR_MAKE_HALF_SIMD_ABI(ABI)\
+FASTOR_MAKE_HALF_SIMDVECTOR(float16, ABI)\
+FASTOR_MAKE_HALF_SIMDVECTOR(bfloat16, ABI)\
+namespace internal {\
+template<>\
+struct has_half_simd<simd_abi::ABI> {\
+    static constexpr bool value = true;\
+};\
+}\
+
+#ifdef FASTOR_AVX512_IMPL
+FASTOR_MAKE_HALF_SIMD_ABI(avx512)
+#endif
+#ifdef FASTOR_AVX_IMPL
+FASTOR_MAKE_HALF_SIMD_ABI(avx)
+#endif
+#ifdef FASTOR_SSE2_IMPL
+FASTOR_MAKE_HALF_SIMD_ABI(sse)
+#endif
+
+
+// Operators and math functions compute on the float SIMDVector
+//-----------------------------------------------------------------------------------------------
+#define FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_OP(HALF, OP)\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> operator OP(const SIMDVector<HALF,ABI> &a, const SIMDVector<HALF,ABI> &b) {\
+    return SIMDVector<HALF,ABI>(a.value OP b.value);\
+}\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> operator OP(const SIMDVector<HALF,ABI> &a, HALF b) {\
+    return SIMDVector<HALF,ABI>(a.value OP float(b));\
+}\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> operator OP(HALF a, const SIMDVector<HALF,ABI> &b) {\
+    return SIMDVector<HALF,ABI>(float(a) OP b.value);\
+}\
+
+#define FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, FUNC)\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> FUNC(const SIMDVector<HALF,ABI> &a) {\
+    return SIMDVector<HALF,ABI>(FUNC(a.value));\
+}\
+
+#define FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, FUNC)\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> FUNC(const SIMDVector<HALF,ABI> &a, const SIMDVector<HALF,ABI> &b) {\
+    return SIMDVector<HALF,ABI>(FUNC(a.value,b.value));\
+}\
+
+#define FASTOR_MAKE_HALF_SIMDVECTOR_BOOL_FUNC(HALF, FUNC)\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<bool,simd_abi::fixed_size<SIMDVector<HALF,ABI>::Size>> FUNC(const SIMDVector<HALF,ABI> &a) {\
+    return FUNC(a.value);\
+}\
+
+#define FASTOR_MAKE_HALF_SIMDVECTOR_OPS(HALF)\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<HALF,ABI> a) {\
+    os << a.value;\
+    return os;\
+}\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> operator+(const SIMDVector<HALF,ABI> &a) {\
+    return a;\
+}\
+template<typename ABI, enable_if_t_<internal::has_half_simd<ABI>::value,bool> = false>\
+FASTOR_INLINE SIMDVector<HALF,ABI> operator-(const SIMDVector<HALF,ABI> &a) {\
+    return SIMDVector<HALF,ABI>(-a.value);\
+}\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_OP(HALF, +)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_OP(HALF, -)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_OP(HALF, *)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_OP(HALF, /)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, rcp)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, sqrt)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, rsqrt)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, abs)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, cbrt)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, exp)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, exp2)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, expm1)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, log)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, log10)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, log2)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, log1p)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, sin)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, cos)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, tan)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, asin)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, acos)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, atan)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, sinh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, cosh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, tanh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, asinh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, acosh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, atanh)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, erf)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, tgamma)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, lgamma)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, ceil)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, round)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, floor)\
+FASTOR_MAKE_HALF_SIMDVECTOR_UNARY_FUNC(HALF, trunc)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, min)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, max)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, pow)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, atan2)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, hypot)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BINARY_FUNC(HALF, copysign)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BOOL_FUNC(HALF, operator!)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BOOL_FUNC(HALF, isinf)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BOOL_FUNC(HALF, isnan)\
+FASTOR_MAKE_HALF_SIMDVECTOR_BOOL_FUNC(HALF, isfinite)\
+
+FASTOR_MAKE_HALF_SIMDVECTOR_OPS(float16)
+FASTOR_MAKE_HALF_SIMDVECTOR_OPS(bfloat16)
+//-----------------------------------------------------------------------------------------------
+
+
+namespace internal {
+/* Converts n values between float and half precision using the SIMD conversions, any other
+   pair of types is converted with a static_cast
+*/
+template<typename T, typename U>
+FASTOR_INLINE void convert_data(const T *FASTOR_RESTRICT in, U *FASTOR_RESTRICT out, FASTOR_INDEX n) {
+    for (FASTOR_INDEX i=0; i<n; ++i) {
+        out[i] = static_cast<U>(in[i]);
+    }
+}
+template<typename HALF, enable_if_t_<is_half_precision_v<HALF> && has_half_simd<simd_abi::native>::value,bool> = false>
+FASTOR_INLINE void convert_data(const HALF *FASTOR_RESTRICT in, float *FASTOR_RESTRICT out, FASTOR_INDEX n) {
+    using V = SIMDVector<HALF,simd_abi::native>;
+    FASTOR_INDEX i = 0;
+    for (; i < ROUND_DOWN(n,V::Size); i+=V::Size) {
+        V(&in[i],false).value.store(&out[i],false);
+    }
+    for (; i < n; ++i) {
+        out[i] = float(in[i]);
+    }
+}
+template<typename HALF, enable_if_t_<is_half_precision_v<HALF> && has_half_simd<simd_abi::native>::value,bool> = false>
+FASTOR_INLINE void convert_data(const float *FASTOR_RESTRICT in, HALF *FASTOR_RESTRICT out, FASTOR_INDEX n) {
+    using V = SIMDVector<HALF,simd_abi::native>;
+    FASTOR_INDEX i = 0;
+    for (; i < ROUND_DOWN(n,V::Size); i+=V::Size) {
+        V _vec; _vec.value.load(&in[i],false);
+        _vec.store(&out[i],false);
+    }
+    for (; i < n; ++i) {
+        out[i] = HALF(in[i]);
+    }
+}
+} // internal
+
+} // end of namespace Fastor
+
+
+#endif // SIMD_VECTOR_HALF_H
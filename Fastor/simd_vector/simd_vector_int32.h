@@ -100,8 +100,8 @@ struct SIMDVector<int32_t,simd_abi::avx512> {
 #endif
     }
 
-    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
-    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
+    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void set(int32_t num) {
         value = _mm512_set1_epi32(num);
@@ -455,8 +455,8 @@ struct SIMDVector<int32_t,simd_abi::avx> {
 #endif
     }
 
-    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
-    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
+    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void set(int32_t num) {
         value = _mm256_set1_epi32(num);
@@ -775,8 +775,8 @@ struct SIMDVector<int32_t,simd_abi::sse> {
 #endif
     }
 
-    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
-    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
+    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {int32_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void set(int32_t num) {
         value = _mm_set1_epi32(num);
@@ -982,6 +982,268 @@ FASTOR_INLINE SIMDVector<int32_t,simd_abi::sse> abs(const SIMDVector<int32_t,sim
 #endif
 
 
+// NEON VERSION
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FASTOR_NEON_IMPL
+
+template<>
+struct SIMDVector<int32_t,simd_abi::neon> {
+    using value_type = int32x4_t;
+    using scalar_value_type = int32_t;
+    using abi_type = simd_abi::neon;
+    static constexpr FASTOR_INDEX Size = internal::get_simd_vector_size<SIMDVector<int32_t,simd_abi::neon>>::value;
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return internal::get_simd_vector_size<SIMDVector<int32_t,simd_abi::neon>>::value;}
+
+    FASTOR_INLINE SIMDVector() : value(vdupq_n_s32(0)) {}
+    FASTOR_INLINE SIMDVector(int32_t num) : value(vdupq_n_s32(num)) {}
+    FASTOR_INLINE SIMDVector(int32x4_t regi) : value(regi) {}
+    // NEON loads/stores have no alignment requirement
+    FASTOR_INLINE SIMDVector(const int32_t *data, bool Aligned=true) : value(vld1q_s32(data)) {
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator=(int32_t num) {
+        value = vdupq_n_s32(num);
+        return *this;
+    }
+    FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator=(int32x4_t regi) {
+        value = regi;
+        return *this;
+    }
+
+    FASTOR_INLINE void load(const int32_t *data, bool Aligned=true) {
+        value = vld1q_s32(data);
+        unused(Aligned);
+    }
+    FASTOR_INLINE void store(int32_t *data, bool Aligned=true) const {
+        vst1q_s32(data,value);
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE void aligned_load(const int32_t *data) {
+        value = vld1q_s32(data);
+    }
+    FASTOR_INLINE void aligned_store(int32_t *data) const {
+        vst1q_s32(data,value);
+    }
+
+    FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        value = vdupq_n_s32(0);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                ((scalar_value_type*)&value)[Size - i - 1] = a[Size - i - 1];
+            }
+        }
+        unused(Aligned);
+    }
+    FASTOR_INLINE void mask_store(scalar_value_type *a, uint8_t mask, bool Aligned=false) const {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                a[Size - i - 1] = ((const scalar_value_type*)&value)[Size - i - 1];
+            }
+            else {
+                a[Size - i - 1] = 0;
+            }
+        }
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE int32_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
+    FASTOR_INLINE int32_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int32_t*>(&value)[i];}
+
+    FASTOR_INLINE void set(int32_t num) {
+        value = vdupq_n_s32(num);
+    }
+    FASTOR_INLINE void set(int32_t num0, int32_t num1, int32_t num2, int32_t num3) {
+        const int32_t data[4] = {num3,num2,num1,num0};
+        value = vld1q_s32(data);
+    }
+    FASTOR_INLINE void set_sequential(int32_t num0) {
+        const int32_t data[4] = {num0,num0+1,num0+2,num0+3};
+        value = vld1q_s32(data);
+    }
+
+    // In-place operators
+    FASTOR_INLINE void operator+=(int32_t num) {
+        value = vaddq_s32(value,vdupq_n_s32(num));
+    }
+    FASTOR_INLINE void operator+=(int32x4_t regi) {
+        value = vaddq_s32(value,regi);
+    }
+    FASTOR_INLINE void operator+=(const SIMDVector<int32_t,simd_abi::neon> &a) {
+        value = vaddq_s32(value,a.value);
+    }
+
+    FASTOR_INLINE void operator-=(int32_t num) {
+        value = vsubq_s32(value,vdupq_n_s32(num));
+    }
+    FASTOR_INLINE void operator-=(int32x4_t regi) {
+        value = vsubq_s32(value,regi);
+    }
+    FASTOR_INLINE void operator-=(const SIMDVector<int32_t,simd_abi::neon> &a) {
+        value = vsubq_s32(value,a.value);
+    }
+
+    FASTOR_INLINE void operator*=(int32_t num) {
+        value = vmulq_s32(value,vdupq_n_s32(num));
+    }
+    FASTOR_INLINE void operator*=(int32x4_t regi) {
+        value = vmulq_s32(value,regi);
+    }
+    FASTOR_INLINE void operator*=(const SIMDVector<int32_t,simd_abi::neon> &a) {
+        value = vmulq_s32(value,a.value);
+    }
+
+    // There is no NEON integer division
+    FASTOR_INLINE void operator/=(int32_t num) {
+        int32_t val[Size]; vst1q_s32(val, value);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= num;
+        }
+        value = vld1q_s32(val);
+    }
+    FASTOR_INLINE void operator/=(int32x4_t regi) {
+        int32_t val[Size]; vst1q_s32(val, value);
+        int32_t val_num[Size]; vst1q_s32(val_num, regi);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= val_num[i];
+        }
+        value = vld1q_s32(val);
+    }
+    FASTOR_INLINE void operator/=(const SIMDVector<int32_t,simd_abi::neon> &a) {
+        int32_t val[Size]; vst1q_s32(val, value);
+        int32_t val_a[Size]; vst1q_s32(val_a, a.value);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= val_a[i];
+        }
+        value = vld1q_s32(val);
+    }
+
+    FASTOR_INLINE int32_t minimum() {return vminvq_s32(value);}
+    FASTOR_INLINE int32_t maximum() {return vmaxvq_s32(value);}
+    FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> reverse() {
+        return vreverseq_s32(value);
+    }
+
+    FASTOR_INLINE int32_t sum() {return vaddvq_s32(value);}
+    FASTOR_INLINE int32_t product() {return vprodvq_s32(value);}
+
+    FASTOR_INLINE int32_t dot(const SIMDVector<int32_t,simd_abi::neon> &other) {
+        return vaddvq_s32(vmulq_s32(value,other.value));
+    }
+
+    int32x4_t value;
+};
+
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<int32_t,simd_abi::neon> a) {
+    int32_t value[4];
+    vst1q_s32(value,a.value);
+    os << "[" << value[0] <<  " " << value[1] << " " << value[2] << " " << value[3] << "]\n";
+    return os;
+}
+
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator+(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vaddq_s32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator+(const SIMDVector<int32_t,simd_abi::neon> &a, int32_t b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vaddq_s32(a.value,vdupq_n_s32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator+(int32_t a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vaddq_s32(vdupq_n_s32(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator+(const SIMDVector<int32_t,simd_abi::neon> &b) {
+    return b;
+}
+
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator-(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vsubq_s32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator-(const SIMDVector<int32_t,simd_abi::neon> &a, int32_t b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vsubq_s32(a.value,vdupq_n_s32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator-(int32_t a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vsubq_s32(vdupq_n_s32(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator-(const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vnegq_s32(b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator*(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vmulq_s32(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator*(const SIMDVector<int32_t,simd_abi::neon> &a, int32_t b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vmulq_s32(a.value,vdupq_n_s32(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator*(int32_t a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vmulq_s32(vdupq_n_s32(a),b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator/(const SIMDVector<int32_t,simd_abi::neon> &a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    int32_t val_a[out.size()]; vst1q_s32(val_a, a.value);
+    int32_t val_b[out.size()]; vst1q_s32(val_b, b.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_a[i] /= val_b[i];
+    }
+    out.value = vld1q_s32(val_a);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator/(const SIMDVector<int32_t,simd_abi::neon> &a, int32_t b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    int32_t val_a[out.size()]; vst1q_s32(val_a, a.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_a[i] /= b;
+    }
+    out.value = vld1q_s32(val_a);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> operator/(int32_t a, const SIMDVector<int32_t,simd_abi::neon> &b) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    int32_t val_b[out.size()]; vst1q_s32(val_b, b.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_b[i] = a / val_b[i];
+    }
+    out.value = vld1q_s32(val_b);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int32_t,simd_abi::neon> abs(const SIMDVector<int32_t,simd_abi::neon> &a) {
+    SIMDVector<int32_t,simd_abi::neon> out;
+    out.value = vabsq_s32(a.value);
+    return out;
+}
+
+
+#endif
+
+
 } // end of namespace Fastor
 
 
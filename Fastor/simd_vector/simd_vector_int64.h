@@ -59,8 +59,8 @@ struct SIMDVector<int64_t,simd_abi::avx512> {
         _mm512_store_si512((__m512i*)data,value);
     }
 
-    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
-    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
+    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
 #ifdef FASTOR_HAS_AVX512_MASKS
@@ -438,8 +438,8 @@ struct SIMDVector<int64_t,simd_abi::avx> {
         _mm256_store_si256((__m256i*)data,value);
     }
 
-    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
-    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
+    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
 #ifdef FASTOR_HAS_AVX512_MASKS
@@ -796,8 +796,8 @@ struct SIMDVector<int64_t,simd_abi::sse> {
 #endif
     }
 
-    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
-    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
+    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
+    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {int64_t tmp[Size]; store(tmp,false); return tmp[i];}
 
     FASTOR_INLINE void set(int64_t num) {
         value = _mm_set_epi64x(num,num);
@@ -1034,6 +1034,268 @@ FASTOR_INLINE SIMDVector<int64_t,simd_abi::sse> abs(const SIMDVector<int64_t,sim
 #endif
 
 
+// NEON VERSION
+//--------------------------------------------------------------------------------------------------
+
+#ifdef FASTOR_NEON_IMPL
+
+template<>
+struct SIMDVector<int64_t,simd_abi::neon> {
+    using value_type = int64x2_t;
+    using scalar_value_type = int64_t;
+    using abi_type = simd_abi::neon;
+    static constexpr FASTOR_INDEX Size = internal::get_simd_vector_size<SIMDVector<int64_t,simd_abi::neon>>::value;
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return internal::get_simd_vector_size<SIMDVector<int64_t,simd_abi::neon>>::value;}
+
+    FASTOR_INLINE SIMDVector() : value(vdupq_n_s64(0)) {}
+    FASTOR_INLINE SIMDVector(int64_t num) : value(vdupq_n_s64(num)) {}
+    FASTOR_INLINE SIMDVector(int64x2_t regi) : value(regi) {}
+    // NEON loads/stores have no alignment requirement
+    FASTOR_INLINE SIMDVector(const int64_t *data, bool Aligned=true) : value(vld1q_s64(data)) {
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator=(int64_t num) {
+        value = vdupq_n_s64(num);
+        return *this;
+    }
+    FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator=(int64x2_t regi) {
+        value = regi;
+        return *this;
+    }
+
+    FASTOR_INLINE void load(const int64_t *data, bool Aligned=true) {
+        value = vld1q_s64(data);
+        unused(Aligned);
+    }
+    FASTOR_INLINE void store(int64_t *data, bool Aligned=true) const {
+        vst1q_s64(data,value);
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE void aligned_load(const int64_t *data) {
+        value = vld1q_s64(data);
+    }
+    FASTOR_INLINE void aligned_store(int64_t *data) const {
+        vst1q_s64(data,value);
+    }
+
+    FASTOR_INLINE void mask_load(const scalar_value_type *a, uint8_t mask, bool Aligned=false) {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        value = vdupq_n_s64(0);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                ((scalar_value_type*)&value)[Size - i - 1] = a[Size - i - 1];
+            }
+        }
+        unused(Aligned);
+    }
+    FASTOR_INLINE void mask_store(scalar_value_type *a, uint8_t mask, bool Aligned=false) const {
+        // perhaps very inefficient but they never get used
+        int maska[Size];
+        mask_to_array(mask,maska);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            if (maska[i] == -1) {
+                a[Size - i - 1] = ((const scalar_value_type*)&value)[Size - i - 1];
+            }
+            else {
+                a[Size - i - 1] = 0;
+            }
+        }
+        unused(Aligned);
+    }
+
+    FASTOR_INLINE int64_t operator[](FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
+    FASTOR_INLINE int64_t operator()(FASTOR_INDEX i) const {return reinterpret_cast<const int64_t*>(&value)[i];}
+
+    FASTOR_INLINE void set(int64_t num) {
+        value = vdupq_n_s64(num);
+    }
+    FASTOR_INLINE void set(int64_t num0, int64_t num1) {
+        const int64_t data[2] = {num1,num0};
+        value = vld1q_s64(data);
+    }
+    FASTOR_INLINE void set_sequential(int64_t num0) {
+        const int64_t data[2] = {num0,num0+1};
+        value = vld1q_s64(data);
+    }
+
+    // In-place operators
+    FASTOR_INLINE void operator+=(int64_t num) {
+        value = vaddq_s64(value,vdupq_n_s64(num));
+    }
+    FASTOR_INLINE void operator+=(int64x2_t regi) {
+        value = vaddq_s64(value,regi);
+    }
+    FASTOR_INLINE void operator+=(const SIMDVector<int64_t,simd_abi::neon> &a) {
+        value = vaddq_s64(value,a.value);
+    }
+
+    FASTOR_INLINE void operator-=(int64_t num) {
+        value = vsubq_s64(value,vdupq_n_s64(num));
+    }
+    FASTOR_INLINE void operator-=(int64x2_t regi) {
+        value = vsubq_s64(value,regi);
+    }
+    FASTOR_INLINE void operator-=(const SIMDVector<int64_t,simd_abi::neon> &a) {
+        value = vsubq_s64(value,a.value);
+    }
+
+    FASTOR_INLINE void operator*=(int64_t num) {
+        value = vmulq_s64x(value,vdupq_n_s64(num));
+    }
+    FASTOR_INLINE void operator*=(int64x2_t regi) {
+        value = vmulq_s64x(value,regi);
+    }
+    FASTOR_INLINE void operator*=(const SIMDVector<int64_t,simd_abi::neon> &a) {
+        value = vmulq_s64x(value,a.value);
+    }
+
+    // There is no NEON integer division
+    FASTOR_INLINE void operator/=(int64_t num) {
+        int64_t val[Size]; vst1q_s64(val, value);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= num;
+        }
+        value = vld1q_s64(val);
+    }
+    FASTOR_INLINE void operator/=(int64x2_t regi) {
+        int64_t val[Size]; vst1q_s64(val, value);
+        int64_t val_num[Size]; vst1q_s64(val_num, regi);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= val_num[i];
+        }
+        value = vld1q_s64(val);
+    }
+    FASTOR_INLINE void operator/=(const SIMDVector<int64_t,simd_abi::neon> &a) {
+        int64_t val[Size]; vst1q_s64(val, value);
+        int64_t val_a[Size]; vst1q_s64(val_a, a.value);
+        for (FASTOR_INDEX i=0; i<Size; ++i) {
+            val[i] /= val_a[i];
+        }
+        value = vld1q_s64(val);
+    }
+
+    FASTOR_INLINE int64_t minimum() {return std::min(vgetq_lane_s64(value,0),vgetq_lane_s64(value,1));}
+    FASTOR_INLINE int64_t maximum() {return std::max(vgetq_lane_s64(value,0),vgetq_lane_s64(value,1));}
+    FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> reverse() {
+        return vreverseq_s64(value);
+    }
+
+    FASTOR_INLINE int64_t sum() {return vaddvq_s64(value);}
+    FASTOR_INLINE int64_t product() {return vprodvq_s64(value);}
+
+    FASTOR_INLINE int64_t dot(const SIMDVector<int64_t,simd_abi::neon> &other) {
+        return vaddvq_s64(vmulq_s64x(value,other.value));
+    }
+
+    int64x2_t value;
+};
+
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<int64_t,simd_abi::neon> a) {
+    int64_t value[2];
+    vst1q_s64(value,a.value);
+    os << "[" << value[0] <<  " " << value[1] << "]\n";
+    return os;
+}
+
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator+(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vaddq_s64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator+(const SIMDVector<int64_t,simd_abi::neon> &a, int64_t b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vaddq_s64(a.value,vdupq_n_s64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator+(int64_t a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vaddq_s64(vdupq_n_s64(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator+(const SIMDVector<int64_t,simd_abi::neon> &b) {
+    return b;
+}
+
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator-(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vsubq_s64(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator-(const SIMDVector<int64_t,simd_abi::neon> &a, int64_t b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vsubq_s64(a.value,vdupq_n_s64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator-(int64_t a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vsubq_s64(vdupq_n_s64(a),b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator-(const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vnegq_s64(b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator*(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vmulq_s64x(a.value,b.value);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator*(const SIMDVector<int64_t,simd_abi::neon> &a, int64_t b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vmulq_s64x(a.value,vdupq_n_s64(b));
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator*(int64_t a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vmulq_s64x(vdupq_n_s64(a),b.value);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator/(const SIMDVector<int64_t,simd_abi::neon> &a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    int64_t val_a[out.size()]; vst1q_s64(val_a, a.value);
+    int64_t val_b[out.size()]; vst1q_s64(val_b, b.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_a[i] /= val_b[i];
+    }
+    out.value = vld1q_s64(val_a);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator/(const SIMDVector<int64_t,simd_abi::neon> &a, int64_t b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    int64_t val_a[out.size()]; vst1q_s64(val_a, a.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_a[i] /= b;
+    }
+    out.value = vld1q_s64(val_a);
+    return out;
+}
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> operator/(int64_t a, const SIMDVector<int64_t,simd_abi::neon> &b) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    int64_t val_b[out.size()]; vst1q_s64(val_b, b.value);
+    for (FASTOR_INDEX i=0; i<out.size(); ++i) {
+        val_b[i] = a / val_b[i];
+    }
+    out.value = vld1q_s64(val_b);
+    return out;
+}
+
+FASTOR_INLINE SIMDVector<int64_t,simd_abi::neon> abs(const SIMDVector<int64_t,simd_abi::neon> &a) {
+    SIMDVector<int64_t,simd_abi::neon> out;
+    out.value = vabsq_s64(a.value);
+    return out;
+}
+
+
+#endif
+
+
 } // end of namespace Fastor
 
 
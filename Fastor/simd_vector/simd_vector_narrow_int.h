@@ -0,0 +1,323 @@
+#ifndef SIMD_VECTOR_NARROW_INT_H
+#define SIMD_VECTOR_NARROW_INT_H
+
+#include "Fastor/simd_vector/simd_vector_base.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace Fastor {
+
+/* SIMDVectors of 8 and 16 bit integers [int8_t, uint8_t and int16_t]. Addition, subtraction
+   and multiplication are done in registers and wrap around like the scalar operations do,
+   division, reductions and lane access go through memory. The SSE, AVX and AVX512 versions
+   need SSE2, AVX2 and AVX512BW respectively, otherwise the generic SIMDVector is used
+*/
+//-----------------------------------------------------------------------------------------------
+
+#define FASTOR_MAKE_NARROW_INT_SIMDVECTOR(TYPE, ABI, REG, MM, BITS, EPI, MULLO)\
+template<>\
+struct SIMDVector<TYPE,simd_abi::ABI> {\
+    using value_type = REG;\
+    using scalar_value_type = TYPE;\
+    using abi_type = simd_abi::ABI;\
+    static constexpr FASTOR_INDEX Size = internal::get_simd_vector_size<SIMDVector<TYPE,simd_abi::ABI>>::value;\
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return internal::get_simd_vector_size<SIMDVector<TYPE,simd_abi::ABI>>::value;}\
+\
+    FASTOR_INLINE SIMDVector() : value(MM##_setzero_si##BITS()) {}\
+    FASTOR_INLINE SIMDVector(TYPE num) : value(MM##_set1_##EPI(num)) {}\
+    template<typename U, enable_if_t_<std::is_arithmetic<U>::value,bool> = false>\
+    FASTOR_INLINE SIMDVector(U num) : value(MM##_set1_##EPI((TYPE)num)) {}\
+    FASTOR_INLINE SIMDVector(REG regi) : value(regi) {}\
+    FASTOR_INLINE SIMDVector(const TYPE *data, bool Aligned=true) {\
+        load(data,Aligned);\
+    }\
+\
+    FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator=(TYPE num) {\
+        value = MM##_set1_##EPI(num);\
+        return *this;\
+    }\
+    FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator=(REG regi) {\
+        value = regi;\
+        return *this;\
+    }\
+\
+    FASTOR_INLINE void load(const TYPE *data, bool Aligned=true) {\
+        if (Aligned)\
+            value = MM##_load_si##BITS((const REG*)data);\
+        else\
+            value = MM##_loadu_si##BITS((const REG*)data);\
+    }\
+    FASTOR_INLINE void store(TYPE *data, bool Aligned=true) const {\
+        if (Aligned)\
+            MM##_store_si##BITS((REG*)data,value);\
+        else\
+            MM##_storeu_si##BITS((REG*)data,value);\
+    }\
+\
+    FASTOR_INLINE void aligned_load(const TYPE *data) {\
+        value = MM##_load_si##BITS((const REG*)data);\
+    }\
+    FASTOR_INLINE void aligned_store(TYPE *data) const {\
+        MM##_store_si##BITS((REG*)data,value);\
+    }\
+\
+    FASTOR_INLINE TYPE operator[](FASTOR_INDEX i) const {TYPE tmp[Size]; store(tmp,false); return tmp[i];}\
+    FASTOR_INLINE TYPE operator()(FASTOR_INDEX i) const {TYPE tmp[Size]; store(tmp,false); return tmp[i];}\
+\
+    FASTOR_INLINE void set(TYPE num) {\
+        value = MM##_set1_##EPI(num);\
+    }\
+    /* Like the _mm_set intrinsics the first value goes in to the last lane */\
+    template<typename ... Args>\
+    FASTOR_INLINE void set(TYPE first, Args ... args) {\
+        static_assert(sizeof...(args)+1==Size,"CANNOT SET VECTOR WITH SPECIFIED NUMBER OF VALUES DUE TO ABI CONSIDERATION");\
+        TYPE vals[Size] = {first, static_cast<TYPE>(args)...};\
+        std::reverse(vals,vals+Size);\
+        load(vals,false);\
+    }\
+    FASTOR_INLINE void set_sequential(TYPE num0) {\
+        TYPE vals[Size];\
+        for (FASTOR_INDEX i=0; i<Size; ++i) {\
+            vals[i] = static_cast<TYPE>(num0+i);\
+        }\
+        load(vals,false);\
+    }\
+\
+    /* In-place operators */\
+    FASTOR_INLINE void operator+=(TYPE num) {\
+        value = MM##_add_##EPI(value,MM##_set1_##EPI(num));\
+    }\
+    FASTOR_INLINE void operator+=(REG regi) {\
+        value = MM##_add_##EPI(value,regi);\
+    }\
+    FASTOR_INLINE void operator+=(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+        value = MM##_add_##EPI(value,a.value);\
+    }\
+\
+    FASTOR_INLINE void operator-=(TYPE num) {\
+        value = MM##_sub_##EPI(value,MM##_set1_##EPI(num));\
+    }\
+    FASTOR_INLINE void operator-=(REG regi) {\
+        value = MM##_sub_##EPI(value,regi);\
+    }\
+    FASTOR_INLINE void operator-=(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+        value = MM##_sub_##EPI(value,a.value);\
+    }\
+\
+    FASTOR_INLINE void operator*=(TYPE num) {\
+        value = MM##_##MULLO(value,MM##_set1_##EPI(num));\
+    }\
+    FASTOR_INLINE void operator*=(REG regi) {\
+        value = MM##_##MULLO(value,regi);\
+    }\
+    FASTOR_INLINE void operator*=(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+        value = MM##_##MULLO(value,a.value);\
+    }\
+\
+    FASTOR_INLINE void operator/=(TYPE num) {\
+        TYPE val[Size]; store(val,false);\
+        for (FASTOR_INDEX i=0; i<Size; ++i) {\
+            val[i] = static_cast<TYPE>(val[i] / num);\
+        }\
+        load(val,false);\
+    }\
+    FASTOR_INLINE void operator/=(REG regi) {\
+        *this /= SIMDVector<TYPE,simd_abi::ABI>(regi);\
+    }\
+    FASTOR_INLINE void operator/=(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+        TYPE val[Size];   store(val,false);\
+        TYPE val_a[Size]; a.store(val_a,false);\
+        for (FASTOR_INDEX i=0; i<Size; ++i) {\
+            val[i] = static_cast<TYPE>(val[i] / val_a[i]);\
+        }\
+        load(val,false);\
+    }\
+    /* end of in-place operators */\
+\
+    FASTOR_INLINE TYPE minimum() {\
+        TYPE vals[Size]; store(vals,false);\
+        return *std::min_element(vals,vals+Size);\
+    }\
+    FASTOR_INLINE TYPE maximum() {\
+        TYPE vals[Size]; store(vals,false);\
+        return *std::max_element(vals,vals+Size);\
+    }\
+    FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> reverse() {\
+        TYPE vals[Size]; store(vals,false);\
+        std::reverse(vals,vals+Size);\
+        return SIMDVector<TYPE,simd_abi::ABI>(vals,false);\
+    }\
+\
+    FASTOR_INLINE TYPE sum() {\
+        TYPE vals[Size]; store(vals,false);\
+        TYPE quan = 0;\
+        for (FASTOR_INDEX i=0; i<Size; ++i)\
+            quan += vals[i];\
+        return quan;\
+    }\
+    FASTOR_INLINE TYPE product() {\
+        TYPE vals[Size]; store(vals,false);\
+        TYPE quan = 1;\
+        for (FASTOR_INDEX i=0; i<Size; ++i)\
+            quan *= vals[i];\
+        return quan;\
+    }\
+\
+    FASTOR_INLINE TYPE dot(const SIMDVector<TYPE,simd_abi::ABI> &other) {\
+        return SIMDVector<TYPE,simd_abi::ABI>(MM##_##MULLO(value,other.value)).sum();\
+    }\
+\
+    REG value;\
+};\
+\
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, SIMDVector<TYPE,simd_abi::ABI> a) {\
+    TYPE vals[a.Size]; a.store(vals,false);\
+    os << "[";\
+    for (FASTOR_INDEX i=0; i<a.Size; ++i)\
+        os << +vals[i] << ' ';\
+    os << "]\n";\
+    return os;\
+}\
+\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator+(const SIMDVector<TYPE,simd_abi::ABI> &a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_add_##EPI(a.value,b.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator+(const SIMDVector<TYPE,simd_abi::ABI> &a, TYPE b) {\
+    return MM##_add_##EPI(a.value,MM##_set1_##EPI(b));\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator+(TYPE a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_add_##EPI(MM##_set1_##EPI(a),b.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator+(const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return b;\
+}\
+\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator-(const SIMDVector<TYPE,simd_abi::ABI> &a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_sub_##EPI(a.value,b.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator-(const SIMDVector<TYPE,simd_abi::ABI> &a, TYPE b) {\
+    return MM##_sub_##EPI(a.value,MM##_set1_##EPI(b));\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator-(TYPE a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_sub_##EPI(MM##_set1_##EPI(a),b.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator-(const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_sub_##EPI(MM##_setzero_si##BITS(),b.value);\
+}\
+\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator*(const SIMDVector<TYPE,simd_abi::ABI> &a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_##MULLO(a.value,b.value);\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator*(const SIMDVector<TYPE,simd_abi::ABI> &a, TYPE b) {\
+    return MM##_##MULLO(a.value,MM##_set1_##EPI(b));\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator*(TYPE a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    return MM##_##MULLO(MM##_set1_##EPI(a),b.value);\
+}\
+\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator/(const SIMDVector<TYPE,simd_abi::ABI> &a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    SIMDVector<TYPE,simd_abi::ABI> out(a);\
+    out /= b;\
+    return out;\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator/(const SIMDVector<TYPE,simd_abi::ABI> &a, TYPE b) {\
+    SIMDVector<TYPE,simd_abi::ABI> out(a);\
+    out /= b;\
+    return out;\
+}\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> operator/(TYPE a, const SIMDVector<TYPE,simd_abi::ABI> &b) {\
+    SIMDVector<TYPE,simd_abi::ABI> out(a);\
+    out /= b;\
+    return out;\
+}\
+
+// Absolute value of signed integers, unsigned integers are returned as they are
+#define FASTOR_MAKE_NARROW_INT_ABS(TYPE, ABI, MM, EPI)\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> abs(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+    return MM##_abs_##EPI(a.value);\
+}\
+
+#define FASTOR_MAKE_NARROW_UINT_ABS(TYPE, ABI)\
+FASTOR_INLINE SIMDVector<TYPE,simd_abi::ABI> abs(const SIMDVector<TYPE,simd_abi::ABI> &a) {\
+    return a;\
+}\
+
+
+
+// AVX512 VERSION
+//-----------------------------------------------------------------------------------------------
+#ifdef FASTOR_AVX512BW_IMPL
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int8_t , avx512, __m512i, _mm512, 512, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(uint8_t, avx512, __m512i, _mm512, 512, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int16_t, avx512, __m512i, _mm512, 512, epi16, mullo_epi16)
+FASTOR_MAKE_NARROW_INT_ABS(int8_t , avx512, _mm512, epi8 )
+FASTOR_MAKE_NARROW_INT_ABS(int16_t, avx512, _mm512, epi16)
+FASTOR_MAKE_NARROW_UINT_ABS(uint8_t, avx512)
+#endif
+
+
+// AVX VERSION
+//-----------------------------------------------------------------------------------------------
+#ifdef FASTOR_AVX2_IMPL
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int8_t , avx, __m256i, _mm256, 256, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(uint8_t, avx, __m256i, _mm256, 256, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int16_t, avx, __m256i, _mm256, 256, epi16, mullo_epi16)
+FASTOR_MAKE_NARROW_INT_ABS(int8_t , avx, _mm256, epi8 )
+FASTOR_MAKE_NARROW_INT_ABS(int16_t, avx, _mm256, epi16)
+FASTOR_MAKE_NARROW_UINT_ABS(uint8_t, avx)
+#endif
+
+
+// SSE VERSION
+//-----------------------------------------------------------------------------------------------
+#ifdef FASTOR_SSE2_IMPL
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int8_t , sse, __m128i, _mm, 128, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(uint8_t, sse, __m128i, _mm, 128, epi8 , mullo_epi8x)
+FASTOR_MAKE_NARROW_INT_SIMDVECTOR(int16_t, sse, __m128i, _mm, 128, epi16, mullo_epi16)
+#ifdef FASTOR_SSSE3_IMPL
+FASTOR_MAKE_NARROW_INT_ABS(int8_t , sse, _mm, epi8 )
+FASTOR_MAKE_NARROW_INT_ABS(int16_t, sse, _mm, epi16)
+#else // SSE2
+FASTOR_INLINE SIMDVector<int8_t,simd_abi::sse> abs(const SIMDVector<int8_t,simd_abi::sse> &a) {
+    // signed bytes have no max on SSE2 but their unsigned min is the absolute value
+    return _mm_min_epu8(a.value,_mm_sub_epi8(_mm_setzero_si128(),a.value));
+}
+FASTOR_INLINE SIMDVector<int16_t,simd_abi::sse> abs(const SIMDVector<int16_t,simd_abi::sse> &a) {
+    return _mm_max_epi16(a.value,_mm_sub_epi16(_mm_setzero_si128(),a.value));
+}
+#endif
+FASTOR_MAKE_NARROW_UINT_ABS(uint8_t, sse)
+#endif
+
+
+namespace internal {
+// Whether 8 and 16 bit integer SIMDVectors exist for an ABI, the generic
+// SIMDVector is not any faster than the scalar one for these types
+template<typename ABI>
+struct has_narrow_int_simd {
+    static constexpr bool value = false;
+};
+#ifdef FASTOR_AVX512BW_IMPL
+template<>
+struct has_narrow_int_simd<simd_abi::avx512> {
+    static constexpr bool value = true;
+};
+#endif
+#ifdef FASTOR_AVX2_IMPL
+template<>
+struct has_narrow_int_simd<simd_abi::avx> {
+    static constexpr bool value = true;
+};
+#endif
+#ifdef FASTOR_SSE2_IMPL
+template<>
+struct has_narrow_int_simd<simd_abi::sse> {
+    static constexpr bool value = true;
+};
+#endif
+} // internal
+
+} // end of namespace Fastor
+
+
+#endif // SIMD_VECTOR_NARROW_INT_H
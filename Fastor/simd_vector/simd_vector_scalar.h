@@ -192,22 +192,22 @@ FASTOR_INLINE SIMDVector<T,simd_abi::scalar> operator/(T a, const SIMDVector<T,s
 
 template <typename T>
 FASTOR_INLINE SIMDVector<T,simd_abi::scalar> rcp(const SIMDVector<T,simd_abi::scalar> &a) {
-    return T(1) / a.value;
+    return T(T(1) / a.value);
 }
 
 template <typename T>
 FASTOR_INLINE SIMDVector<T,simd_abi::scalar> sqrt(const SIMDVector<T,simd_abi::scalar> &a) {
-    return std::sqrt(a.value);
+    return T(std::sqrt(a.value));
 }
 
 template <typename T>
 FASTOR_INLINE SIMDVector<T,simd_abi::scalar> rsqrt(const SIMDVector<T,simd_abi::scalar> &a) {
-    return T(1) / std::sqrt(a.value);
+    return T(T(1) / std::sqrt(a.value));
 }
 
 template <typename T>
 FASTOR_INLINE SIMDVector<T,simd_abi::scalar> abs(const SIMDVector<T,simd_abi::scalar> &a) {
-    return std::abs(a.value);
+    return T(std::abs(a.value));
 }
 
 } // end of namespace Fastor
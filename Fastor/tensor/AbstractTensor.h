@@ -11,6 +11,8 @@ template<typename T, size_t ... Rest>
 class Tensor;
 template<typename T, size_t ... Rest>
 class TensorMap;
+template<typename T, int DIM>
+class DynamicTensor;
 
 
 template<class Derived, FASTOR_INDEX Rank>
@@ -52,7 +52,7 @@ FASTOR_INLINE typename Derived::scalar_type sum(const AbstractTensor<Derived,DIM
     const Derived &src = _src.self();
     using result_type = typename Derived::result_type;
     const result_type out(src);
-    return out.sum();
+    return sum(out);
 }
 template<class Derived, size_t DIMS, enable_if_t_<!requires_evaluation_v<Derived>,bool> = false>
 FASTOR_INLINE typename Derived::scalar_type sum(const AbstractTensor<Derived,DIMS> &_src) {
@@ -60,15 +60,23 @@ FASTOR_INLINE typename Derived::scalar_type sum(const AbstractTensor<Derived,DIM
     const Derived &src = _src.self();
     using T = typename Derived::scalar_type;
     using V = typename Derived::simd_vector_type;
-    FASTOR_INDEX i;
-    T _scal=0; V _vec(_scal);
-    for (i = 0; i < ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-        _vec += src.template eval<T>(i);
-    }
-    for (; i < src.size(); ++i) {
-        _scal += src.template eval_s<T>(i);
-    }
-    return _vec.sum() + _scal;
+    return internal::parallel_reduce<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i;
+        T _scal=0; V _vec(_scal);
+        for (i = first; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            _vec += src.template eval<T>(i);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,Derived>::value) {
+            if (i < last) {
+                _vec += tail_blend(src.template eval<T>(i), last-i, _scal);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _scal += src.template eval_s<T>(i);
+        }
+        return _vec.sum() + _scal;
+    }, [](T a, T b) {return a + b;});
 }
 
 /* Multiply all the elements of the tensor in a flattened sense
@@ -78,7 +86,7 @@ FASTOR_INLINE typename Derived::scalar_type product(const AbstractTensor<Derived
     const Derived &src = _src.self();
     using result_type = typename Derived::result_type;
     const result_type out(src);
-    return out.product();
+    return product(out);
 }
 template<class Derived, size_t DIMS, enable_if_t_<!requires_evaluation_v<Derived>,bool> = false>
 FASTOR_INLINE typename Derived::scalar_type product(const AbstractTensor<Derived,DIMS> &_src) {
@@ -86,15 +94,23 @@ FASTOR_INLINE typename Derived::scalar_type product(const AbstractTensor<Derived
     const Derived &src = _src.self();
     using T = typename Derived::scalar_type;
     using V = typename Derived::simd_vector_type;
-    FASTOR_INDEX i;
-    T _scal=1; V _vec(_scal);
-    for (i = 0; i < ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-        _vec *= src.template eval<T>(i);
-    }
-    for (; i < src.size(); ++i) {
-        _scal *= src.template eval_s<T>(i);
-    }
-    return _vec.product() * _scal;
+    return internal::parallel_reduce<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i;
+        T _scal=1; V _vec(_scal);
+        for (i = first; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            _vec *= src.template eval<T>(i);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,Derived>::value) {
+            if (i < last) {
+                _vec *= tail_blend(src.template eval<T>(i), last-i, _scal);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _scal *= src.template eval_s<T>(i);
+        }
+        return _vec.product() * _scal;
+    }, [](T a, T b) {return a * b;});
 }
 
 /* Get minimum element of a tensor
@@ -112,15 +128,23 @@ FASTOR_INLINE typename Derived::scalar_type min(const AbstractTensor<Derived,DIM
     const Derived &src = _src.self();
     using T = typename Derived::scalar_type;
     using V = typename Derived::simd_vector_type;
-    FASTOR_INDEX i;
-    T _scal=std::numeric_limits<T>::max(); V _vec(_scal);
-    for (i = 0; i < ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-        _vec = min(src.template eval<T>(i),_vec);
-    }
-    for (; i < src.size(); ++i) {
-        _scal = std::min(src.template eval_s<T>(i),_scal);
-    }
-    return std::min(_vec.minimum(), _scal);
+    return internal::parallel_reduce<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i;
+        T _scal=std::numeric_limits<T>::max(); V _vec(_scal);
+        for (i = first; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            _vec = min(src.template eval<T>(i),_vec);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,Derived>::value) {
+            if (i < last) {
+                _vec = min(tail_blend(src.template eval<T>(i), last-i, _scal),_vec);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _scal = std::min(src.template eval_s<T>(i),_scal);
+        }
+        return std::min(_vec.minimum(), _scal);
+    }, [](T a, T b) {return std::min(a,b);});
 }
 
 /* Get maximum element of a tensor
@@ -138,15 +162,23 @@ FASTOR_INLINE typename Derived::scalar_type max(const AbstractTensor<Derived,DIM
     const Derived &src = _src.self();
     using T = typename Derived::scalar_type;
     using V = typename Derived::simd_vector_type;
-    FASTOR_INDEX i;
-    T _scal=std::numeric_limits<T>::min(); V _vec(_scal);
-    for (i = 0; i < ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-        _vec = max(src.template eval<T>(i),_vec);
-    }
-    for (; i < src.size(); ++i) {
-        _scal = std::max(src.template eval_s<T>(i),_scal);
-    }
-    return std::max(_vec.maximum(), _scal);
+    return internal::parallel_reduce<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i;
+        T _scal=std::numeric_limits<T>::min(); V _vec(_scal);
+        for (i = first; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            _vec = max(src.template eval<T>(i),_vec);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,Derived>::value) {
+            if (i < last) {
+                _vec = max(tail_blend(src.template eval<T>(i), last-i, _scal),_vec);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _scal = std::max(src.template eval_s<T>(i),_scal);
+        }
+        return std::max(_vec.maximum(), _scal);
+    }, [](T a, T b) {return std::max(a,b);});
 }
 
 /* Get the lower triangular matrix from a 2D expression
@@ -0,0 +1,447 @@
+#ifndef DYNAMIC_TENSOR_H
+#define DYNAMIC_TENSOR_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/backend/backend.h"
+#include "Fastor/backend/aligned_alloc.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Ranges.h"
+#include "Fastor/tensor/ForwardDeclare.h"
+#include "Fastor/expressions/linalg_ops/linalg_ops.h"
+#include "Fastor/tensor/TensorIO.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+
+namespace Fastor {
+
+/* A tensor whose extents are only known at runtime. DynamicTensor plugs in to the
+   same AbstractTensor/expression template machinery as Tensor, so it can be mixed
+   freely with fixed size tensors in expressions. The storage is heap allocated,
+   contiguous, row-major and aligned, and the SIMD remainders are driven by the
+   runtime size.
+
+   Note that the rank is deliberately an int and not size_t, so that DynamicTensor
+   is not matched by the template<typename,size_t...> patterns used throughout the
+   library to pattern match on fixed size tensors
+*/
+template<typename T, int DIM>
+class DynamicTensor: public AbstractTensor<DynamicTensor<T,DIM>,DIM> {
+public:
+    using scalar_type      = T;
+    using simd_vector_type = choose_best_simd_vector_t<T>;
+    using simd_abi_type    = typename simd_vector_type::abi_type;
+    using result_type      = DynamicTensor<T,DIM>;
+    using dimension_t      = std::integral_constant<FASTOR_INDEX, DIM>;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return DIM;}
+    FASTOR_INLINE FASTOR_INDEX size() const {return _size;}
+    FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX dim) const {
+#if FASTOR_SHAPE_CHECK
+        FASTOR_ASSERT(dim>=0 && dim < DIM, "TENSOR SHAPE MISMATCH");
+#endif
+        return _dims[dim];
+    }
+    FASTOR_INLINE const std::array<FASTOR_INDEX,DIM>& dimensions() const {return _dims;}
+    FASTOR_INLINE DynamicTensor<T,DIM>& noalias() {return *this;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE DynamicTensor() {
+        static_assert(DIM>0, "DYNAMIC TENSOR MUST HAVE A RANK OF AT LEAST ONE");
+        _dims.fill(0);
+    }
+
+    template<typename... Args, enable_if_t_<sizeof...(Args)==DIM && is_arithmetic_pack_v<Args...>,bool> = false>
+    FASTOR_INLINE explicit DynamicTensor(Args ... args) : DynamicTensor() {
+        resize(std::array<FASTOR_INDEX,DIM>{static_cast<FASTOR_INDEX>(args)...});
+    }
+
+    FASTOR_INLINE explicit DynamicTensor(const std::array<FASTOR_INDEX,DIM> &dims) : DynamicTensor() {
+        resize(dims);
+    }
+
+    FASTOR_INLINE DynamicTensor(const std::array<FASTOR_INDEX,DIM> &dims, T num) : DynamicTensor() {
+        resize(dims);
+        fill(num);
+    }
+
+    FASTOR_INLINE DynamicTensor(const DynamicTensor<T,DIM> &other) : DynamicTensor() {
+        resize(other._dims);
+        std::copy(other._data,other._data+_size,_data);
+    }
+
+    FASTOR_INLINE DynamicTensor(DynamicTensor<T,DIM> &&other) noexcept : _data(other._data), _size(other._size), _dims(other._dims) {
+        other._data = nullptr;
+        other._size = 0;
+        other._dims.fill(0);
+    }
+
+    template<typename Derived, size_t DIMS>
+    FASTOR_INLINE DynamicTensor(const AbstractTensor<Derived,DIMS>& src_) : DynamicTensor() {
+        static_assert(DIMS==DIM, "TENSOR RANK MISMATCH");
+        const Derived &src = src_.self();
+        std::array<FASTOR_INDEX,DIM> dims;
+        for (FASTOR_INDEX i=0; i<DIM; ++i) dims[i] = src.dimension(i);
+        resize(dims);
+        assign(*this, src);
+    }
+
+    FASTOR_INLINE ~DynamicTensor() {
+        deallocate();
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Assignment operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE DynamicTensor<T,DIM>& operator=(const DynamicTensor<T,DIM> &other) {
+        if (this==&other) return *this;
+        resize(other._dims);
+        trivial_assign(*this, other);
+        return *this;
+    }
+
+    FASTOR_INLINE DynamicTensor<T,DIM>& operator=(DynamicTensor<T,DIM> &&other) noexcept {
+        if (this==&other) return *this;
+        deallocate();
+        _data = other._data;
+        _size = other._size;
+        _dims = other._dims;
+        other._data = nullptr;
+        other._size = 0;
+        other._dims.fill(0);
+        return *this;
+    }
+
+    /* Evaluating an expression resizes the tensor to the shape of the expression */
+    template<typename Derived, size_t DIMS>
+    FASTOR_INLINE DynamicTensor<T,DIM>& operator=(const AbstractTensor<Derived,DIMS>& src_) {
+        static_assert(DIMS==DIM, "TENSOR RANK MISMATCH");
+        const Derived &src = src_.self();
+        std::array<FASTOR_INDEX,DIM> dims;
+        for (FASTOR_INDEX i=0; i<DIM; ++i) dims[i] = src.dimension(i);
+        resize(dims);
+        assign(*this, src);
+        return *this;
+    }
+
+    template<typename U, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE DynamicTensor<T,DIM>& operator=(U num) {
+        trivial_assign(*this, num);
+        return *this;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // AbstractTensor and scalar in-place operators
+    //----------------------------------------------------------------------------------------------------------//
+#undef TENSOR_INPLACE_OPERATORS_H
+    #include "Fastor/tensor/TensorInplaceOperators.h"
+#define TENSOR_INPLACE_OPERATORS_H
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Reshaping - the content is preserved only if the total size does not change
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void resize(const std::array<FASTOR_INDEX,DIM> &dims) {
+        FASTOR_INDEX new_size = 1;
+        for (FASTOR_INDEX i=0; i<DIM; ++i) new_size *= dims[i];
+        if (new_size != _size) {
+            deallocate();
+            _data = internal::aligned_allocate<T>(new_size);
+            _size = new_size;
+            construct();
+        }
+        _dims = dims;
+    }
+    template<typename... Args, enable_if_t_<sizeof...(Args)==DIM && is_arithmetic_pack_v<Args...>,bool> = false>
+    FASTOR_INLINE void resize(Args ... args) {
+        resize(std::array<FASTOR_INDEX,DIM>{static_cast<FASTOR_INDEX>(args)...});
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename... Args, enable_if_t_<sizeof...(Args)==DIM && is_arithmetic_pack_v<Args...>,bool> = false>
+    FASTOR_INLINE T& operator()(Args ... args) {
+        return _data[get_flat_index(args...)];
+    }
+    template<typename... Args, enable_if_t_<sizeof...(Args)==DIM && is_arithmetic_pack_v<Args...>,bool> = false>
+    FASTOR_INLINE const T& operator()(Args ... args) const {
+        return _data[get_flat_index(args...)];
+    }
+    FASTOR_INLINE T& operator[](FASTOR_INDEX i) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT( ( (i>=0 && i<_size)), "INDEX OUT OF BOUNDS");
+#endif
+        return _data[i];
+    }
+    FASTOR_INLINE const T& operator[](FASTOR_INDEX i) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT( ( (i>=0 && i<_size)), "INDEX OUT OF BOUNDS");
+#endif
+        return _data[i];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Block indexing
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename ... Seq, enable_if_t_<!is_arithmetic_pack_v<Seq...>,bool> = false>
+    FASTOR_INLINE TensorViewExpr<DynamicTensor<T,DIM>,sizeof...(Seq)> operator()(Seq ... _seqs) {
+        static_assert(DIM==sizeof...(Seq),"INDEXING TENSOR WITH INCORRECT NUMBER OF ARGUMENTS");
+        return TensorViewExpr<DynamicTensor<T,DIM>,sizeof...(Seq)>(*this, {seq(_seqs)...});
+    }
+    template<typename ... Seq, enable_if_t_<!is_arithmetic_pack_v<Seq...>,bool> = false>
+    FASTOR_INLINE TensorConstViewExpr<DynamicTensor<T,DIM>,sizeof...(Seq)> operator()(Seq ... _seqs) const {
+        static_assert(DIM==sizeof...(Seq),"INDEXING TENSOR WITH INCORRECT NUMBER OF ARGUMENTS");
+        return TensorConstViewExpr<DynamicTensor<T,DIM>,sizeof...(Seq)>(*this, {seq(_seqs)...});
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Expression templates evaluators
+    //----------------------------------------------------------------------------------------------------------//
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i) const {
+        SIMDVector<U,simd_abi_type> _vec;
+        _vec.load(&_data[i],false);
+        return _vec;
+    }
+    template<typename U=T>
+    FASTOR_INLINE T eval_s(FASTOR_INDEX i) const {
+        return _data[i];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        SIMDVector<U,simd_abi_type> _vec;
+        _vec.load(&_data[i*_dims[DIM-1]+j],false);
+        return _vec;
+    }
+    template<typename U=T>
+    FASTOR_INLINE T eval_s(FASTOR_INDEX i, FASTOR_INDEX j) const {
+        return _data[i*_dims[DIM-1]+j];
+    }
+    template<typename U=T>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int, DIM> &as) const {
+        SIMDVector<U,simd_abi_type> _vec;
+        _vec.load(&_data[get_flat_index(as)],false);
+        return _vec;
+    }
+    template<typename U=T>
+    FASTOR_INLINE T teval_s(const std::array<int, DIM> &as) const {
+        return _data[get_flat_index(as)];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num0) {
+        using V = simd_vector_type;
+        const V _vec(num0);
+        FASTOR_INDEX i = 0;
+        for (; i<ROUND_DOWN(_size,V::Size); i+=V::Size) {
+            _vec.store(&_data[i],FASTOR_ALIGNED);
+        }
+        for (; i<_size; ++i) _data[i] = num0;
+    }
+
+    FASTOR_INLINE void iota(T num0=0) {
+        iota_impl(_data, _data+_size, num0);
+    }
+
+    FASTOR_INLINE void arange(T num0=0) {
+        iota_impl(_data, _data+_size, num0);
+    }
+
+    FASTOR_INLINE void zeros() {
+        this->fill(static_cast<T>(0));
+    }
+
+    FASTOR_INLINE void ones() {
+        this->fill(static_cast<T>(1));
+    }
+
+    FASTOR_INLINE T sum() const {
+        using V = simd_vector_type;
+        V _vec(static_cast<T>(0));
+        FASTOR_INDEX i = 0;
+        for (; i<ROUND_DOWN(_size,V::Size); i+=V::Size) {
+            _vec += V(&_data[i],FASTOR_ALIGNED);
+        }
+        T scalar = static_cast<T>(0);
+        for (; i<_size; ++i) {
+            scalar += _data[i];
+        }
+        return _vec.sum() + scalar;
+    }
+
+    FASTOR_INLINE T product() const {
+        using V = simd_vector_type;
+        V _vec(static_cast<T>(1));
+        FASTOR_INDEX i = 0;
+        for (; i<ROUND_DOWN(_size,V::Size); i+=V::Size) {
+            _vec *= V(&_data[i],FASTOR_ALIGNED);
+        }
+        T scalar = static_cast<T>(1);
+        for (; i<_size; ++i) {
+            scalar *= _data[i];
+        }
+        return _vec.product() * scalar;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Converters
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE std::vector<T> toSTL() const {
+        return std::vector<T>(_data,_data+_size);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+    template<typename... Args>
+    FASTOR_INLINE FASTOR_INDEX get_flat_index(Args ... args) const {
+        const int largs[DIM] = {static_cast<int>(args)...};
+        FASTOR_INDEX index = 0;
+        for (FASTOR_INDEX n=0; n<DIM; ++n) {
+            const FASTOR_INDEX i = largs[n] < 0 ? _dims[n] + largs[n] : largs[n];
+#if FASTOR_BOUNDS_CHECK
+            FASTOR_ASSERT( ( (i>=0 && i<_dims[n])), "INDEX OUT OF BOUNDS");
+#endif
+            index = index*_dims[n] + i;
+        }
+        return index;
+    }
+    FASTOR_INLINE FASTOR_INDEX get_flat_index(const std::array<int,DIM> &as) const {
+        FASTOR_INDEX index = 0;
+        for (FASTOR_INDEX n=0; n<DIM; ++n) {
+            index = index*_dims[n] + as[n];
+        }
+        return index;
+    }
+
+    FASTOR_INLINE void construct() {
+        FASTOR_IF_CONSTEXPR(!std::is_trivially_default_constructible<T>::value) {
+            std::uninitialized_fill(_data,_data+_size,T());
+        }
+    }
+    FASTOR_INLINE void deallocate() {
+        FASTOR_IF_CONSTEXPR(!std::is_trivially_destructible<T>::value) {
+            for (FASTOR_INDEX i=0; i<_size; ++i) _data[i].~T();
+        }
+        internal::aligned_free(_data);
+        _data = nullptr;
+        _size = 0;
+    }
+
+    T* _data = nullptr;
+    FASTOR_INDEX _size = 0;
+    std::array<FASTOR_INDEX,DIM> _dims;
+};
+
+
+
+template<typename Derived, size_t DIM, typename T, int OtherDIM>
+FASTOR_INLINE void assign(AbstractTensor<Derived,DIM> &dst, const DynamicTensor<T,OtherDIM> &src) {
+    if (dst.self().data()==src.data()) return;
+    trivial_assign(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, int OtherDIM>
+FASTOR_INLINE void assign_add(AbstractTensor<Derived,DIM> &dst, const DynamicTensor<T,OtherDIM> &src) {
+    trivial_assign_add(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, int OtherDIM>
+FASTOR_INLINE void assign_sub(AbstractTensor<Derived,DIM> &dst, const DynamicTensor<T,OtherDIM> &src) {
+    trivial_assign_sub(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, int OtherDIM>
+FASTOR_INLINE void assign_mul(AbstractTensor<Derived,DIM> &dst, const DynamicTensor<T,OtherDIM> &src) {
+    trivial_assign_mul(dst.self(),src);
+}
+template<typename Derived, size_t DIM, typename T, int OtherDIM>
+FASTOR_INLINE void assign_div(AbstractTensor<Derived,DIM> &dst, const DynamicTensor<T,OtherDIM> &src) {
+    trivial_assign_div(dst.self(),src);
+}
+
+
+template<typename T, int DIM>
+FASTOR_INLINE const DynamicTensor<T,DIM>& evaluate(const DynamicTensor<T,DIM> &src) {
+    return src;
+}
+
+
+// IO
+//----------------------------------------------------------------------------------------------------------//
+template<typename T>
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, const DynamicTensor<T,1> &a) {
+    IOFormat fmt = FASTOR_DEFINE_IO_FORMAT;
+    os.precision(fmt._precision);
+    int width = internal::get_row_width(os, a.data(), a.size());
+    for(FASTOR_INDEX i = 0; i < a.dimension(0); ++i)
+    {
+        os << fmt._rowprefix;
+        if(width) os.width(width);
+        os << a(i);
+        os << fmt._rowsuffix;
+        os << fmt._rowsep;
+    }
+    return os;
+}
+
+template<typename T, int DIM, enable_if_t_<DIM>=2,bool> = false>
+FASTOR_HINT_INLINE std::ostream& operator<<(std::ostream &os, const DynamicTensor<T,DIM> &a) {
+    IOFormat fmt = FASTOR_DEFINE_IO_FORMAT;
+    os.precision(fmt._precision);
+    int width = internal::get_row_width(os, a.data(), a.size());
+    const FASTOR_INDEX M = a.dimension(DIM-2);
+    const FASTOR_INDEX N = a.dimension(DIM-1);
+    const FASTOR_INDEX nmats = M*N == 0 ? 0 : a.size()/(M*N);
+    for (FASTOR_INDEX mat=0; mat<nmats; ++mat) {
+        if (DIM > 2) {
+            if (fmt._print_dimensions) {
+                os << "[";
+                FASTOR_INDEX remaining = mat;
+                std::array<FASTOR_INDEX,DIM> as = {};
+                for (int n=DIM-3; n>=0; --n) {
+                    as[n] = remaining % a.dimension(n);
+                    remaining /= a.dimension(n);
+                }
+                for (int n=0; n<DIM-2; ++n) os << as[n] << ",";
+                os << ":,:]\n";
+            }
+            else if (mat) {
+                os << "\n";
+            }
+        }
+        for(FASTOR_INDEX i = 0; i < M; ++i)
+        {
+            os << fmt._rowprefix;
+            if(width) os.width(width);
+            os << a.data()[mat*M*N+i*N];
+            for(FASTOR_INDEX j = 1; j < N; ++j)
+            {
+                os << fmt._colsep;
+                if(width) os.width(width);
+                os << a.data()[mat*M*N+i*N+j];
+            }
+            os << fmt._rowsuffix;
+            if (DIM > 2) os << fmt._rowsep;
+            else if( i < M - 1) os << fmt._rowsep;
+        }
+    }
+    return os;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#include "Fastor/expressions/views/tensor_dynamic_views.h"
+
+
+#endif // DYNAMIC_TENSOR_H
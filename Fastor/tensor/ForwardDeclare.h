@@ -146,6 +146,12 @@ FASTOR_MAKE_BINARY_CMP_OP_FORWARD_DECLARATION(OR)
 
 template<typename Derived>
 struct is_binary_cmp_op;
+
+template<typename Derived>
+struct has_common_subexpression;
+
+template<typename Derived>
+struct is_binary_matmul_chain;
 //----------------------------------------------------------------
 
 }
@@ -148,10 +148,7 @@ public:
     template<typename U>
     FASTOR_INLINE Tensor<U,Rest...> cast() const {
         Tensor<U,Rest...> out;
-        U *out_data = out.data();
-        for (FASTOR_INDEX i=0; i<size(); ++i) {
-            out_data[get_mem_index(i)] = static_cast<U>(_data[i]);
-        }
+        internal::convert_data(_data,out.data(),size());
         return out;
     }
     //----------------------------------------------------------------------------------------------------------//
@@ -3,6 +3,37 @@
 
 namespace Fastor {
 
+namespace internal {
+/* Whether writing size entries starting at data should bypass the caches using non-temporal
+   stores. Only outputs larger than FASTOR_STREAMING_STORE_THRESHOLD bytes that start on a
+   vector boundary are streamed as streaming stores have no unaligned variant
+*/
+template<typename T, typename V>
+FASTOR_INLINE bool should_stream(const T* data, FASTOR_INDEX size) {
+#if defined(FASTOR_NO_STREAMING_STORES) || defined(FASTOR_DONT_VECTORISE)
+    unused(data,size);
+    return false;
+#else
+    return V::Size > 1 && size*sizeof(T) > FASTOR_STREAMING_STORE_THRESHOLD &&
+        FASTOR_ISALIGNED(data, V::Size*sizeof(T));
+#endif
+}
+
+/* Whether the remainder of a loop over expr, and over dst for in-place operations, can be done
+   with one masked vector. The vector reads past the last entry of the operands so this is
+   restricted to operands whose storage is aligned on the vector width where such a read never
+   leaves the allocation's last vector sized block. Turned off under address sanitizer
+*/
+template<typename V, typename Expr, typename Dst = Expr>
+struct use_masked_tail {
+#if defined(FASTOR_NO_MASKED_TAILS) || defined(FASTOR_DONT_ALIGN) || defined(FASTOR_DONT_VECTORISE) || defined(__SANITIZE_ADDRESS__)
+    static constexpr bool value = false;
+#else
+    static constexpr bool value = has_masked_tail<V>::value && is_tail_maskable<Expr>::value && is_tail_maskable<Dst>::value;
+#endif
+};
+} // end of namespace internal
+
 //----------------------------------------------------------------------------------------------------------//
 //----------------------------------------------------------------------------------------------------------//
 template<typename Derived, size_t DIM, typename OtherDerived, size_t OtherDIM>
@@ -14,18 +45,41 @@ FASTOR_INLINE void trivial_assign(AbstractTensor<Derived,DIM> &dst, const Abstra
     T* _data = dst.self().data();
 
     FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<OtherDerived>) {
-        FASTOR_INDEX i = 0;
-        for (; i <ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-            src.template eval<T>(i).store(&_data[i], FASTOR_ALIGNED);
-        }
-        for (; i < src.size(); ++i) {
-            _data[i] = src.template eval_s<T>(i);
+        if (internal::should_stream<T,V>(_data,src.size())) {
+            internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+                FASTOR_INDEX i = first;
+                for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                    stream_store(&_data[i], src.template eval<T>(i));
+                }
+                stream_fence();
+                for (; i < last; ++i) {
+                    _data[i] = src.template eval_s<T>(i);
+                }
+            });
+            return;
         }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                src.template eval<T>(i).store(&_data[i], FASTOR_ALIGNED);
+            }
+            FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,OtherDerived>::value) {
+                if (i < last) {
+                    tail_store(&_data[i], src.template eval<T>(i), last-i);
+                    i = last;
+                }
+            }
+            for (; i < last; ++i) {
+                _data[i] = src.template eval_s<T>(i);
+            }
+        });
     }
     else {
-        for (FASTOR_INDEX i = 0; i < src.size(); ++i) {
-            _data[i] = src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            for (FASTOR_INDEX i = first; i < last; ++i) {
+                _data[i] = src.template eval_s<T>(i);
+            }
+        });
     }
 }
 
@@ -38,19 +92,29 @@ FASTOR_INLINE void trivial_assign_add(AbstractTensor<Derived,DIM> &dst, const Ab
     T* _data = dst.self().data();
 
     FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<OtherDerived>) {
-        FASTOR_INDEX i = 0;
-        for (; i <ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-            V _vec = V(&_data[i], FASTOR_ALIGNED) + src.template eval<T>(i);
-            _vec.store(&_data[i], FASTOR_ALIGNED);
-        }
-        for (; i < src.size(); ++i) {
-            _data[i] += src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                V _vec = V(&_data[i], FASTOR_ALIGNED) + src.template eval<T>(i);
+                _vec.store(&_data[i], FASTOR_ALIGNED);
+            }
+            FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,OtherDerived,Derived>::value) {
+                if (i < last) {
+                    tail_store(&_data[i], V(&_data[i], FASTOR_ALIGNED) + src.template eval<T>(i), last-i);
+                    i = last;
+                }
+            }
+            for (; i < last; ++i) {
+                _data[i] += src.template eval_s<T>(i);
+            }
+        });
     }
     else {
-        for (FASTOR_INDEX i = 0; i < src.size(); ++i) {
-            _data[i] += src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            for (FASTOR_INDEX i = first; i < last; ++i) {
+                _data[i] += src.template eval_s<T>(i);
+            }
+        });
     }
 }
 
@@ -63,19 +127,29 @@ FASTOR_INLINE void trivial_assign_sub(AbstractTensor<Derived,DIM> &dst, const Ab
     T* _data = dst.self().data();
 
     FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<OtherDerived>) {
-        FASTOR_INDEX i = 0;
-        for (; i <ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-            V _vec = V(&_data[i], FASTOR_ALIGNED) - src.template eval<T>(i);
-            _vec.store(&_data[i], FASTOR_ALIGNED);
-        }
-        for (; i < src.size(); ++i) {
-            _data[i] -= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                V _vec = V(&_data[i], FASTOR_ALIGNED) - src.template eval<T>(i);
+                _vec.store(&_data[i], FASTOR_ALIGNED);
+            }
+            FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,OtherDerived,Derived>::value) {
+                if (i < last) {
+                    tail_store(&_data[i], V(&_data[i], FASTOR_ALIGNED) - src.template eval<T>(i), last-i);
+                    i = last;
+                }
+            }
+            for (; i < last; ++i) {
+                _data[i] -= src.template eval_s<T>(i);
+            }
+        });
     }
     else {
-        for (FASTOR_INDEX i = 0; i < src.size(); ++i) {
-            _data[i] -= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            for (FASTOR_INDEX i = first; i < last; ++i) {
+                _data[i] -= src.template eval_s<T>(i);
+            }
+        });
     }
 }
 
@@ -88,19 +162,29 @@ FASTOR_INLINE void trivial_assign_mul(AbstractTensor<Derived,DIM> &dst, const Ab
     T* _data = dst.self().data();
 
     FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<OtherDerived>) {
-        FASTOR_INDEX i = 0;
-        for (; i <ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-            V _vec = V(&_data[i], FASTOR_ALIGNED) * src.template eval<T>(i);
-            _vec.store(&_data[i], FASTOR_ALIGNED);
-        }
-        for (; i < src.size(); ++i) {
-            _data[i] *= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                V _vec = V(&_data[i], FASTOR_ALIGNED) * src.template eval<T>(i);
+                _vec.store(&_data[i], FASTOR_ALIGNED);
+            }
+            FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,OtherDerived,Derived>::value) {
+                if (i < last) {
+                    tail_store(&_data[i], V(&_data[i], FASTOR_ALIGNED) * src.template eval<T>(i), last-i);
+                    i = last;
+                }
+            }
+            for (; i < last; ++i) {
+                _data[i] *= src.template eval_s<T>(i);
+            }
+        });
     }
     else {
-        for (FASTOR_INDEX i = 0; i < src.size(); ++i) {
-            _data[i] *= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            for (FASTOR_INDEX i = first; i < last; ++i) {
+                _data[i] *= src.template eval_s<T>(i);
+            }
+        });
     }
 }
 
@@ -113,19 +197,29 @@ FASTOR_INLINE void trivial_assign_div(AbstractTensor<Derived,DIM> &dst, const Ab
     T* _data = dst.self().data();
 
     FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<OtherDerived>) {
-        FASTOR_INDEX i = 0;
-        for (; i <ROUND_DOWN(src.size(),V::Size); i+=V::Size) {
-            V _vec = V(&_data[i], FASTOR_ALIGNED) / src.template eval<T>(i);
-            _vec.store(&_data[i], FASTOR_ALIGNED);
-        }
-        for (; i < src.size(); ++i) {
-            _data[i] /= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                V _vec = V(&_data[i], FASTOR_ALIGNED) / src.template eval<T>(i);
+                _vec.store(&_data[i], FASTOR_ALIGNED);
+            }
+            FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,OtherDerived,Derived>::value && !std::is_integral<T>::value) {
+                if (i < last) {
+                    tail_store(&_data[i], V(&_data[i], FASTOR_ALIGNED) / src.template eval<T>(i), last-i);
+                    i = last;
+                }
+            }
+            for (; i < last; ++i) {
+                _data[i] /= src.template eval_s<T>(i);
+            }
+        });
     }
     else {
-        for (FASTOR_INDEX i = 0; i < src.size(); ++i) {
-            _data[i] /= src.template eval_s<T>(i);
-        }
+        internal::parallel_for<T,V>(src.size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            for (FASTOR_INDEX i = first; i < last; ++i) {
+                _data[i] /= src.template eval_s<T>(i);
+            }
+        });
     }
 }
 //----------------------------------------------------------------------------------------------------------//
@@ -139,13 +233,34 @@ FASTOR_INLINE void trivial_assign(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        _vec.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] = cnum;
+    if (internal::should_stream<T,V>(_data,dst.self().size())) {
+        internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+            FASTOR_INDEX i = first;
+            for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+                stream_store(&_data[i], _vec);
+            }
+            stream_fence();
+            for (; i < last; ++i) {
+                _data[i] = cnum;
+            }
+        });
+        return;
     }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            _vec.store(&_data[i], FASTOR_ALIGNED);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,T>::value) {
+            if (i < last) {
+                tail_store(&_data[i], _vec, last-i);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _data[i] = cnum;
+        }
+    });
 }
 
 template<typename Derived, size_t DIM, typename U,
@@ -156,15 +271,25 @@ FASTOR_INLINE void trivial_assign_add(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        V _vec_out(&_data[i], FASTOR_ALIGNED);
-        _vec_out += _vec;
-        _vec_out.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] += cnum;
-    }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            V _vec_out(&_data[i], FASTOR_ALIGNED);
+            _vec_out += _vec;
+            _vec_out.store(&_data[i], FASTOR_ALIGNED);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,T,Derived>::value) {
+            if (i < last) {
+                V _vec_out(&_data[i], FASTOR_ALIGNED);
+                _vec_out += _vec;
+                tail_store(&_data[i], _vec_out, last-i);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _data[i] += cnum;
+        }
+    });
 }
 
 template<typename Derived, size_t DIM, typename U,
@@ -175,15 +300,25 @@ FASTOR_INLINE void trivial_assign_sub(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        V _vec_out(&_data[i], FASTOR_ALIGNED);
-        _vec_out -= _vec;
-        _vec_out.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] -= cnum;
-    }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            V _vec_out(&_data[i], FASTOR_ALIGNED);
+            _vec_out -= _vec;
+            _vec_out.store(&_data[i], FASTOR_ALIGNED);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,T,Derived>::value) {
+            if (i < last) {
+                V _vec_out(&_data[i], FASTOR_ALIGNED);
+                _vec_out -= _vec;
+                tail_store(&_data[i], _vec_out, last-i);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _data[i] -= cnum;
+        }
+    });
 }
 
 template<typename Derived, size_t DIM, typename U,
@@ -194,15 +329,25 @@ FASTOR_INLINE void trivial_assign_mul(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        V _vec_out(&_data[i], FASTOR_ALIGNED);
-        _vec_out *= _vec;
-        _vec_out.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] *= cnum;
-    }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            V _vec_out(&_data[i], FASTOR_ALIGNED);
+            _vec_out *= _vec;
+            _vec_out.store(&_data[i], FASTOR_ALIGNED);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,T,Derived>::value) {
+            if (i < last) {
+                V _vec_out(&_data[i], FASTOR_ALIGNED);
+                _vec_out *= _vec;
+                tail_store(&_data[i], _vec_out, last-i);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _data[i] *= cnum;
+        }
+    });
 }
 
 template<typename Derived, size_t DIM, typename U,
@@ -213,15 +358,25 @@ FASTOR_INLINE void trivial_assign_div(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = T(1) / (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        V _vec_out(&_data[i], FASTOR_ALIGNED);
-        _vec_out *= _vec;
-        _vec_out.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] *= cnum;
-    }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            V _vec_out(&_data[i], FASTOR_ALIGNED);
+            _vec_out *= _vec;
+            _vec_out.store(&_data[i], FASTOR_ALIGNED);
+        }
+        FASTOR_IF_CONSTEXPR(internal::use_masked_tail<V,T,Derived>::value) {
+            if (i < last) {
+                V _vec_out(&_data[i], FASTOR_ALIGNED);
+                _vec_out *= _vec;
+                tail_store(&_data[i], _vec_out, last-i);
+                i = last;
+            }
+        }
+        for (; i < last; ++i) {
+            _data[i] *= cnum;
+        }
+    });
 }
 template<typename Derived, size_t DIM, typename U,
     enable_if_t_<is_primitive_v_<U> && is_integral_v_<U>, bool> = false>
@@ -231,15 +386,17 @@ FASTOR_INLINE void trivial_assign_div(AbstractTensor<Derived,DIM> &dst, U num) {
     T* _data = dst.self().data();
     T cnum = (T)num;
     V _vec(cnum);
-    FASTOR_INDEX i = 0;
-    for (; i< ROUND_DOWN(dst.self().size(),V::Size); i+=V::Size) {
-        V _vec_out(&_data[i], FASTOR_ALIGNED);
-        _vec_out /= _vec;
-        _vec_out.store(&_data[i], FASTOR_ALIGNED);
-    }
-    for (; i<dst.self().size(); ++i) {
-        _data[i] /= cnum;
-    }
+    internal::parallel_for<T,V>(dst.self().size(), [&](FASTOR_INDEX first, FASTOR_INDEX last) {
+        FASTOR_INDEX i = first;
+        for (; i < first + ROUND_DOWN(last-first,V::Size); i+=V::Size) {
+            V _vec_out(&_data[i], FASTOR_ALIGNED);
+            _vec_out /= _vec;
+            _vec_out.store(&_data[i], FASTOR_ALIGNED);
+        }
+        for (; i < last; ++i) {
+            _data[i] /= cnum;
+        }
+    });
 }
 
 
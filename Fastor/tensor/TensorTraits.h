@@ -63,6 +63,11 @@ template<typename T, size_t ... Rest>
 struct scalar_type_finder<TensorMap<T,Rest...>> {
     using type = T;
 };
+
+template<typename T, int DIM>
+struct scalar_type_finder<DynamicTensor<T,DIM>> {
+    using type = T;
+};
 //--------------------------------------------------------------------------------------------------------------------//
 
 
@@ -110,6 +115,11 @@ template<typename T, size_t ... Rest>
 struct tensor_type_finder<TensorMap<T,Rest...>> {
     using type = Tensor<T,Rest...>;
 };
+
+template<typename T, int DIM>
+struct tensor_type_finder<DynamicTensor<T,DIM>> {
+    using type = DynamicTensor<T,DIM>;
+};
 //--------------------------------------------------------------------------------------------------------------------//
 
 
@@ -128,6 +138,55 @@ constexpr bool is_tensor_v = is_tensor<T>::value;
 //--------------------------------------------------------------------------------------------------------------------//
 
 
+/* Is an expression a tensor map */
+//--------------------------------------------------------------------------------------------------------------------//
+template<class T>
+struct is_tensor_map {
+    static constexpr bool value = false;
+};
+template<class T, size_t ...Rest>
+struct is_tensor_map<TensorMap<T,Rest...>> {
+    static constexpr bool value = true;
+};
+template<typename T>
+constexpr bool is_tensor_map_v = is_tensor_map<T>::value;
+
+// Tensors and tensor maps whose elements can be read straight from memory
+template<typename T>
+constexpr bool is_contiguous_tensor_v = is_tensor_v<T> || is_tensor_map_v<T>;
+//--------------------------------------------------------------------------------------------------------------------//
+
+
+/* Is an expression a dynamic tensor or does it evaluate to one */
+//--------------------------------------------------------------------------------------------------------------------//
+template<class T>
+struct is_dynamic_tensor {
+    static constexpr bool value = false;
+};
+template<class T, int DIM>
+struct is_dynamic_tensor<DynamicTensor<T,DIM>> {
+    static constexpr bool value = true;
+};
+template<typename T>
+constexpr bool is_dynamic_tensor_v = is_dynamic_tensor<T>::value;
+
+template<class T, typename U = void>
+struct has_dynamic_extent {
+    static constexpr bool value = false;
+};
+template<class T>
+struct has_dynamic_extent<T, enable_if_t_<is_dynamic_tensor_v<typename T::result_type> > > {
+    static constexpr bool value = true;
+};
+template<typename T>
+constexpr bool has_dynamic_extent_v = has_dynamic_extent<T>::value;
+
+// Tensors that own their storage and can be handed to the backend as is
+template<typename T>
+constexpr bool is_evaluated_tensor_v = is_tensor_v<T> || is_dynamic_tensor_v<T>;
+//--------------------------------------------------------------------------------------------------------------------//
+
+
 /* Is an expression a abstract tensor */
 //--------------------------------------------------------------------------------------------------------------------//
 template<class T>
@@ -222,6 +281,12 @@ struct if_get_tensor_dimension<Idx,Dim,Tensor<T,Rest...>> {
    static constexpr size_t value = (Idx < sizeof...(Rest)) ? get_value<Idx+1,Rest...>::value : 1;
 };
 
+// Extents of dynamic tensors are not known at compile time and are reported as zero
+template<size_t Idx, size_t Dim, typename T, int DIM>
+struct if_get_tensor_dimension<Idx,Dim,DynamicTensor<T,DIM>> {
+   static constexpr size_t value = (Idx < DIM) ? 0 : 1;
+};
+
 template<size_t Idx, size_t Dim, class X>
 static constexpr size_t if_get_tensor_dimension_v = if_get_tensor_dimension<Idx,Dim,X>::value;
 
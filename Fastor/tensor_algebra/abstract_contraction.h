@@ -7,6 +7,7 @@
 #include "Fastor/meta/opmin_meta.h"
 #include "Fastor/expressions/expression_traits.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include "Fastor/tensor_algebra/einsum.h"
 #include "Fastor/tensor_algebra/contraction.h"
 #include "Fastor/tensor_algebra/network_contraction.h"
 #include "Fastor/tensor_algebra/network_contraction_no_opmin.h"
@@ -83,33 +84,46 @@ contraction(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived
 
 // By pair expressions - einsum
 //-------------------------------------------------------------------------------------------------
+// Inner and outer products as well as the contractions that are lowered to
+// permute + matmul consume the expressions, views and maps directly. Only the
+// kernels that require contiguous operands see evaluated tensors
 template<class Index_I, class Index_J, typename Derived0, typename Derived1, size_t DIM0, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false>
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) && is_pair_reduction_v<Index_I,Index_J>,bool> = false>
+FASTOR_INLINE
+Tensor<typename Derived0::scalar_type>
+einsum(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b)
+{
+    return inner(a.self(),b.self());
+}
+template<class Index_I, class Index_J, typename Derived0, typename Derived1, size_t DIM0, size_t DIM1,
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) &&
+                 !is_pair_reduction_v<Index_I,Index_J> && is_pair_outer_v<Index_I,Index_J>,bool> = false>
 FASTOR_INLINE
 decltype(auto)
 einsum(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b)
 {
-    typename Derived0::result_type res_a(a);
-    typename Derived1::result_type res_b(b);
-    return einsum<Index_I,Index_J>(res_a,res_b);
+    return outer(a.self(),b.self());
 }
 template<class Index_I, class Index_J, typename Derived0, typename Derived1, size_t DIM0, size_t DIM1,
-    enable_if_t_<is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false>
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) && internal::is_ttgt_contraction<Index_I,Index_J>::value,bool> = false>
 FASTOR_INLINE
 decltype(auto)
 einsum(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b)
 {
-    typename Derived1::result_type res_b(b);
-    return einsum<Index_I,Index_J>(a,res_b);
+    using out_type = decltype(extractor_contract_2<Index_I,Index_J>::contract_impl(
+        std::declval<typename Derived0::result_type>(),std::declval<typename Derived1::result_type>()));
+    return internal::ttgt_einsum<Index_I,Index_J,out_type>(a,b);
 }
 template<class Index_I, class Index_J, typename Derived0, typename Derived1, size_t DIM0, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && is_tensor_v<Derived1>,bool> = false>
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) &&
+                 !is_pair_reduction_v<Index_I,Index_J> && !is_pair_outer_v<Index_I,Index_J> &&
+                 !internal::is_ttgt_contraction<Index_I,Index_J>::value,bool> = false>
 FASTOR_INLINE
 decltype(auto)
 einsum(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b)
 {
-    typename Derived0::result_type res_a(a);
-    return einsum<Index_I,Index_J>(res_a,b);
+    // evaluate returns tensors as they are
+    return einsum<Index_I,Index_J>(evaluate(a.self()),evaluate(b.self()));
 }
 //-------------------------------------------------------------------------------------------------
 
@@ -50,7 +50,8 @@ template<class Index_I, class Index_J,
          typename std::enable_if<!is_pair_reduction<Index_I,Index_J>::value &&
          !internal::is_generalised_matrix_vector<Index_I,Index_J>::value &&
          !internal::is_generalised_vector_matrix<Index_I,Index_J>::value &&
-         !internal::is_generalised_matrix_matrix<Index_I,Index_J>::value
+         !internal::is_generalised_matrix_matrix<Index_I,Index_J>::value &&
+         !internal::is_ttgt_contraction<Index_I,Index_J>::value
          ,bool>::type=0>
 FASTOR_INLINE
 auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b)
@@ -139,6 +140,77 @@ einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) //{
     _matmul<T,M,K_product,N>(a.data(),b.data(),out.data());
     return out;
 }
+
+
+// All other by-pair contractions are lowered to permute + matmul (+ transpose)
+//-----------------------------------------------------------------------------------------------------------------------//
+namespace internal {
+// Operands that are already in their matrix layout are used in place
+template<class Perm, bool RequiresPermutation, typename T, size_t ... Rest,
+         enable_if_t_<!RequiresPermutation,bool> = false>
+FASTOR_INLINE const Tensor<T,Rest...>& ttgt_permute(const Tensor<T,Rest...> &a) {
+    return a;
+}
+template<class Perm, bool RequiresPermutation, typename T, size_t ... Rest,
+         enable_if_t_<RequiresPermutation,bool> = false>
+FASTOR_INLINE auto ttgt_permute(const Tensor<T,Rest...> &a) -> decltype(permute<Perm>(a)) {
+    return permute<Perm>(a);
+}
+// Expressions are evaluated straight in to their matrix layout
+template<class Perm, bool RequiresPermutation, typename Derived,
+         enable_if_t_<!RequiresPermutation && !is_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE typename Derived::result_type ttgt_permute(const Derived &a) {
+    return typename Derived::result_type(a);
+}
+template<class Perm, bool RequiresPermutation, typename Derived,
+         enable_if_t_<RequiresPermutation && !is_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE auto ttgt_permute(const Derived &a) -> decltype(permute<Perm>(a)) {
+    return permute<Perm>(a);
+}
+
+template<class Index_I, class Index_J, class OutTensor,
+         typename Derived0, size_t DIM0, typename Derived1, size_t DIM1>
+FASTOR_INLINE OutTensor ttgt_einsum(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
+
+    using T = typename Derived0::scalar_type;
+    using ttgt = internal::ttgt_contraction<Index_I,Index_J,
+        typename get_tensor_dimensions<typename Derived0::result_type>::tensor_to_index,
+        typename get_tensor_dimensions<typename Derived1::result_type>::tensor_to_index>;
+    constexpr size_t M = ttgt::M;
+    constexpr size_t K = ttgt::K;
+    constexpr size_t N = ttgt::N;
+
+    const auto &a_mat = internal::ttgt_permute<typename ttgt::permutation_0,ttgt::requires_permutation_0>(a.self());
+    const auto &b_mat = internal::ttgt_permute<typename ttgt::permutation_1,ttgt::requires_permutation_1>(b.self());
+
+    OutTensor out;
+    FASTOR_IF_CONSTEXPR(!ttgt::is_transposed) {
+        _matmul<T,M,K,N>(a_mat.data(),b_mat.data(),out.data());
+    }
+    else FASTOR_IF_CONSTEXPR(!ttgt::requires_transpose) {
+        _matmul<T,N,K,M>(b_mat.data(),a_mat.data(),out.data());
+    }
+    else {
+        Tensor<T,N,M> tmp;
+        _matmul<T,N,K,M>(b_mat.data(),a_mat.data(),tmp.data());
+        _transpose<T,N,M>(tmp.data(),out.data());
+    }
+    return out;
+}
+} // internal
+
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1,
+        typename std::enable_if<
+        internal::is_ttgt_contraction<Index_I,Index_J>::value,
+        bool>::type = 0>
+FASTOR_INLINE
+auto
+einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b)
+-> decltype(extractor_contract_2<Index_I,Index_J>::contract_impl(a,b)) {
+    return internal::ttgt_einsum<Index_I,Index_J,
+        decltype(extractor_contract_2<Index_I,Index_J>::contract_impl(a,b))>(a,b);
+}
 //-----------------------------------------------------------------------------------------------------------------------//
 
 
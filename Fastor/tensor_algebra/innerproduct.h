@@ -4,6 +4,7 @@
 #include "Fastor/backend/doublecontract.h"
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
 
 namespace Fastor {
 
@@ -71,38 +72,57 @@ FASTOR_INLINE T inner(const Tensor<T,Rest...> &a, const Tensor<T,Rest...> &b) {
 
 // Expressions
 //---------------------------------------------------------------------------------------------------
-template<typename Derived0, size_t DIM0>
+// Element-wise expressions, views and maps are reduced in place without
+// evaluating them in to temporary tensors
+template<typename Derived0, size_t DIM0,
+    enable_if_t_<!requires_evaluation_v<Derived0>,bool> = false >
 FASTOR_INLINE
 typename Derived0::scalar_type
 inner(const AbstractTensor<Derived0,DIM0> &a) {
+    using T = typename Derived0::scalar_type;
     using result_type = typename Derived0::result_type;
-    return inner(result_type(a));
-}
+    static_assert(DIM0<=1 || is_tensor_uniform_v<result_type>, "REDUCTION IS ONLY POSSIBLE ON UNIFORM TENSORS");
 
-template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false >
+    const Derived0 &src = a.self();
+    FASTOR_IF_CONSTEXPR (DIM0<=1) {
+        return sum(src);
+    }
+    // stride between consecutive diagonal entries a_ii...i
+    size_t stride = 0;
+    for (size_t it = 0, prod = 1; it < DIM0; ++it, prod *= src.dimension(0)) {
+        stride += prod;
+    }
+    T reductor = static_cast<T>(0);
+    for (size_t i=0; i<src.dimension(0); ++i) {
+        reductor += src.template eval_s<T>(i*stride);
+    }
+    return reductor;
+}
+template<typename Derived0, size_t DIM0,
+    enable_if_t_<requires_evaluation_v<Derived0>,bool> = false >
 FASTOR_INLINE
 typename Derived0::scalar_type
-inner(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using lhs_type = typename Derived0::result_type;
-    using rhs_type = typename Derived1::result_type;
-    return inner(lhs_type(a),rhs_type(b));
+inner(const AbstractTensor<Derived0,DIM0> &a) {
+    using result_type = typename Derived0::result_type;
+    return inner(result_type(a));
 }
+
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && is_tensor_v<Derived1>,bool> = false >
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) &&
+                 !requires_evaluation_v<Derived0> && !requires_evaluation_v<Derived1>,bool> = false >
 FASTOR_INLINE
 typename Derived0::scalar_type
 inner(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using lhs_type = typename Derived0::result_type;
-    return inner(lhs_type(a),b.self());
+    static_assert(is_same_v_<typename Derived0::result_type,typename Derived1::result_type>,
+        "INNER PRODUCT REQUIRES TENSORS OF THE SAME SHAPE");
+    return sum(a.self()*b.self());
 }
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false >
+    enable_if_t_<requires_evaluation_v<Derived0> || requires_evaluation_v<Derived1>,bool> = false >
 FASTOR_INLINE
 typename Derived0::scalar_type
 inner(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using rhs_type = typename Derived1::result_type;
-    return inner(a.self(),rhs_type(b));
+    return inner(evaluate(a.self()),evaluate(b.self()));
 }
 
 
@@ -98,6 +98,20 @@ auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b,
 }
 
 
+// 9 or more
+template<class Index_I, class Index_J, class ... Index_Ks,
+         typename T, size_t ... Rest0, size_t ... Rest1, typename ... Tensors,
+         enable_if_t_<(sizeof...(Tensors) >= 7 && sizeof...(Index_Ks) == sizeof...(Tensors)),bool> = false>
+FASTOR_INLINE
+auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, const Tensors& ... rest)
+-> decltype(extractor_contract_n<Index_I,Index_J,Index_Ks...>::contract_impl(a,b,rest...)) {
+
+    static_assert(einsum_index_checker<typename concat_<Index_I,Index_J,Index_Ks...>::type>::value,
+                  "INDICES FOR EINSUM FUNCTION CANNOT APPEAR MORE THAN TWICE. USE CONTRACTION INSTEAD");
+    return extractor_contract_n<Index_I,Index_J,Index_Ks...>::contract_impl(a,b,rest...);
+}
+
+
 
 #else
 
@@ -4,6 +4,7 @@
 #include "Fastor/backend/dyadic.h"
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/linalg_ops/linalg_traits.h"
 
 
 namespace Fastor {
@@ -42,30 +43,57 @@ outer(const Tensor<T> &a, const Tensor<T> &b) {
 
 // Expressions
 //---------------------------------------------------------------------------------------------------
-template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false >
-FASTOR_INLINE
-concatenated_tensor_t<typename Derived0::result_type,typename Derived1::result_type>
-outer(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using lhs_type = typename Derived0::result_type;
-    using rhs_type = typename Derived1::result_type;
-    return outer(lhs_type(a),rhs_type(b));
+namespace internal {
+// The right operand is read once for every entry of the left operand so unless
+// its elements are already in memory it is evaluated once up front
+template<typename Derived, enable_if_t_<is_contiguous_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE const Derived& outer_rhs_evaluate(const Derived &b) {
+    return b;
 }
+template<typename Derived, enable_if_t_<!is_contiguous_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE typename Derived::result_type outer_rhs_evaluate(const Derived &b) {
+    return typename Derived::result_type(b);
+}
+} // internal
+
+// Element-wise expressions, views and maps are multiplied out directly in to the
+// output. The left operand is never evaluated in to a temporary tensor
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<!is_tensor_v<Derived0> && is_tensor_v<Derived1>,bool> = false >
+    enable_if_t_<!(is_tensor_v<Derived0> && is_tensor_v<Derived1>) &&
+                 !requires_evaluation_v<Derived0> && !requires_evaluation_v<Derived1>,bool> = false >
 FASTOR_INLINE
 concatenated_tensor_t<typename Derived0::result_type,typename Derived1::result_type>
 outer(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using lhs_type = typename Derived0::result_type;
-    return outer(lhs_type(a),b.self());
+    using T = typename Derived0::scalar_type;
+    using out_type = concatenated_tensor_t<typename Derived0::result_type,typename Derived1::result_type>;
+
+    const Derived0 &lhs = a.self();
+    const auto &rhs = internal::outer_rhs_evaluate(b.self());
+    using V = typename remove_all_t<decltype(rhs)>::simd_vector_type;
+    const FASTOR_INDEX M = lhs.size();
+    const FASTOR_INDEX N = rhs.size();
+
+    out_type out;
+    T *out_data = out.data();
+    for (FASTOR_INDEX i=0; i<M; ++i) {
+        const T a_s = lhs.template eval_s<T>(i);
+        const V a_v(a_s);
+        FASTOR_INDEX j=0;
+        for (; j<ROUND_DOWN(N,V::Size); j+=V::Size) {
+            (a_v*rhs.template eval<T>(j)).store(&out_data[i*N+j],false);
+        }
+        for (; j<N; ++j) {
+            out_data[i*N+j] = a_s*rhs.template eval_s<T>(j);
+        }
+    }
+    return out;
 }
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
-    enable_if_t_<is_tensor_v<Derived0> && !is_tensor_v<Derived1>,bool> = false >
+    enable_if_t_<requires_evaluation_v<Derived0> || requires_evaluation_v<Derived1>,bool> = false >
 FASTOR_INLINE
 concatenated_tensor_t<typename Derived0::result_type,typename Derived1::result_type>
 outer(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
-    using rhs_type = typename Derived1::result_type;
-    return outer(a.self(),rhs_type(b));
+    return outer(evaluate(a.self()),evaluate(b.self()));
 }
 //---------------------------------------------------------------------------------------------------
 
@@ -97,7 +125,8 @@ dyadic(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM
 //     return a;
 // }
 
-template<typename AbstractTensorType0, typename AbstractTensorType1, typename ... AbstractTensorTypes>
+template<typename AbstractTensorType0, typename AbstractTensorType1, typename ... AbstractTensorTypes,
+    enable_if_t_<sizeof...(AbstractTensorTypes) >= 1,bool> = false>
 FASTOR_INLINE
 auto
 outer(const AbstractTensorType0& a, const AbstractTensorType1& b, const AbstractTensorTypes& ... rest)
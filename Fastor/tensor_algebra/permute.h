@@ -116,6 +116,142 @@ struct NewRecursiveCartesianPermDispatcher<Index<Idx...>, Tensor<T,Rest...>, Ind
 
 
 
+/* Blocked permutation engine. Permute<Perm...> maps output axis k to input axis Perm[k].
+    The two fastest changing axes, that is the last axis of the output and the last axis of
+    the input are tiled together in to SIMD width square blocks which are transposed in-register
+    through the transpose kernels, while the remaining axes are walked with an odometer.
+    If both last axes coincide the permutation reduces to copying contiguous runs.
+    Compared to the element-wise loops both the reads and the writes stay contiguous
+    across the tile, which matters for large tensors of rank three and above
+*/
+template<typename T, class Dims, class Perm>
+struct blocked_permute;
+
+template<typename T, size_t ... Rest, size_t ... Perm>
+struct blocked_permute<T, Index<Rest...>, Index<Perm...> > {
+
+    static constexpr size_t dim       = sizeof...(Rest);
+    static constexpr size_t last      = dim - 1;
+    // the input axis that ends up being the fastest changing one in the output
+    static constexpr size_t inner_a   = get_value<last+1,Perm...>::value;
+    static constexpr size_t rows      = get_value<inner_a+1,Rest...>::value;
+    static constexpr size_t cols      = get_value<last+1,Rest...>::value;
+    // the output axis the fastest changing input axis is sent to
+    static constexpr size_t inner_out = find_index(Index<Perm...>::values,last);
+
+    // Narrow the tile down to a half or quarter register if the axes are short
+    using full_type    = SIMDVector<T,DEFAULT_ABI>;
+    using half_type    = typename get_half_simd_type<full_type>::type;
+    using quarter_type = typename get_half_simd_type<half_type>::type;
+    static constexpr size_t tile = rows < cols ? rows : cols;
+    using V = conditional_t_<tile >= full_type::Size, full_type,
+                conditional_t_<tile >= half_type::Size, half_type, quarter_type> >;
+    static constexpr size_t SIMDSize  = V::Size;
+
+    // Only worth it if the tiles are full SIMD registers
+    static constexpr bool value = (is_same_v_<T,float> || is_same_v_<T,double>) &&
+                                  SIMDSize > 1 && dim > 1 && tile >= SIMDSize;
+
+    using seq_type        = typename std_ext::make_index_sequence<dim>::type;
+    using dims_out_type   = Index<get_value<Perm+1,Rest...>::value...>;
+    static constexpr std::array<size_t,dim> perm     = {Perm...};
+    static constexpr std::array<size_t,dim> dims_out = {get_value<Perm+1,Rest...>::value...};
+
+    // Transposes the rows x cols tile a[j*lda+i] -> out[i*ldo+j]
+    template<size_t lda, size_t ldo>
+    static FASTOR_INLINE void transpose_tile(const T * FASTOR_RESTRICT a, T * FASTOR_RESTRICT out) {
+        constexpr size_t ROWS = rows / SIMDSize * SIMDSize;
+        constexpr size_t COLS = cols / SIMDSize * SIMDSize;
+        FASTOR_ARCH_ALIGN T pack_a[SIMDSize*SIMDSize];
+        FASTOR_ARCH_ALIGN T pack_out[SIMDSize*SIMDSize];
+        V _vec;
+
+        size_t i=0;
+        for (; i<COLS; i+=SIMDSize) {
+            size_t j=0;
+            for (; j<ROWS; j+=SIMDSize) {
+                for (size_t jj=0; jj<SIMDSize; ++jj) {
+                    _vec.load(&a[(j+jj)*lda+i],false);
+                    _vec.store(&pack_a[jj*SIMDSize]);
+                }
+                internal::_transpose_dispatch<T,SIMDSize,SIMDSize>(pack_a,pack_out);
+                for (size_t ii=0; ii<SIMDSize; ++ii) {
+                    _vec.load(&pack_out[ii*SIMDSize]);
+                    _vec.store(&out[(i+ii)*ldo+j],false);
+                }
+            }
+            // remainder rows
+            for (; j<rows; ++j) {
+                for (size_t ii=0; ii<SIMDSize; ++ii) {
+                    out[(i+ii)*ldo+j] = a[j*lda+i+ii];
+                }
+            }
+        }
+        // remainder columns
+        for (; i<cols; ++i) {
+            for (size_t j=0; j<rows; ++j) {
+                out[i*ldo+j] = a[j*lda+i];
+            }
+        }
+    }
+
+    // Copies a contiguous run of cols elements
+    static FASTOR_INLINE void copy_run(const T * FASTOR_RESTRICT a, T * FASTOR_RESTRICT out) {
+        constexpr size_t COLS = cols / SIMDSize * SIMDSize;
+        V _vec;
+        size_t i=0;
+        for (; i<COLS; i+=SIMDSize) {
+            _vec.load(&a[i],false);
+            _vec.store(&out[i],false);
+        }
+        for (; i<cols; ++i) {
+            out[i] = a[i];
+        }
+    }
+
+    static FASTOR_INLINE void Do(const T * FASTOR_RESTRICT a_data, T * FASTOR_RESTRICT out_data) {
+
+        constexpr auto& strides_a   = nprods_views<Index<Rest...>,seq_type>::values;
+        constexpr auto& strides_out = nprods_views<dims_out_type,seq_type>::values;
+
+        constexpr bool is_copy = inner_a == last;
+        constexpr size_t lda   = strides_a[inner_a];
+        constexpr size_t ldo   = strides_out[inner_out];
+
+        // Odometer over the output axes that are not part of the tile
+        std::array<size_t,dim> as = {};
+        size_t index_a = 0, index_out = 0;
+        while(true)
+        {
+            FASTOR_IF_CONSTEXPR(is_copy) {
+                copy_run(&a_data[index_a],&out_data[index_out]);
+            }
+            else {
+                transpose_tile<lda,ldo>(&a_data[index_a],&out_data[index_out]);
+            }
+
+            int jt = int(last) - 1;
+            for (; jt>=0; --jt) {
+                if (!is_copy && size_t(jt)==inner_out) continue;
+                index_a   += strides_a[perm[jt]];
+                index_out += strides_out[jt];
+                if (++as[jt]<dims_out[jt]) break;
+                index_a   -= as[jt]*strides_a[perm[jt]];
+                index_out -= as[jt]*strides_out[jt];
+                as[jt] = 0;
+            }
+            if (jt<0) break;
+        }
+    }
+};
+
+template<typename T, size_t ... Rest, size_t ... Perm>
+constexpr std::array<size_t,blocked_permute<T,Index<Rest...>,Index<Perm...>>::dim> blocked_permute<T,Index<Rest...>,Index<Perm...>>::perm;
+template<typename T, size_t ... Rest, size_t ... Perm>
+constexpr std::array<size_t,blocked_permute<T,Index<Rest...>,Index<Perm...>>::dim> blocked_permute<T,Index<Rest...>,Index<Perm...>>::dims_out;
+
+
+
 template<class T>
 struct new_extractor_perm {};
 
@@ -135,6 +271,13 @@ struct new_extractor_perm<Index<Idx...> > {
         constexpr bool requires_permutation = _permute_impl::requires_permutation;
         FASTOR_IF_CONSTEXPR(!requires_permutation) return a;
 
+        using _blocked = blocked_permute<T,Index<Rest...>,typename _permute_impl::resulting_index>;
+        FASTOR_IF_CONSTEXPR(_blocked::value) {
+            resulting_tensor out;
+            _blocked::Do(a.data(),out.data());
+            return out;
+        }
+
 #if CONTRACT_OPT==-1
 
         using maxes_out_type = typename put_dims_in_Index<resulting_tensor>::type;
@@ -0,0 +1,225 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "Fastor/util/timeit.h"
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+// Statistical benchmarking
+//
+// Unlike timeit which only prints the best/mean/worst times, benchit collects
+// every sample and returns the full distribution so that results can be
+// compared across commits. A sample is a batch of back-to-back calls whose
+// length is calibrated such that the batch takes at least
+// FASTOR_BENCH_SAMPLE_TIME seconds, so that the resolution of the clock and
+// the overhead of rdtsc_begin/rdtsc_end do not dominate small kernels.
+// Sampling stops after FASTOR_BENCH_RUNTIME seconds but never before
+// FASTOR_BENCH_MIN_SAMPLES samples are collected
+
+namespace Fastor {
+
+#ifndef FASTOR_BENCH_SAMPLE_TIME
+#define FASTOR_BENCH_SAMPLE_TIME 1.0e-4
+#endif
+
+#ifndef FASTOR_BENCH_MIN_SAMPLES
+#define FASTOR_BENCH_MIN_SAMPLES 10UL
+#endif
+
+#ifndef FASTOR_BENCH_MAX_SAMPLES
+#define FASTOR_BENCH_MAX_SAMPLES 2000UL
+#endif
+
+
+/* Statistics of a single benchmark. All times are in seconds and cycles are
+    rdtsc ticks, both per call. flops is the number of floating point
+    operations of a call [0 if not known]
+*/
+struct bench_result {
+    std::string name;
+    uint64_t samples = 0;
+    uint64_t runs_per_sample = 0;
+    double min_time = 0;
+    double p10_time = 0;
+    double median_time = 0;
+    double p90_time = 0;
+    double max_time = 0;
+    double mean_time = 0;
+    double stddev_time = 0;
+    double median_cycles = 0;
+    double flops = 0;
+
+    inline double gflops() const {
+        return flops > 0 && median_time > 0 ? flops / median_time * 1e-9 : 0;
+    }
+};
+
+
+namespace internal {
+/* p-th percentile [0 <= p <= 1] of sorted data with linear interpolation */
+inline double _bench_percentile(const std::vector<double> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    const double pos = p*double(sorted.size()-1);
+    const size_t lo = size_t(pos);
+    const size_t hi = std::min(lo+1,sorted.size()-1);
+    return sorted[lo] + (pos - double(lo))*(sorted[hi] - sorted[lo]);
+}
+
+/* Escape a string for use as a JSON string literal */
+inline std::string _bench_json_escape(const std::string &str) {
+    std::ostringstream os;
+    for (const char c : str) {
+        switch (c) {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\r': os << "\\r"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c);
+                else os << c;
+        }
+    }
+    return os.str();
+}
+} // internal
+
+
+template<typename F>
+inline bench_result benchit(const std::string &name, double flops, F &&func) {
+    using clock = std::chrono::steady_clock;
+
+    // Warm up and calibrate the number of runs per sample
+    uint64_t runs = 1;
+    for (;;) {
+        auto start = clock::now();
+        for (uint64_t run=0; run<runs; ++run) func();
+        const double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        if (elapsed >= FASTOR_BENCH_SAMPLE_TIME || runs >= (uint64_t(1) << 30)) break;
+        runs *= elapsed > 0 ? std::max(uint64_t(2), uint64_t(1.2*FASTOR_BENCH_SAMPLE_TIME/elapsed)) : uint64_t(2);
+    }
+
+    std::vector<double> times, cycles;
+    times.reserve(FASTOR_BENCH_MAX_SAMPLES);
+    cycles.reserve(FASTOR_BENCH_MAX_SAMPLES);
+
+    double accum_time = 0.0;
+    while (times.size() < FASTOR_BENCH_MIN_SAMPLES ||
+          (accum_time < FASTOR_BENCH_RUNTIME && times.size() < FASTOR_BENCH_MAX_SAMPLES)) {
+        auto start = clock::now();
+        auto cycle = rdtsc_begin();
+        for (uint64_t run=0; run<runs; ++run) func();
+        cycle = rdtsc_end() - cycle;
+        const double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+        times.push_back(elapsed/double(runs));
+        cycles.push_back(double(cycle)/double(runs));
+        accum_time += elapsed;
+    }
+
+    bench_result result;
+    result.name = name;
+    result.samples = times.size();
+    result.runs_per_sample = runs;
+    result.flops = flops;
+
+    result.mean_time = std::accumulate(times.begin(),times.end(),0.0) / double(times.size());
+    double var = 0;
+    for (auto t : times) var += (t - result.mean_time)*(t - result.mean_time);
+    result.stddev_time = std::sqrt(var / double(times.size()));
+
+    std::sort(times.begin(),times.end());
+    std::sort(cycles.begin(),cycles.end());
+    result.min_time      = times.front();
+    result.max_time      = times.back();
+    result.p10_time      = internal::_bench_percentile(times,0.10);
+    result.median_time   = internal::_bench_percentile(times,0.50);
+    result.p90_time      = internal::_bench_percentile(times,0.90);
+    result.median_cycles = internal::_bench_percentile(cycles,0.50);
+
+    return result;
+}
+
+template<typename F>
+inline bench_result benchit(const std::string &name, F &&func) {
+    return benchit(name, 0., std::forward<F>(func));
+}
+
+
+/* Collection of benchmark results that can be printed and written out
+    as JSON or CSV to track performance regressions
+*/
+class bench_report {
+public:
+    bench_report() = default;
+
+    inline void add(const bench_result &result) {
+        results.push_back(result);
+        print(result);
+    }
+
+    inline const std::vector<bench_result>& get() const {return results;}
+
+    inline void print(const bench_result &r) const {
+        std::cout << std::left << std::setw(40) << r.name << std::right
+            << FGRN(BOLD(" median: ")) << std::setprecision(4) << std::setw(8) << useless::format_time(r.median_time) << useless::format_time_string(r.median_time)
+            << FGRN(BOLD(" p10-p90: ")) << useless::format_time(r.p10_time) << "-" << useless::format_time(r.p90_time) << useless::format_time_string(r.p90_time)
+            << FGRN(BOLD(" cycles: ")) << uint64_t(r.median_cycles);
+        if (r.flops > 0) std::cout << FGRN(BOLD(" GFLOP/s: ")) << r.gflops();
+        std::cout << std::endl;
+    }
+
+    inline void write_json(std::ostream &os) const {
+        os << "{\n  \"benchmarks\": [\n";
+        for (size_t i=0; i<results.size(); ++i) {
+            const auto &r = results[i];
+            os << "    {"
+               << "\"name\": \"" << internal::_bench_json_escape(r.name) << "\", "
+               << "\"samples\": " << r.samples << ", "
+               << "\"runs_per_sample\": " << r.runs_per_sample << ", "
+               << std::setprecision(9)
+               << "\"min\": " << r.min_time << ", "
+               << "\"p10\": " << r.p10_time << ", "
+               << "\"median\": " << r.median_time << ", "
+               << "\"p90\": " << r.p90_time << ", "
+               << "\"max\": " << r.max_time << ", "
+               << "\"mean\": " << r.mean_time << ", "
+               << "\"stddev\": " << r.stddev_time << ", "
+               << "\"cycles\": " << r.median_cycles << ", "
+               << "\"flops\": " << r.flops << ", "
+               << "\"gflops\": " << r.gflops() << "}"
+               << (i+1 < results.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    inline void write_csv(std::ostream &os) const {
+        os << "name,samples,runs_per_sample,min,p10,median,p90,max,mean,stddev,cycles,flops,gflops\n";
+        os << std::setprecision(9);
+        for (const auto &r : results) {
+            os << '"' << r.name << "\"," << r.samples << ',' << r.runs_per_sample << ','
+               << r.min_time << ',' << r.p10_time << ',' << r.median_time << ',' << r.p90_time << ','
+               << r.max_time << ',' << r.mean_time << ',' << r.stddev_time << ','
+               << r.median_cycles << ',' << r.flops << ',' << r.gflops() << '\n';
+        }
+    }
+
+    /* Write to filename, the format is deduced from the extension [.json or .csv] */
+    inline bool write(const std::string &filename) const {
+        std::ofstream file(filename);
+        if (!file) return false;
+        const bool is_csv = filename.size() >= 4 && filename.compare(filename.size()-4,4,".csv") == 0;
+        if (is_csv) write_csv(file);
+        else write_json(file);
+        return true;
+    }
+
+private:
+    std::vector<bench_result> results;
+};
+
+} // end of namespace Fastor
+
+#endif // BENCHMARK_H
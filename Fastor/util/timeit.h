@@ -103,17 +103,23 @@ inline uint64_t rdtsc_end() {
 //  Linux/GCC
 #else
 inline uint64_t rdtsc() {
-    unsigned int lo, hi;
     // This does not clobber the register so rdtsc overwrites
     // the register, see
     // How to Benchmark Code Execution Times on Intel® IA-32
     // and IA-64 Instruction Set Architectures pp-9
     // https://intel.ly/3dXFfQN
-#ifdef FASTOR_SIMPLE_RDTSC
+#if defined(__aarch64__)
+    // There is no time stamp counter on AArch64, read the virtual timer instead
+    uint64_t cnt;
+    __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (cnt));
+    return cnt;
+#elif defined(FASTOR_SIMPLE_RDTSC)
+    unsigned int lo, hi;
     __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
     return ((uint64_t)hi << 32) | lo;
 #else
     // Use this instead
+    unsigned int lo, hi;
     __asm__ __volatile__ ("RDTSC\n\t"
                          "mov %%edx, %0\n\t"
                          "mov %%eax, %1\n\t": "=r" (hi), "=r" (lo) ::
@@ -121,11 +127,27 @@ inline uint64_t rdtsc() {
                          // "%eax", "%edx" // IA-32
                          "%rax", "%rdx"    // IA-64
                      );
-#endif
     return ((uint64_t)hi << 32) | lo;
+#endif
 }
 
-#ifndef FASTOR_SIMPLE_RDTSC
+#if defined(__aarch64__)
+// The isb barrier keeps the read of the virtual timer from being
+// reordered with the instructions around it
+inline uint64_t rdtsc_begin() {
+    uint64_t cnt;
+    __asm__ __volatile__ ("isb\n\t"
+                         "mrs %0, cntvct_el0" : "=r" (cnt) :: "memory");
+    return cnt;
+}
+inline uint64_t rdtsc_end() {
+    uint64_t cnt;
+    __asm__ __volatile__ ("isb\n\t"
+                         "mrs %0, cntvct_el0\n\t"
+                         "isb" : "=r" (cnt) :: "memory");
+    return cnt;
+}
+#elif !defined(FASTOR_SIMPLE_RDTSC)
 // There is still one problem with the function above [rdtsc()]
 // and that is it does not take care of cpu's out-of-order
 // executation. In order to serialise we make a call to cpuid
@@ -0,0 +1,122 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define NBATCH 1024UL
+#define NITER 800UL
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void iterate_over_instances(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            _matmul<T,M,K,N>(a+i*M*K,b+i*K*N,out+i*M*N);
+        }
+        unused(out);
+    }
+}
+
+template<typename T, size_t M, size_t K, size_t N>
+void iterate_over_batch(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        batch_matmul<T,M,K,N>(a,b,out,NBATCH);
+        unused(out);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_over_instances_inverse(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT , T *FASTOR_RESTRICT out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            _inverse<T,M>(a+i*M*M,out+i*M*M);
+        }
+        unused(out);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_over_batch_inverse(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT , T *FASTOR_RESTRICT out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        batch_inverse<T,M>(a,out,NBATCH);
+        unused(out);
+    }
+}
+
+
+template<typename T>
+T* allocate(size_t size) {
+    T *a = static_cast<T*>(_mm_malloc(sizeof(T) * size, 64));
+    for (size_t i=0; i<size; ++i) a[i] = T(i % 7 + 1) + (i % 3 == 0 ? T(100) : T(0));
+    return a;
+}
+
+void report(double time_instances, uint64_t cycles_instances, double time_batch, uint64_t cycles_batch) {
+    println(FGRN(BOLD(" Speed-up over per-instance loop [elapsed time]")), time_instances/time_batch,
+        FGRN(BOLD("[CPU cycles per instance]")), (double)cycles_instances/(double)(NITER*NBATCH),
+        (double)cycles_batch/(double)(NITER*NBATCH));
+    print();
+}
+
+template<typename T, size_t M, size_t K, size_t N>
+void run_matmul() {
+
+    // the per-instance and the batched kernels read from the same amount of memory
+    T *a   = allocate<T>(batch_storage_size<T,M,K>(NBATCH));
+    T *b   = allocate<T>(batch_storage_size<T,K,N>(NBATCH));
+    T *out = allocate<T>(batch_storage_size<T,M,N>(NBATCH));
+
+    double time_instances, time_batch;
+    uint64_t cycles_instances, cycles_batch;
+
+    std::tie(time_instances, cycles_instances) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_over_instances<T,M,K,N>),a,b,out);
+    std::tie(time_batch, cycles_batch) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_over_batch<T,M,K,N>),a,b,out);
+
+    println(FBLU(BOLD("Batched matmul of size (M, K, N)")), M, K, N);
+    report(time_instances, cycles_instances, time_batch, cycles_batch);
+
+    _mm_free(a);
+    _mm_free(b);
+    _mm_free(out);
+}
+
+template<typename T, size_t M>
+void run_inverse() {
+
+    T *a   = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+    T *out = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+
+    double time_instances, time_batch;
+    uint64_t cycles_instances, cycles_batch;
+
+    std::tie(time_instances, cycles_instances) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_over_instances_inverse<T,M>),a,a,out);
+    std::tie(time_batch, cycles_batch) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_over_batch_inverse<T,M>),a,a,out);
+
+    println(FBLU(BOLD("Batched inverse of size (M, M)")), M, M);
+    report(time_instances, cycles_instances, time_batch, cycles_batch);
+
+    _mm_free(a);
+    _mm_free(out);
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Running batched small matrix benchmarks [Benchmarks SIMD vectorisation across instances]")));
+    print("Single precision benchmark");
+    run_matmul<float,2,2,2>();
+    run_matmul<float,3,3,3>();
+    run_matmul<float,6,6,6>();
+    run_matmul<float,9,9,9>();
+    run_inverse<float,2>();
+    run_inverse<float,3>();
+    run_inverse<float,4>();
+    print("Double precision benchmark");
+    run_matmul<double,2,2,2>();
+    run_matmul<double,3,3,3>();
+    run_matmul<double,6,6,6>();
+    run_matmul<double,9,9,9>();
+    run_inverse<double,2>();
+    run_inverse<double,3>();
+    run_inverse<double,4>();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Build once with runtime dispatch and without -march and once with
+// -march=native to compare the dispatched kernels against native ones
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define NITER 10UL
+
+
+template<typename T>
+void run_gemm(DynamicTensor<T,2> &a, DynamicTensor<T,2> &b, DynamicTensor<T,2> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        c = matmul(a,b);
+        unused(c);
+    }
+}
+
+template<typename T, size_t M, size_t K, size_t N>
+void run_static_gemm(Tensor<T,M,K> &a, Tensor<T,K,N> &b, Tensor<T,M,N> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        c = matmul(a,b);
+        unused(c);
+    }
+}
+
+template<typename T>
+void run_dynamic(size_t M, size_t K, size_t N) {
+    DynamicTensor<T,2> a(M,K), b(K,N), c(M,N);
+    a.iota(1); a /= T(M*K);
+    b.iota(1); b /= T(K*N);
+    double time; uint64_t cycles;
+    std::tie(time,cycles) = rtimeit(static_cast<void (*)(DynamicTensor<T,2>&, DynamicTensor<T,2>&, DynamicTensor<T,2>&)>(&run_gemm<T>),a,b,c);
+    println(FGRN(BOLD(" DynamicTensor matmul of size (M, K, N)")), M, K, N, FGRN(BOLD("GFLOP/s")), 2.*M*K*N*NITER/time*1e-9);
+    print();
+}
+
+template<typename T, size_t M, size_t K, size_t N>
+void run_static() {
+    Tensor<T,M,K> a; a.iota(1); a /= T(M*K);
+    Tensor<T,K,N> b; b.iota(1); b /= T(K*N);
+    Tensor<T,M,N> c;
+    double time; uint64_t cycles;
+    std::tie(time,cycles) = rtimeit(static_cast<void (*)(Tensor<T,M,K>&, Tensor<T,K,N>&, Tensor<T,M,N>&)>(&run_static_gemm<T,M,K,N>),a,b,c);
+    println(FGRN(BOLD(" Tensor matmul of size (M, K, N)")), M, K, N, FGRN(BOLD("GFLOP/s")), 2.*M*K*N*NITER/time*1e-9);
+    print();
+}
+
+template<typename T>
+void run_all() {
+    run_static<T,32,32,32>();
+    run_static<T,64,64,64>();
+    run_static<T,100,100,100>();
+    run_dynamic<T>(64,64,64);
+    run_dynamic<T>(256,256,256);
+    run_dynamic<T>(513,257,129);
+    run_dynamic<T>(1000,1000,1);
+}
+
+int main() {
+
+    const char *names[4] = {"Scalar", "SSE2", "AVX2", "AVX512"};
+    println(FBLU(BOLD("Running matmul benchmarks [Benchmarks runtime CPU dispatch]")), "compiled for",
+        names[int(compiled_isa())], "dispatching to", names[int(get_dispatch_isa())]);
+    print();
+    print("Single precision benchmark");
+    run_all<float>();
+    print("Double precision benchmark");
+    run_all<double>();
+
+    return 0;
+}
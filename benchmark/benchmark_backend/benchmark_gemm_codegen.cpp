@@ -0,0 +1,69 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+#define NITER 100000000UL
+
+/* Built twice by the Makefile, once with the kernels generated by tools/gemm_codegen for the
+    shapes below [FASTOR_GEMM_KERNELS_HEADER] and once without, so that the two timings can be compared
+*/
+
+template<typename T, size_t M, size_t K, size_t N>
+void iterate_over_fastor(const Tensor<T,M,K> &a, const Tensor<T,K,N> &b, Tensor<T,M,N> &c) {
+    constexpr size_t niter = NITER / (M*K*N) + 1;
+    for (size_t iter=0; iter<niter; ++iter) {
+        _matmul<T,M,K,N>(a.data(),b.data(),c.data());
+        unused(a);
+        unused(b);
+        unused(c);
+    }
+}
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void run() {
+
+    Tensor<T,M,K> a; a.random();
+    Tensor<T,K,N> b; b.random();
+    Tensor<T,M,N> c;
+
+    double time_fastor;
+    uint64_t cycles_fastor;
+    std::tie(time_fastor, cycles_fastor) = rtimeit(static_cast<void (*)(const Tensor<T,M,K>&, const Tensor<T,K,N>&, Tensor<T,M,N>&)>
+        (&iterate_over_fastor<T,M,K,N>),a,b,c);
+
+    constexpr size_t niter = NITER / (M*K*N) + 1;
+    println(FBLU(BOLD("Matrices size (M, K, N)")), M, K, N);
+    print();
+    println(internal::gemm_kernel<T,M,K,N>::value ? FGRN(BOLD("Generated kernel [cycles per call]")) :
+        FBLU(BOLD("Fastor kernel [cycles per call]")), double(cycles_fastor)/niter);
+    print();
+}
+
+
+template<typename T>
+void run_all() {
+    // Typical shapes of finite element kernels
+    run<T,4,3,3>();
+    run<T,8,3,3>();
+    run<T,10,3,3>();
+    run<T,20,3,3>();
+    run<T,27,3,3>();
+    run<T,27,3,9>();
+    run<T,3,8,3>();
+    run<T,3,27,3>();
+    run<T,9,9,9>();
+    run<T,5,7,13>();
+    run<T,24,24,24>();
+}
+
+int main() {
+
+    print(FBLU(BOLD("Running exact-shape matmul benchmarks [Benchmarks GEMM code generator]")));
+    print("Single precision benchmark");
+    run_all<float>();
+    print("Double precision benchmark");
+    run_all<double>();
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+// Small tensors of every size from 1 to 64 where the remainder of the SIMD loops is a large
+// fraction of the work. Build with -DFASTOR_NO_MASKED_TAILS to compare against finishing the
+// loops with scalar code
+#define NITER 1000000UL
+
+
+template<typename T, size_t M>
+void iterate_assign(Tensor<T,M> &a, const Tensor<T,M> &b, const Tensor<T,M> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = b*c + a;
+        unused(a);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_inplace(Tensor<T,M> &a, const Tensor<T,M> &b) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a *= sqrt(b);
+        unused(a);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_sum(const Tensor<T,M> &a, const Tensor<T,M> &b, T &s) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        s += sum(a*b);
+        unused(s);
+    }
+}
+
+
+template<typename T, size_t M>
+void run() {
+    Tensor<T,M> a, b, c;
+    a.fill(1); b.random(); c.fill(T(0.5));
+    T s = 0;
+
+    double time_assign, time_inplace, time_sum; uint64_t cycles;
+    std::tie(time_assign , cycles) = rtimeit(&iterate_assign<T,M>,std::ref(a),std::cref(b),std::cref(c));
+    a.fill(1);
+    std::tie(time_inplace, cycles) = rtimeit(&iterate_inplace<T,M>,std::ref(a),std::cref(c));
+    std::tie(time_sum    , cycles) = rtimeit(&iterate_sum<T,M>,std::cref(a),std::cref(b),std::ref(s));
+    unused(cycles,s);
+
+    // nanoseconds per call
+    println(M, 1e9*time_assign/NITER, 1e9*time_inplace/NITER, 1e9*time_sum/NITER);
+    print();
+}
+
+template<typename T, size_t ... Ms>
+void run_sizes(std::index_sequence<Ms...>) {
+    int dummy[] = {(run<T,Ms+1>(),0)...};
+    unused(dummy);
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Size, a = b*c + a, a *= sqrt(b), sum(a*b) [ns]: single precision")));
+    run_sizes<float>(std::make_index_sequence<64>{});
+    print(FBLU(BOLD("Size, a = b*c + a, a *= sqrt(b), sum(a*b) [ns]: double precision")));
+    run_sizes<double>(std::make_index_sequence<64>{});
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define NBATCH 256UL
+#define NITER 20UL
+
+
+// Batches of element matrices in double and single precision, see benchmark_svd for the layout
+template<typename T, size_t M, size_t K, size_t N>
+void iterate_matmul(Tensor<T,M,K> *a, Tensor<T,K,N> *b, Tensor<T,M,N> *c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            c[i] = matmul(a[i],b[i]);
+        }
+        unused(c);
+    }
+}
+
+template<size_t M, size_t K, size_t N>
+void iterate_matmul_mixed(Tensor<float,M,K> *a, Tensor<float,K,N> *b, Tensor<float,M,N> *c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            c[i] = matmul<double>(a[i],b[i]);
+        }
+        unused(c);
+    }
+}
+
+template<SolveCompType SType, typename T, size_t M, size_t N>
+void iterate_solve(Tensor<T,M,M> *a, Tensor<T,M,N> *b, Tensor<T,M,N> *x) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            x[i] = solve<SType>(a[i],b[i]);
+        }
+        unused(x);
+    }
+}
+
+
+template<typename T, typename U, size_t ... Rest>
+double relative_error(const Tensor<T,Rest...> *x, const Tensor<U,Rest...> *ref) {
+    double err = 0;
+    for (size_t i=0; i<NBATCH; ++i) {
+        err = std::max(err, double(norm(x[i].template cast<double>() - ref[i].template cast<double>())/norm(ref[i].template cast<double>())));
+    }
+    return err;
+}
+
+void report(const char* name, double time, uint64_t cycles, double time_ref, double error) {
+    println(name, FGRN(BOLD("speed-up over double")), time_ref/time,
+        FGRN(BOLD("[CPU cycles per instance]")), (double)cycles/(double)(NITER*NBATCH),
+        FGRN(BOLD("[relative error]")), error);
+    print();
+}
+
+
+template<size_t M, size_t K, size_t N>
+void run_matmul() {
+
+    static Tensor<double,M,K> ad[NBATCH]; static Tensor<double,K,N> bd[NBATCH]; static Tensor<double,M,N> cd[NBATCH];
+    static Tensor<float ,M,K> af[NBATCH]; static Tensor<float ,K,N> bf[NBATCH]; static Tensor<float ,M,N> cf[NBATCH];
+    for (size_t i=0; i<NBATCH; ++i) {
+        af[i].random(); af[i] -= 0.5f; ad[i] = af[i].template cast<double>();
+        bf[i].random(); bf[i] -= 0.5f; bd[i] = bf[i].template cast<double>();
+    }
+
+    double time_d, time_f, time_m;
+    uint64_t cycles_d, cycles_f, cycles_m;
+    std::tie(time_d, cycles_d) = rtimeit(&iterate_matmul<double,M,K,N>,ad,bd,cd);
+    std::tie(time_f, cycles_f) = rtimeit(&iterate_matmul<float,M,K,N>,af,bf,cf);
+    const double err_f = relative_error(cf,cd);
+    std::tie(time_m, cycles_m) = rtimeit(&iterate_matmul_mixed<M,K,N>,af,bf,cf);
+    const double err_m = relative_error(cf,cd);
+
+    println(FBLU(BOLD("matmul (M, K, N)")), M, K, N);
+    print();
+    report("double                    ", time_d, cycles_d, time_d, 0.);
+    report("float                     ", time_f, cycles_f, time_d, err_f);
+    report("float, double accumulators", time_m, cycles_m, time_d, err_m);
+    print();
+}
+
+
+template<size_t M, size_t N>
+void run_solve() {
+
+    static Tensor<double,M,M> ad[NBATCH]; static Tensor<double,M,N> bd[NBATCH], xd[NBATCH], xm[NBATCH];
+    static Tensor<float ,M,M> af[NBATCH]; static Tensor<float ,M,N> bf[NBATCH], xf[NBATCH];
+    for (size_t i=0; i<NBATCH; ++i) {
+        Tensor<double,M,M> a; a.random();
+        ad[i] = matmul(a,transpose(a));
+        for (size_t j=0; j<M; ++j) ad[i](j,j) += 1.;
+        bd[i].random();
+        af[i] = ad[i].template cast<float>();
+        bf[i] = bd[i].template cast<float>();
+    }
+
+    double time_d, time_f, time_m;
+    uint64_t cycles_d, cycles_f, cycles_m;
+
+    println(FBLU(BOLD("solve (M, N)")), M, N);
+    print();
+
+    std::tie(time_d, cycles_d) = rtimeit(&iterate_solve<SolveCompType::BlockLUPiv,double,M,N>,ad,bd,xd);
+    std::tie(time_f, cycles_f) = rtimeit(&iterate_solve<SolveCompType::BlockLUPiv,float,M,N>,af,bf,xf);
+    std::tie(time_m, cycles_m) = rtimeit(&iterate_solve<SolveCompType::MixedLU,double,M,N>,ad,bd,xm);
+    report("LU double         ", time_d, cycles_d, time_d, 0.);
+    report("LU float          ", time_f, cycles_f, time_d, relative_error(xf,xd));
+    report("LU mixed precision", time_m, cycles_m, time_d, relative_error(xm,xd));
+
+    std::tie(time_d, cycles_d) = rtimeit(&iterate_solve<SolveCompType::Chol,double,M,N>,ad,bd,xd);
+    std::tie(time_f, cycles_f) = rtimeit(&iterate_solve<SolveCompType::Chol,float,M,N>,af,bf,xf);
+    std::tie(time_m, cycles_m) = rtimeit(&iterate_solve<SolveCompType::MixedChol,double,M,N>,ad,bd,xm);
+    report("Cholesky double         ", time_d, cycles_d, time_d, 0.);
+    report("Cholesky float          ", time_f, cycles_f, time_d, relative_error(xf,xd));
+    report("Cholesky mixed precision", time_m, cycles_m, time_d, relative_error(xm,xd));
+    print();
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Running mixed precision benchmarks [float storage, double accumulation]")));
+    run_matmul<8,3,3>();
+    run_matmul<24,24,24>();
+    run_matmul<64,64,64>();
+
+    run_solve<24,1>();
+    run_solve<24,24>();
+    run_solve<64,8>();
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+// Large arrays well beyond the last level cache so that expressions are bound by memory
+// bandwidth. Fields are stored in float, float16 and bfloat16 with the arithmetic done in
+// float and indices are stored in 32, 16 and 8 bit integers
+#define N (1UL << 22)
+#define NITER 10UL
+
+
+template<typename T>
+void iterate_triad(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b, const DynamicTensor<T,1> &c, T s) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = b + s*c;
+        unused(a);
+    }
+}
+
+template<typename T>
+void iterate_shift(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b, const DynamicTensor<T,1> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = max(b - c, T(0));
+        unused(a);
+    }
+}
+
+template<typename T>
+void report(const char* name, double time, double time_ref) {
+    // three arrays are streamed through memory per iteration
+    const double gbytes = 3.*double(N*sizeof(T)*NITER)/1e9;
+    println(name, FGRN(BOLD("[GB/s]")), gbytes/time, FGRN(BOLD("[elements per ns]")), double(N*NITER)/time/1e9,
+        FGRN(BOLD("speed-up over 32 bit")), time_ref/time);
+    print();
+}
+
+
+template<typename T>
+double run_triad() {
+    DynamicTensor<T,1> a(N), b(N), c(N);
+    for (size_t i=0; i<N; ++i) {
+        b.data()[i] = T(float(i % 1000)*1e-3f);
+        c.data()[i] = T(float(i % 777)*1e-3f);
+    }
+    double time; uint64_t cycles;
+    std::tie(time, cycles) = rtimeit(&iterate_triad<T>,std::ref(a),std::cref(b),std::cref(c),T(0.5f));
+    unused(cycles);
+    return time;
+}
+
+template<typename T>
+double run_shift() {
+    DynamicTensor<T,1> a(N), b(N), c(N);
+    for (size_t i=0; i<N; ++i) {
+        b.data()[i] = T(i % 100);
+        c.data()[i] = T(i % 37);
+    }
+    double time; uint64_t cycles;
+    std::tie(time, cycles) = rtimeit(&iterate_shift<T>,std::ref(a),std::cref(b),std::cref(c));
+    unused(cycles);
+    return time;
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Streaming triad a = b + s*c on fields [float compute]")));
+    const double time_f   = run_triad<float>();
+    const double time_h   = run_triad<float16>();
+    const double time_b   = run_triad<bfloat16>();
+    report<float   >("float   ", time_f, time_f);
+    report<float16 >("float16 ", time_h, time_f);
+    report<bfloat16>("bfloat16", time_b, time_f);
+    print();
+
+    print(FBLU(BOLD("Streaming a = max(b - c, 0) on indices")));
+    const double time_32  = run_shift<int32_t>();
+    const double time_16  = run_shift<int16_t>();
+    const double time_8   = run_shift<int8_t>();
+    const double time_u8  = run_shift<uint8_t>();
+    report<int32_t>("int32_t ", time_32, time_32);
+    report<int16_t>("int16_t ", time_16, time_32);
+    report<int8_t >("int8_t  ", time_8 , time_32);
+    report<uint8_t>("uint8_t ", time_u8, time_32);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Build with either -DFASTOR_USE_THREADS or -DFASTOR_USE_OPENMP -fopenmp
+#include <Fastor/Fastor.h>
+#include <thread>
+using namespace Fastor;
+
+#define NITER 20UL
+
+
+template<typename T>
+void run_assign(DynamicTensor<T,2> &a, DynamicTensor<T,2> &b, DynamicTensor<T,2> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        c = a*b + sqrt(a) - b/3;
+        unused(c);
+    }
+}
+
+template<typename T>
+void run_assign_add(DynamicTensor<T,2> &a, DynamicTensor<T,2> &b, DynamicTensor<T,2> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        c += a*b;
+        unused(c);
+    }
+}
+
+template<typename T>
+void run_sum(DynamicTensor<T,2> &a, DynamicTensor<T,2> &b, DynamicTensor<T,2> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        c(0,0) = sum(a*b);
+        unused(c);
+    }
+}
+
+
+template<typename T>
+void run_scaling(size_t M, size_t N) {
+
+    DynamicTensor<T,2> a(M,N), b(M,N), c(M,N);
+    a.iota(1); b.fill(2); c.zeros();
+
+    const int max_threads = int(std::thread::hardware_concurrency()) > 0 ? int(std::thread::hardware_concurrency()) : 1;
+
+    println(FBLU(BOLD("Multithreaded evaluation of size (M, N)")), M, N);
+    print();
+    using func_t = void (*)(DynamicTensor<T,2>&, DynamicTensor<T,2>&, DynamicTensor<T,2>&);
+    const func_t funcs[3] = {&run_assign<T>, &run_assign_add<T>, &run_sum<T>};
+    const char *names[3] = {"c  = a*b + sqrt(a) - b/3", "c += a*b", "sum(a*b)"};
+
+    for (int f=0; f<3; ++f) {
+        print(names[f]);
+        double time_serial = 0.;
+        for (int nthreads=1; nthreads<=max_threads; ++nthreads) {
+            set_num_threads(nthreads);
+            double time;
+            uint64_t cycles;
+            std::tie(time,cycles) = rtimeit(funcs[f],a,b,c);
+            if (nthreads==1) time_serial = time;
+            println(FGRN(BOLD(" Threads")), nthreads, FGRN(BOLD("Elapsed time")), time/NITER,
+                FGRN(BOLD("Speed-up")), time_serial/time);
+            print();
+        }
+    }
+    set_num_threads(max_threads);
+    print();
+}
+
+int main() {
+
+    print(FBLU(BOLD("Running multithreaded expression benchmarks [Benchmarks scaling over the number of threads]")));
+    print("Single precision benchmark");
+    run_scaling<float>(1000,1000);
+    run_scaling<float>(4000,4000);
+    print("Double precision benchmark");
+    run_scaling<double>(1000,1000);
+    run_scaling<double>(4000,4000);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+#define NITER 100000000UL
+
+enum {i,j,k,l,m};
+
+// element-wise permutation walking the output contiguously
+template<typename T, size_t ... Rest, size_t ... Perm>
+inline void permute_scalar(const T *FASTOR_RESTRICT in, T *FASTOR_RESTRICT out, Index<Rest...>, Index<Perm...>) {
+    constexpr size_t dim = sizeof...(Rest);
+    constexpr size_t size = pack_prod<Rest...>::value;
+    constexpr std::array<size_t,dim> perm = {Perm...};
+    constexpr std::array<size_t,dim> dims_out = {get_value<Perm+1,Rest...>::value...};
+    constexpr std::array<size_t,dim> strides_in = nprods_views<Index<Rest...>,
+        typename std_ext::make_index_sequence<dim>::type>::values;
+
+    std::array<size_t,dim> as = {};
+    for (size_t counter=0; counter<size; ++counter) {
+        size_t index_in = 0;
+        for (size_t it=0; it<dim; ++it)
+            index_in += strides_in[perm[it]]*as[it];
+        out[counter] = in[index_in];
+        for (int jt=dim-1; jt>=0; --jt) {
+            if (++as[jt]<dims_out[jt]) break;
+            as[jt] = 0;
+        }
+    }
+}
+
+
+template<class Idx, typename T, size_t ... Rest>
+void iterate_over_scalar(const Tensor<T,Rest...> &a, T *FASTOR_RESTRICT out) {
+    using perm_type = typename permute_helper<Idx,Tensor<T,Rest...>>::resulting_index;
+    constexpr size_t niter = NITER / pack_prod<Rest...>::value;
+    for (size_t iter=0; iter<niter; ++iter) {
+        permute_scalar(a.data(),out,Index<Rest...>{},perm_type{});
+        unused(out);
+    }
+}
+
+template<class Idx, typename T, size_t ... Rest>
+void iterate_over_fastor(const Tensor<T,Rest...> &a, T *FASTOR_RESTRICT out) {
+    constexpr size_t niter = NITER / pack_prod<Rest...>::value;
+    for (size_t iter=0; iter<niter; ++iter) {
+        auto b = permute<Idx>(a);
+        std::copy(b.data(),b.data()+b.size(),out);
+        unused(out);
+    }
+}
+
+
+template<class Idx, typename T, size_t ... Rest>
+void run() {
+
+    constexpr size_t size = pack_prod<Rest...>::value;
+    Tensor<T,Rest...> a; a.iota(0);
+    T *out = static_cast<T*>(_mm_malloc(sizeof(T) * size, 64));
+
+    double time_scalar, time_fastor;
+    uint64_t cycles_scalar, cycles_fastor;
+
+    std::tie(time_scalar, cycles_scalar) = rtimeit(static_cast<void (*)(const Tensor<T,Rest...>&, T*)>(&iterate_over_scalar<Idx,T,Rest...>),a,out);
+    std::tie(time_fastor, cycles_fastor) = rtimeit(static_cast<void (*)(const Tensor<T,Rest...>&, T*)>(&iterate_over_fastor<Idx,T,Rest...>),a,out);
+
+    println(FGRN(BOLD("Speed-up over scalar code [elapsed time]")), time_scalar/time_fastor);
+    print();
+
+    _mm_free(out);
+}
+
+
+template<typename T>
+void run_all() {
+    // rank 3
+    run<Index<k,j,i>,T,16,16,16>();
+    run<Index<j,i,k>,T,16,16,16>();
+    run<Index<i,k,j>,T,32,32,32>();
+    run<Index<k,i,j>,T,30,40,50>();
+    // rank 4
+    run<Index<l,k,j,i>,T,16,16,16,16>();
+    run<Index<j,i,l,k>,T,16,16,16,16>();
+    run<Index<k,l,i,j>,T,12,14,16,18>();
+    run<Index<i,l,k,j>,T,12,14,16,18>();
+    // rank 5
+    run<Index<m,l,k,j,i>,T,8,8,8,8,8>();
+    run<Index<j,i,m,k,l>,T,8,8,8,8,8>();
+    run<Index<k,m,i,l,j>,T,5,6,9,10,11>();
+}
+
+int main() {
+
+    print(FBLU(BOLD("Running tensor permute benchmarks [Benchmarks blocked permutation]")));
+    print("Single precision benchmark");
+    run_all<float>();
+    print("Double precision benchmark");
+    run_all<double>();
+
+    return 0;
+}
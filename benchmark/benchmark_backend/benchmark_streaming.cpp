@@ -0,0 +1,91 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+// STREAM-like kernels written as Fastor expressions on arrays well beyond the last level
+// cache. Build with -DFASTOR_NO_STREAMING_STORES to compare against storing through the
+// caches. Bandwidth is counted as in STREAM, that is, without the read for ownership of the
+// output that regular stores incur
+#define N (1UL << 24)
+#define NITER 10UL
+
+
+template<typename T>
+void iterate_copy(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = b;
+        unused(a);
+    }
+}
+
+template<typename T>
+void iterate_scale(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b, T s) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = s*b;
+        unused(a);
+    }
+}
+
+template<typename T>
+void iterate_add(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b, const DynamicTensor<T,1> &c) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = b + c;
+        unused(a);
+    }
+}
+
+template<typename T>
+void iterate_triad(DynamicTensor<T,1> &a, const DynamicTensor<T,1> &b, const DynamicTensor<T,1> &c, T s) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = b + s*c;
+        unused(a);
+    }
+}
+
+template<typename T>
+void iterate_fill(DynamicTensor<T,1> &a, T s) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        a = s;
+        unused(a);
+    }
+}
+
+void report(const char* name, size_t narrays, size_t nbytes, double time) {
+    const double gbytes = double(narrays*N*nbytes*NITER)/1e9;
+    print(name, FGRN(BOLD("[GB/s]")), gbytes/time);
+}
+
+
+template<typename T>
+void run() {
+    DynamicTensor<T,1> a(N), b(N), c(N);
+    for (size_t i=0; i<N; ++i) {
+        a.data()[i] = T(0);
+        b.data()[i] = T(i % 1000)*T(1e-3);
+        c.data()[i] = T(i % 777)*T(1e-3);
+    }
+
+    double time; uint64_t cycles;
+    std::tie(time, cycles) = rtimeit(&iterate_copy<T>,std::ref(a),std::cref(b));
+    report("Copy  a = b      ", 2, sizeof(T), time);
+    std::tie(time, cycles) = rtimeit(&iterate_scale<T>,std::ref(a),std::cref(b),T(3));
+    report("Scale a = s*b    ", 2, sizeof(T), time);
+    std::tie(time, cycles) = rtimeit(&iterate_add<T>,std::ref(a),std::cref(b),std::cref(c));
+    report("Add   a = b + c  ", 3, sizeof(T), time);
+    std::tie(time, cycles) = rtimeit(&iterate_triad<T>,std::ref(a),std::cref(b),std::cref(c),T(3));
+    report("Triad a = b + s*c", 3, sizeof(T), time);
+    std::tie(time, cycles) = rtimeit(&iterate_fill<T>,std::ref(a),T(3));
+    report("Fill  a = s      ", 1, sizeof(T), time);
+    unused(cycles);
+    print();
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("STREAM-like kernels: single precision")));
+    run<float>();
+    print(FBLU(BOLD("STREAM-like kernels: double precision")));
+    run<double>();
+
+    return 0;
+}
@@ -0,0 +1,279 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define NBATCH 1024UL
+#define NITER 200UL
+
+
+// Scalar reference: textbook cyclic Jacobi with a convergence test [Numerical Recipes jacobi]
+template<typename T, size_t M>
+void reference_eigh(const T *FASTOR_RESTRICT A, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT V) {
+    T a[M*M];
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            a[i*M+j] = i >= j ? A[i*M+j] : A[j*M+i];
+            V[i*M+j] = i == j ? T(1) : T(0);
+        }
+    }
+    for (size_t sweep=0; sweep<50; ++sweep) {
+        T off = 0;
+        for (size_t p=0; p<M; ++p) for (size_t q=p+1; q<M; ++q) off += std::abs(a[p*M+q]);
+        if (off == T(0)) break;
+        for (size_t p=0; p<M; ++p) {
+            for (size_t q=p+1; q<M; ++q) {
+                if (a[p*M+q] == T(0)) continue;
+                const T theta = (a[q*M+q] - a[p*M+p]) / (2*a[p*M+q]);
+                T t = T(1) / (std::abs(theta) + std::sqrt(theta*theta + 1));
+                if (theta < 0) t = -t;
+                const T c = T(1) / std::sqrt(t*t + 1), s = t*c;
+                for (size_t k=0; k<M; ++k) {
+                    const T akp = a[k*M+p], akq = a[k*M+q];
+                    a[k*M+p] = c*akp - s*akq;
+                    a[k*M+q] = s*akp + c*akq;
+                }
+                for (size_t k=0; k<M; ++k) {
+                    const T apk = a[p*M+k], aqk = a[q*M+k];
+                    a[p*M+k] = c*apk - s*aqk;
+                    a[q*M+k] = s*apk + c*aqk;
+                }
+                for (size_t k=0; k<M; ++k) {
+                    const T vkp = V[k*M+p], vkq = V[k*M+q];
+                    V[k*M+p] = c*vkp - s*vkq;
+                    V[k*M+q] = s*vkp + c*vkq;
+                }
+            }
+        }
+    }
+    for (size_t i=0; i<M; ++i) w[i] = a[i*M+i];
+}
+
+// Scalar reference polar decomposition: F = R U with U = sqrt(F^T F) and R = F U^{-1}
+template<typename T, size_t M>
+void reference_polar(const T *FASTOR_RESTRICT F, T *FASTOR_RESTRICT R, T *FASTOR_RESTRICT U) {
+    T C[M*M], w[M], V[M*M], Uinv[M*M];
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            T acc = 0;
+            for (size_t k=0; k<M; ++k) acc += F[k*M+i]*F[k*M+j];
+            C[i*M+j] = acc;
+        }
+    }
+    reference_eigh<T,M>(C,w,V);
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            T u = 0, uinv = 0;
+            for (size_t k=0; k<M; ++k) {
+                u    += V[i*M+k]*std::sqrt(w[k])*V[j*M+k];
+                uinv += V[i*M+k]/std::sqrt(w[k])*V[j*M+k];
+            }
+            U[i*M+j] = u;
+            Uinv[i*M+j] = uinv;
+        }
+    }
+    _matmul<T,M,M,M>(F,Uinv,R);
+}
+
+
+template<typename T, size_t M>
+void iterate_reference_eigh(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            reference_eigh<T,M>(a+i*M*M,w+i*M,v+i*M*M);
+        }
+        unused(v);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_fastor_eigh(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            _eigh<T,M>(a+i*M*M,w+i*M,v+i*M*M);
+        }
+        unused(v);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_batch_eigh(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        batch_eigh<T,M>(a,w,v,NBATCH);
+        unused(v);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_reference_polar(T *FASTOR_RESTRICT f, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT u) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            reference_polar<T,M>(f+i*M*M,r+i*M*M,u+i*M*M);
+        }
+        unused(u);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_fastor_polar(T *FASTOR_RESTRICT f, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT u) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        for (size_t i=0; i<NBATCH; ++i) {
+            _polar<T,M>(f+i*M*M,r+i*M*M,u+i*M*M);
+        }
+        unused(u);
+    }
+}
+
+template<typename T, size_t M>
+void iterate_batch_polar(T *FASTOR_RESTRICT f, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT u) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        batch_polar<T,M>(f,r,u,NBATCH);
+        unused(u);
+    }
+}
+
+
+// Deformation gradients close to identity as at Gauss points of a finite element mesh
+template<typename T, size_t M>
+void make_deformation_gradients(Tensor<T,M,M> *F) {
+    for (size_t b=0; b<NBATCH; ++b) {
+        F[b].eye2();
+        for (size_t i=0; i<M; ++i) {
+            for (size_t j=0; j<M; ++j) {
+                F[b](i,j) += T(0.3)*T(std::sin(T(b*M*M + i*M + j)));
+            }
+        }
+    }
+}
+
+template<typename T>
+T* allocate(size_t size) {
+    T *a = static_cast<T*>(_mm_malloc(sizeof(T) * size, 64));
+    std::fill(a,a+size,T(0));
+    return a;
+}
+
+void report(const char* name, double time, uint64_t cycles, double time_ref, double error) {
+    println(name, FGRN(BOLD("speed-up over reference")), time_ref/time,
+        FGRN(BOLD("[CPU cycles per instance]")), (double)cycles/(double)(NITER*NBATCH),
+        FGRN(BOLD("[max residual]")), error);
+    print();
+}
+
+template<typename T, size_t M>
+void run_eigh() {
+
+    static Tensor<T,M,M> F[NBATCH], C[NBATCH], V[NBATCH];
+    static Tensor<T,M> w[NBATCH];
+    make_deformation_gradients(F);
+    for (size_t b=0; b<NBATCH; ++b) C[b] = matmul(transpose(F[b]),F[b]);
+
+    T *a  = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+    T *pw = allocate<T>(batch_storage_size<T,M>(NBATCH));
+    T *pv = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+
+    auto residual = [&]() {
+        double err = 0;
+        for (size_t b=0; b<NBATCH; ++b) {
+            Tensor<T,M,M> D(0);
+            for (size_t i=0; i<M; ++i) D(i,i) = w[b](i);
+            err = std::max(err, double(norm(matmul(C[b],V[b]) - matmul(V[b],D))));
+        }
+        return err;
+    };
+
+    double time_ref, time_fastor, time_batch;
+    uint64_t cycles_ref, cycles_fastor, cycles_batch;
+    double err_ref, err_fastor, err_batch;
+
+    batch_pack(C,a,NBATCH);
+    std::tie(time_batch, cycles_batch) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_batch_eigh<T,M>),a,pw,pv);
+    batch_unpack(pw,w,NBATCH);
+    batch_unpack(pv,V,NBATCH);
+    err_batch = residual();
+
+    for (size_t b=0; b<NBATCH; ++b) std::copy(C[b].data(),C[b].data()+M*M,a+b*M*M);
+    std::tie(time_ref, cycles_ref) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_reference_eigh<T,M>),a,pw,pv);
+    for (size_t b=0; b<NBATCH; ++b) { std::copy(pw+b*M,pw+(b+1)*M,w[b].data()); std::copy(pv+b*M*M,pv+(b+1)*M*M,V[b].data()); }
+    err_ref = residual();
+
+    std::tie(time_fastor, cycles_fastor) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_fastor_eigh<T,M>),a,pw,pv);
+    for (size_t b=0; b<NBATCH; ++b) { std::copy(pw+b*M,pw+(b+1)*M,w[b].data()); std::copy(pv+b*M*M,pv+(b+1)*M*M,V[b].data()); }
+    err_fastor = residual();
+
+    println(FBLU(BOLD("Symmetric eigen decomposition of size (M, M)")), M, M);
+    print();
+    report("Reference", time_ref, cycles_ref, time_ref, err_ref);
+    report("Fastor   ", time_fastor, cycles_fastor, time_ref, err_fastor);
+    report("Batched  ", time_batch, cycles_batch, time_ref, err_batch);
+
+    _mm_free(a);
+    _mm_free(pw);
+    _mm_free(pv);
+}
+
+template<typename T, size_t M>
+void run_polar() {
+
+    static Tensor<T,M,M> F[NBATCH], R[NBATCH], U[NBATCH];
+    make_deformation_gradients(F);
+
+    T *f  = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+    T *pr = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+    T *pu = allocate<T>(batch_storage_size<T,M,M>(NBATCH));
+
+    auto residual = [&]() {
+        double err = 0;
+        Tensor<T,M,M> I; I.eye2();
+        for (size_t b=0; b<NBATCH; ++b) {
+            err = std::max(err, double(norm(matmul(R[b],U[b]) - F[b])));
+            err = std::max(err, double(norm(matmul(transpose(R[b]),R[b]) - I)));
+        }
+        return err;
+    };
+
+    double time_ref, time_fastor, time_batch;
+    uint64_t cycles_ref, cycles_fastor, cycles_batch;
+    double err_ref, err_fastor, err_batch;
+
+    batch_pack(F,f,NBATCH);
+    std::tie(time_batch, cycles_batch) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_batch_polar<T,M>),f,pr,pu);
+    batch_unpack(pr,R,NBATCH);
+    batch_unpack(pu,U,NBATCH);
+    err_batch = residual();
+
+    for (size_t b=0; b<NBATCH; ++b) std::copy(F[b].data(),F[b].data()+M*M,f+b*M*M);
+    std::tie(time_ref, cycles_ref) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_reference_polar<T,M>),f,pr,pu);
+    for (size_t b=0; b<NBATCH; ++b) { std::copy(pr+b*M*M,pr+(b+1)*M*M,R[b].data()); std::copy(pu+b*M*M,pu+(b+1)*M*M,U[b].data()); }
+    err_ref = residual();
+
+    std::tie(time_fastor, cycles_fastor) = rtimeit(static_cast<void (*)(T*, T*, T*)>(&iterate_fastor_polar<T,M>),f,pr,pu);
+    for (size_t b=0; b<NBATCH; ++b) { std::copy(pr+b*M*M,pr+(b+1)*M*M,R[b].data()); std::copy(pu+b*M*M,pu+(b+1)*M*M,U[b].data()); }
+    err_fastor = residual();
+
+    println(FBLU(BOLD("Polar decomposition of size (M, M)")), M, M);
+    print();
+    report("Reference", time_ref, cycles_ref, time_ref, err_ref);
+    report("Fastor   ", time_fastor, cycles_fastor, time_ref, err_fastor);
+    report("Batched  ", time_batch, cycles_batch, time_ref, err_batch);
+
+    _mm_free(f);
+    _mm_free(pr);
+    _mm_free(pu);
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Running eigen/polar decomposition benchmarks [Benchmarks against a scalar Jacobi reference]")));
+    print("Single precision benchmark");
+    run_eigh<float,2>();
+    run_eigh<float,3>();
+    run_polar<float,2>();
+    run_polar<float,3>();
+    print("Double precision benchmark");
+    run_eigh<double,2>();
+    run_eigh<double,3>();
+    run_polar<double,2>();
+    run_polar<double,3>();
+
+    return 0;
+}
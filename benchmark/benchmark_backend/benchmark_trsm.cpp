@@ -0,0 +1,90 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+#define NITER 400000000UL
+
+// column at a time forward substitution with L non-unit lower triangular
+template<typename T, size_t M, size_t N>
+inline void trsm_scalar(const T *FASTOR_RESTRICT L, const T *FASTOR_RESTRICT B, T *FASTOR_RESTRICT X) {
+    for (size_t j=0; j<N; ++j) {
+        for (size_t i=0; i<M; ++i) {
+            T value = 0;
+            for (size_t k=0; k<i; ++k) {
+                value += L[i*M+k]*X[k*N+j];
+            }
+            X[i*N+j] = (B[i*N+j] - value) / L[i*M+i];
+        }
+    }
+}
+
+
+template<typename T, size_t M, size_t N>
+void iterate_over_scalar(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M,N> &X) {
+    constexpr size_t niter = NITER / (M*M*N) + 1;
+    for (size_t iter=0; iter<niter; ++iter) {
+        trsm_scalar<T,M,N>(L.data(),B.data(),X.data());
+        unused(X);
+    }
+}
+
+template<typename T, size_t M, size_t N>
+void iterate_over_fastor(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M,N> &X) {
+    constexpr size_t niter = NITER / (M*M*N) + 1;
+    for (size_t iter=0; iter<niter; ++iter) {
+        _trsm<T,M,N,UpLoType::Lower>(L.data(),B.data(),X.data());
+        unused(X);
+    }
+}
+
+
+template<typename T, size_t M, size_t N>
+void run() {
+
+    Tensor<T,M,M> L; L.random();
+    for (size_t i=0; i<M; ++i) L(i,i) += T(M);
+    Tensor<T,M,N> B; B.random();
+    Tensor<T,M,N> X;
+
+    double time_scalar, time_fastor;
+    uint64_t cycles_scalar, cycles_fastor;
+
+    std::tie(time_scalar, cycles_scalar) = rtimeit(static_cast<void (*)(const Tensor<T,M,M>&, const Tensor<T,M,N>&, Tensor<T,M,N>&)>(&iterate_over_scalar<T,M,N>),L,B,X);
+    std::tie(time_fastor, cycles_fastor) = rtimeit(static_cast<void (*)(const Tensor<T,M,M>&, const Tensor<T,M,N>&, Tensor<T,M,N>&)>(&iterate_over_fastor<T,M,N>),L,B,X);
+
+    print(M,N);
+    println(FGRN(BOLD("Speed-up over scalar code [elapsed time]")), time_scalar/time_fastor);
+    print();
+}
+
+
+template<typename T, size_t M>
+void run_rhs() {
+    run<T,M,1>();
+    run<T,M,4>();
+    run<T,M,8>();
+    run<T,M,16>();
+    run<T,M,33>();
+    run<T,M,64>();
+}
+
+template<typename T>
+void run_all() {
+    run_rhs<T,8>();
+    run_rhs<T,16>();
+    run_rhs<T,32>();
+    run_rhs<T,64>();
+    run_rhs<T,100>();
+    run_rhs<T,128>();
+}
+
+int main() {
+
+    print(FBLU(BOLD("Running triangular solve benchmarks [Benchmarks TRSM]")));
+    print("Single precision benchmark");
+    run_all<float>();
+    print("Double precision benchmark");
+    run_all<double>();
+
+    return 0;
+}
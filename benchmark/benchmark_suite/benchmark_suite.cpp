@@ -0,0 +1,265 @@
+#include <Fastor/Fastor.h>
+#include <Fastor/util/benchmark.h>
+using namespace Fastor;
+
+// Unified benchmark suite
+//
+// Runs the core kernels of Fastor and records the distribution of the run
+// times. Usage:
+//
+//      benchmark_suite [--json results.json] [--csv results.csv] [--filter name]
+//
+// where --filter only runs benchmarks whose name contains the given string
+
+
+static std::string bench_filter;
+
+inline bool selected(const std::string &name) {
+    return bench_filter.empty() || name.find(bench_filter) != std::string::npos;
+}
+
+template<typename T, typename ... Dims>
+inline std::string bench_name(const std::string &kernel, Dims ... dims) {
+    std::ostringstream os;
+    os << kernel << "<" << type_name<T>();
+    using expander = int[];
+    (void)expander{0, ((void)(os << "," << dims), 0)...};
+    os << ">";
+    return os.str();
+}
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void bench_matmul(bench_report &report) {
+    const std::string name = bench_name<T>("matmul",M,K,N);
+    if (!selected(name)) return;
+    Tensor<T,M,K> a; a.random();
+    Tensor<T,K,N> b; b.random();
+    Tensor<T,M,N> c;
+    report.add(benchit(name, 2.*M*K*N, [&]() {
+        c = matmul(a,b);
+        unused(a,b,c);
+    }));
+}
+
+// Matrices that do not fit on the stack. The built-in kernel is run through
+// the same dispatch as matmul and compared to the unblocked _matmul_base
+template<typename T, size_t M, size_t K, size_t N>
+void bench_matmul_large(bench_report &report) {
+    const std::string name = bench_name<T>("matmul",M,K,N);
+    const std::string name_base = bench_name<T>("matmul_unblocked",M,K,N);
+    if (!selected(name) && !selected(name_base)) return;
+    T *a = internal::aligned_allocate<T>(M*K);
+    T *b = internal::aligned_allocate<T>(K*N);
+    T *c = internal::aligned_allocate<T>(M*N);
+    for (size_t i=0; i<M*K; ++i) a[i] = T(rand()) / T(RAND_MAX);
+    for (size_t i=0; i<K*N; ++i) b[i] = T(rand()) / T(RAND_MAX);
+    if (selected(name)) {
+        report.add(benchit(name, 2.*M*K*N, [&]() {
+            _matmul<T,M,K,N>(a,b,c);
+            unused(c);
+        }));
+    }
+    if (selected(name_base)) {
+        report.add(benchit(name_base, 2.*M*K*N, [&]() {
+            internal::_matmul_base<T,M,K,N>(a,b,c);
+            unused(c);
+        }));
+    }
+    internal::aligned_free(a);
+    internal::aligned_free(b);
+    internal::aligned_free(c);
+}
+
+template<typename T, size_t M>
+void bench_lu(bench_report &report) {
+    const std::string name = bench_name<T>("lu",M,M);
+    if (!selected(name)) return;
+    Tensor<T,M,M> a; a.random();
+    for (size_t i=0; i<M; ++i) a(i,i) += T(M);
+    Tensor<T,M,M> l, u;
+    Tensor<size_t,M> p;
+    report.add(benchit(name, 2./3.*M*M*M, [&]() {
+        lu<LUCompType::BlockLUPiv>(a,l,u,p);
+        unused(a,l,u,p);
+    }));
+}
+
+template<typename T, size_t M>
+void bench_inverse(bench_report &report) {
+    const std::string name = bench_name<T>("inverse",M,M);
+    if (!selected(name)) return;
+    Tensor<T,M,M> a; a.random();
+    for (size_t i=0; i<M; ++i) a(i,i) += T(M);
+    Tensor<T,M,M> b;
+    report.add(benchit(name, 2.*M*M*M, [&]() {
+        b = inverse(a);
+        unused(a,b);
+    }));
+}
+
+template<typename T, size_t M, size_t N>
+void bench_transpose(bench_report &report) {
+    const std::string name = bench_name<T>("transpose",M,N);
+    if (!selected(name)) return;
+    Tensor<T,M,N> a; a.random();
+    Tensor<T,N,M> b;
+    report.add(benchit(name, [&]() {
+        b = transpose(a);
+        unused(a,b);
+    }));
+}
+
+template<typename T, size_t N>
+void bench_einsum(bench_report &report) {
+    enum {i,j,k,l};
+    {
+        // Double contraction of a fourth order tensor with a second order tensor
+        const std::string name = bench_name<T>("einsum_ijkl_kl",N,N,N,N);
+        if (selected(name)) {
+            Tensor<T,N,N,N,N> A; A.random();
+            Tensor<T,N,N> B; B.random();
+            Tensor<T,N,N> C;
+            report.add(benchit(name, 2.*N*N*N*N, [&]() {
+                C = einsum<Index<i,j,k,l>,Index<k,l>>(A,B);
+                unused(A,B,C);
+            }));
+        }
+    }
+    {
+        // Outer product of two second order tensors
+        const std::string name = bench_name<T>("einsum_ij_kl",N,N,N,N);
+        if (selected(name)) {
+            Tensor<T,N,N> A; A.random();
+            Tensor<T,N,N> B; B.random();
+            Tensor<T,N,N,N,N> C;
+            report.add(benchit(name, 1.*N*N*N*N, [&]() {
+                C = einsum<Index<i,j>,Index<k,l>>(A,B);
+                unused(A,B,C);
+            }));
+        }
+    }
+}
+
+template<typename T, size_t N>
+void bench_views(bench_report &report) {
+    constexpr size_t M = N/2;
+    {
+        const std::string name = bench_name<T>("view_seq_assign",N,N);
+        if (selected(name)) {
+            Tensor<T,N,N> a; a.random();
+            Tensor<T,M,M> b; b.random();
+            report.add(benchit(name, [&]() {
+                a(seq(0,M),seq(1,M+1)) = b;
+                unused(a,b);
+            }));
+        }
+    }
+    {
+        const std::string name = bench_name<T>("view_fseq_add_assign",N,N);
+        if (selected(name)) {
+            Tensor<T,N,N> a; a.random();
+            Tensor<T,M,M> b; b.random();
+            report.add(benchit(name, 2.*M*M, [&]() {
+                a(fseq<0,M>(),fseq<1,M+1>()) += 2*b;
+                unused(a,b);
+            }));
+        }
+    }
+    {
+        const std::string name = bench_name<T>("view_strided_assign",N,N);
+        if (selected(name)) {
+            Tensor<T,N,N> a; a.random();
+            Tensor<T,M,M> b; b.random();
+            report.add(benchit(name, [&]() {
+                a(seq(0,last,2),seq(0,last,2)) = b;
+                unused(a,b);
+            }));
+        }
+    }
+    {
+        const std::string name = bench_name<T>("view_index_add_assign",N*N);
+        if (selected(name)) {
+            Tensor<T,N*N> a; a.random();
+            Tensor<T,M*M> b; b.random();
+            Tensor<int,M*M> it; it.iota(int(N));
+            report.add(benchit(name, 2.*M*M, [&]() {
+                a(it) += 2*b;
+                unused(a,b);
+            }));
+        }
+    }
+}
+
+
+template<typename T>
+void run(bench_report &report) {
+    bench_matmul<T,4,4,4>(report);
+    bench_matmul<T,8,8,8>(report);
+    bench_matmul<T,16,16,16>(report);
+    bench_matmul<T,32,32,32>(report);
+    bench_matmul<T,64,64,64>(report);
+    bench_matmul<T,19,17,7>(report);
+    bench_matmul_large<T,128,128,128>(report);
+    bench_matmul_large<T,256,256,256>(report);
+    bench_matmul_large<T,512,512,512>(report);
+    bench_matmul_large<T,1024,1024,1024>(report);
+    bench_matmul_large<T,67,129,93>(report);
+
+    bench_lu<T,4>(report);
+    bench_lu<T,8>(report);
+    bench_lu<T,16>(report);
+    bench_lu<T,32>(report);
+
+    bench_inverse<T,2>(report);
+    bench_inverse<T,3>(report);
+    bench_inverse<T,4>(report);
+    bench_inverse<T,8>(report);
+    bench_inverse<T,16>(report);
+
+    bench_transpose<T,4,4>(report);
+    bench_transpose<T,8,8>(report);
+    bench_transpose<T,16,16>(report);
+    bench_transpose<T,32,32>(report);
+    bench_transpose<T,17,13>(report);
+
+    bench_einsum<T,3>(report);
+    bench_einsum<T,6>(report);
+
+    bench_views<T,16>(report);
+    bench_views<T,64>(report);
+}
+
+
+int main(int argc, char *argv[]) {
+
+    std::string json_file, csv_file;
+    for (int arg=1; arg<argc; ++arg) {
+        const std::string option(argv[arg]);
+        if (option == "--json" && arg+1 < argc) json_file = argv[++arg];
+        else if (option == "--csv" && arg+1 < argc) csv_file = argv[++arg];
+        else if (option == "--filter" && arg+1 < argc) bench_filter = argv[++arg];
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--json file] [--csv file] [--filter name]" << std::endl;
+            return 1;
+        }
+    }
+
+    bench_report report;
+
+    print(FBLU(BOLD("Running benchmarks for single precision")));
+    run<float>(report);
+    print(FBLU(BOLD("Running benchmarks for double precision")));
+    run<double>(report);
+
+    if (!json_file.empty() && !report.write(json_file)) {
+        std::cerr << "Could not write " << json_file << std::endl;
+        return 1;
+    }
+    if (!csv_file.empty() && !report.write(csv_file)) {
+        std::cerr << "Could not write " << csv_file << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
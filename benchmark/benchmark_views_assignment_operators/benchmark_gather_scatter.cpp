@@ -0,0 +1,107 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+// Non-contiguous views read with gather instructions or lane by lane,
+// compile with and without FASTOR_NO_HARDWARE_GATHER to compare
+
+template<typename T>
+void run() {
+    timer<double> time_;
+
+    print(FBLU(BOLD("RANDOM VIEWS [MESH CONNECTIVITY]")));
+    {
+        constexpr int NITER = 1000000;
+        constexpr size_t N = 1000, M = 256;
+        Tensor<T,N> a; a.random();
+        Tensor<T,M> b; b.random();
+        Tensor<int,M> it;
+        for (size_t i=0; i<M; ++i) it(i) = (int)((i*389) % N);
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            Tensor<T,M> c = a(it);
+            unused(c);
+        }
+        time_.toc("Constructing from a view");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            Tensor<T,M> c = 2*a(it) + b;
+            unused(c);
+        }
+        time_.toc("Expression of a view");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            a(it) = b;
+            unused(a);
+        }
+        time_.toc("Assigning to a view");
+    }
+
+    print(FBLU(BOLD("STRIDED 1D VIEWS")));
+    {
+        constexpr int NITER = 1000000;
+        constexpr size_t N = 768, M = 256;
+        Tensor<T,N> a; a.random();
+        Tensor<T,M> b; b.random();
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            Tensor<T,M> c = a(seq(0,N,3));
+            unused(c);
+        }
+        time_.toc("Constructing from a view");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            a(seq(1,N,3)) = b;
+            unused(a);
+        }
+        time_.toc("Assigning to a view");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            a(fseq<2,N,3>()) += b;
+            unused(a);
+        }
+        time_.toc("+= Assigning to a fixed view");
+    }
+
+    print(FBLU(BOLD("STRIDED 2D VIEWS")));
+    {
+        constexpr int NITER = 100000;
+        constexpr size_t M = 64, N = 96;
+        Tensor<T,M,N> a; a.random();
+        Tensor<T,M/2,N/3> b; b.random();
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            Tensor<T,M/2,N/3> c = a(seq(0,M,2),seq(0,N,3));
+            unused(c);
+        }
+        time_.toc("Constructing from a view");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            a(seq(1,M,2),seq(1,N,3)) += b;
+            unused(a);
+        }
+        time_.toc("+= Assigning to a view");
+    }
+}
+
+int main() {
+
+#ifdef FASTOR_NO_HARDWARE_GATHER
+    print(FBLU(BOLD("Benchmarking non-contiguous views: lane by lane")));
+#else
+    print(FBLU(BOLD("Benchmarking non-contiguous views: gather instructions")));
+#endif
+    print(FBLU(BOLD("Single precision")));
+    run<float>();
+    print(FBLU(BOLD("Double precision")));
+    run<double>();
+
+    return 0;
+}
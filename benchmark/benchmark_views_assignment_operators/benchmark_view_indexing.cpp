@@ -0,0 +1,62 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+// Evaluating dynamic views by flat index, as reductions and flattened expressions do. The
+// sequences are only known at runtime here, otherwise the compiler folds the index
+// computation and the cost of recovering the multi-dimensional index disappears
+
+
+template<typename T>
+void run(int first, int step) {
+    timer<double> time_;
+    constexpr int NITER = 200000;
+    T s = 0;
+
+    print(FBLU(BOLD("2D VIEWS")));
+    {
+        Tensor<T,64,99> a; a.random();
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            s += sum(a(seq(first,64,step),seq(0,99,step+1)));
+        }
+        time_.toc("Strided columns");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            s += sum(a(seq(first,64,step),seq(0,99)));
+        }
+        time_.toc("Contiguous columns");
+    }
+
+    print(FBLU(BOLD("4D VIEWS")));
+    {
+        Tensor<T,8,9,10,11> a; a.random();
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            s += sum(a(seq(0,8,step),seq(0,9),seq(first,10),seq(0,11,step)));
+        }
+        time_.toc("Strided last dimension");
+
+        time_.tic();
+        for (auto i=0; i<NITER; ++i) {
+            s += sum(a(seq(0,8,step),seq(0,9),seq(first,10),seq(0,11)));
+        }
+        time_.toc("Contiguous last dimension");
+    }
+    unused(s);
+}
+
+int main(int argc, char *argv[]) {
+
+    const int first = argc > 1 ? std::atoi(argv[1]) : 1;
+    const int step  = argc > 2 ? std::atoi(argv[2]) : 2;
+
+    print(FBLU(BOLD("Benchmarking index computation of dynamic views: single precision")));
+    run<float>(first,step);
+    print(FBLU(BOLD("Benchmarking index computation of dynamic views: double precision")));
+    run<double>(first,step);
+
+    return 0;
+}
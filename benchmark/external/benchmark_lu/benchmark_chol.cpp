@@ -0,0 +1,89 @@
+#include "../benchmarks_general.h"
+
+#include <Fastor/Fastor.h>
+#include <Eigen/Core>
+#include <Eigen/Dense>
+
+template<typename T, size_t M>
+void benchmark_chol_eigen() {
+    using namespace Eigen;
+    Matrix<T,M,M,RowMajor> a;
+    std::iota(a.data(),a.data()+M*M,0);
+    a = (a + a.transpose()).eval();
+    for (size_t i=0; i<M; ++i) a(i,i) = 100*M + i;
+    Matrix<T,M,1> b;
+    std::iota(b.data(),b.data()+M,0);
+    Matrix<T,M,1> x = a.llt().solve(b);
+    benchmarks_general::unused(x);
+}
+
+template<typename T, size_t M>
+void benchmark_chol_fastor() {
+    using namespace Fastor;
+    Tensor<T,M,M> a;
+    std::iota(a.data(),a.data()+M*M,0);
+    a = a + transpose(a);
+    for (size_t i=0; i<M; ++i) a(i,i) = 100*M + i;
+    Tensor<T,M> b;
+    b.iota(0);
+    Tensor<T,M> x = solve<SolveCompType::Chol>(a,b);
+    benchmarks_general::unused(x);
+}
+
+template<typename T, size_t M>
+void benchmark_lu_fastor() {
+    using namespace Fastor;
+    Tensor<T,M,M> a;
+    std::iota(a.data(),a.data()+M*M,0);
+    a = a + transpose(a);
+    for (size_t i=0; i<M; ++i) a(i,i) = 100*M + i;
+    Tensor<T,M> b;
+    b.iota(0);
+    Tensor<T,M> x = solve<SolveCompType::BlockLUPiv>(a,b);
+    benchmarks_general::unused(x);
+}
+
+
+
+template<typename T, size_t M>
+void benchmark_run() {
+
+    using benchmarks_general::println;
+    using benchmarks_general::rtimeit;
+
+    println("Testing size (M, N)", M, M,'\n');
+
+    double etime = rtimeit(static_cast<void (*)()>(&benchmark_chol_eigen<T,M>));
+    double ftime = rtimeit(static_cast<void (*)()>(&benchmark_chol_fastor<T,M>));
+    double ltime = rtimeit(static_cast<void (*)()>(&benchmark_lu_fastor<T,M>));
+
+    println("Elapsed time -> Eigen LLT, Fastor Chol, Fastor BlockLUPiv\n", etime, ftime, ltime,'\n');
+}
+
+template<size_t step, size_t from, size_t to>
+struct benchmark_generate {
+    template<typename T>
+    static inline void generate() {
+        benchmark_run<T,from>();
+        benchmark_generate<step,from+step,to>::template generate<T>();
+    }
+};
+template<size_t step, size_t from>
+struct benchmark_generate<step,from,from> {
+    template<typename T>
+    static inline void generate() {
+        benchmark_run<T,from>();
+    }
+};
+
+
+int main () {
+
+#ifdef RUN_SINGLE
+    benchmark_generate<2,2,32>::template generate<float>();
+#else
+    benchmark_generate<2,2,32>::template generate<double>();
+#endif
+
+    return 0;
+}
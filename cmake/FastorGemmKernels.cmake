@@ -0,0 +1,62 @@
+# Exact-shape GEMM kernels generated at build time
+#
+#   fastor_generate_gemm_kernels(<target>
+#       [TYPES float double ...]
+#       [ABIS avx512 avx sse neon ...]
+#       SHAPES MxKxN ...)
+#
+# Builds tools/gemm_codegen, generates register-blocked kernels for the given matrix shapes
+# and makes _matmul in <target> use them, for instance
+#
+#   fastor_generate_gemm_kernels(my_fem_solver TYPES double SHAPES 8x3x3 20x3x3 27x3x9)
+#
+# The header ends up in the build tree, kernels are generated for double precision and all
+# instruction sets unless TYPES and ABIS say otherwise. When cross compiling the generator has
+# to run on the host, point FASTOR_GEMM_CODEGEN_EXECUTABLE to a host build of it
+
+set(FASTOR_GEMM_CODEGEN_SOURCE "${CMAKE_CURRENT_LIST_DIR}/../tools/gemm_codegen/gemm_codegen.cpp")
+if(NOT EXISTS "${FASTOR_GEMM_CODEGEN_SOURCE}")
+    # installed next to this file
+    set(FASTOR_GEMM_CODEGEN_SOURCE "${CMAKE_CURRENT_LIST_DIR}/gemm_codegen.cpp")
+endif()
+get_filename_component(FASTOR_GEMM_CODEGEN_SOURCE "${FASTOR_GEMM_CODEGEN_SOURCE}" ABSOLUTE)
+
+set(FASTOR_GEMM_CODEGEN_EXECUTABLE "" CACHE FILEPATH "Host build of the Fastor GEMM kernel generator")
+
+function(fastor_generate_gemm_kernels target)
+    cmake_parse_arguments(ARG "" "" "TYPES;ABIS;SHAPES" ${ARGN})
+    if(NOT ARG_SHAPES)
+        message(FATAL_ERROR "fastor_generate_gemm_kernels: no SHAPES given for ${target}")
+    endif()
+
+    if(FASTOR_GEMM_CODEGEN_EXECUTABLE)
+        set(codegen "${FASTOR_GEMM_CODEGEN_EXECUTABLE}")
+    else()
+        if(NOT TARGET fastor_gemm_codegen)
+            add_executable(fastor_gemm_codegen "${FASTOR_GEMM_CODEGEN_SOURCE}")
+            set_target_properties(fastor_gemm_codegen PROPERTIES CXX_STANDARD 14 CXX_STANDARD_REQUIRED ON)
+        endif()
+        set(codegen $<TARGET_FILE:fastor_gemm_codegen>)
+    endif()
+
+    set(args "")
+    foreach(type ${ARG_TYPES})
+        list(APPEND args -t ${type})
+    endforeach()
+    foreach(abi ${ARG_ABIS})
+        list(APPEND args -a ${abi})
+    endforeach()
+
+    set(header "${CMAKE_CURRENT_BINARY_DIR}/fastor_gemm_kernels/${target}_gemm_kernels.h")
+    add_custom_command(
+        OUTPUT "${header}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${CMAKE_CURRENT_BINARY_DIR}/fastor_gemm_kernels"
+        COMMAND ${codegen} -o "${header}" ${args} ${ARG_SHAPES}
+        DEPENDS ${codegen}
+        COMMENT "Generating Fastor GEMM kernels for ${target}"
+        VERBATIM)
+    add_custom_target(${target}_gemm_kernels DEPENDS "${header}")
+    add_dependencies(${target} ${target}_gemm_kernels)
+
+    target_compile_definitions(${target} PRIVATE "FASTOR_GEMM_KERNELS_HEADER=\"${header}\"")
+endfunction()
@@ -0,0 +1,25 @@
+# Cross compile for AArch64 [NEON] and run the tests under qemu-user
+#
+#   cmake -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/aarch64-linux-gnu.cmake ..
+#
+# Needs g++-aarch64-linux-gnu and qemu-user [qemu-user-static on Debian/Ubuntu]
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(FASTOR_CROSS_TRIPLE aarch64-linux-gnu)
+set(CMAKE_C_COMPILER   ${FASTOR_CROSS_TRIPLE}-gcc)
+set(CMAKE_CXX_COMPILER ${FASTOR_CROSS_TRIPLE}-g++)
+
+set(CMAKE_FIND_ROOT_PATH /usr/${FASTOR_CROSS_TRIPLE})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+# -march=native is meaningless when cross compiling
+set(CMAKE_CXX_FLAGS_INIT "-march=armv8-a")
+
+# Used by ctest for tests added with add_test(NAME ... COMMAND <target>).
+# Tests added with the short add_test(<name> <target>) form rely on binfmt_misc
+# which qemu-user-static registers
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -L /usr/${FASTOR_CROSS_TRIPLE})
@@ -0,0 +1,122 @@
+#include <Fastor/Fastor.h>
+#include <vector>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+void fill_batch(Tensor<T,M,M> *a, size_t nbatch) {
+    for (size_t b=0; b<nbatch; ++b) {
+        a[b].iota(b+1);
+        for (size_t i=0; i<M; ++i) a[b](i,i) = 100 + T(b);
+    }
+}
+
+template<typename T, size_t M, size_t K, size_t N, size_t nbatch>
+void test_batch_matmul() {
+    Tensor<T,M,K> a[nbatch];
+    Tensor<T,K,N> b[nbatch];
+    Tensor<T,M,N> c[nbatch];
+    for (size_t i=0; i<nbatch; ++i) {
+        a[i].iota(i);
+        b[i].iota(2*i+1);
+    }
+
+    std::vector<T> pa(batch_storage_size<T,M,K>(nbatch));
+    std::vector<T> pb(batch_storage_size<T,K,N>(nbatch));
+    std::vector<T> pc(batch_storage_size<T,M,N>(nbatch));
+    batch_pack(a,pa.data(),nbatch);
+    batch_pack(b,pb.data(),nbatch);
+    batch_matmul<T,M,K,N>(pa.data(),pb.data(),pc.data(),nbatch);
+    batch_unpack(pc.data(),c,nbatch);
+
+    for (size_t i=0; i<nbatch; ++i) {
+        Tensor<T,M,N> exact = matmul(a[i],b[i]);
+        FASTOR_EXIT_ASSERT(std::abs(sum(c[i]) - sum(exact)) < HugeTol);
+        FASTOR_EXIT_ASSERT(std::abs(norm(c[i]) - norm(exact)) < HugeTol);
+    }
+}
+
+template<typename T, size_t M, size_t nbatch>
+void test_batch_linalg() {
+    Tensor<T,M,M> a[nbatch], inv_a[nbatch];
+    fill_batch(a,nbatch);
+
+    std::vector<T> pa(batch_storage_size<T,M,M>(nbatch));
+    std::vector<T> pinv(batch_storage_size<T,M,M>(nbatch));
+    std::vector<T> pdet(batch_storage_size<T>(nbatch));
+    batch_pack(a,pa.data(),nbatch);
+    batch_determinant<T,M>(pa.data(),pdet.data(),nbatch);
+    batch_inverse<T,M>(pa.data(),pinv.data(),nbatch);
+    batch_unpack(pinv.data(),inv_a,nbatch);
+
+    for (size_t i=0; i<nbatch; ++i) {
+        T exact = determinant<DetCompType::LU>(a[i]);
+        FASTOR_EXIT_ASSERT(std::abs(pdet[i] - exact) < BigTol*std::abs(exact));
+        Tensor<T,M,M> I = matmul(a[i],inv_a[i]);
+        for (size_t j=0; j<M; ++j) {
+            for (size_t k=0; k<M; ++k) {
+                FASTOR_EXIT_ASSERT(std::abs(I(j,k) - (j==k ? 1 : 0)) < BigTol);
+            }
+        }
+    }
+}
+
+template<typename T>
+void test_batch() {
+
+    // layout
+    {
+        constexpr size_t W = batch_width<T>();
+        constexpr size_t nbatch = 2*W+1;
+        Tensor<T,2,3> a[nbatch], b[nbatch];
+        for (size_t i=0; i<nbatch; ++i) a[i].iota(10*i);
+        std::vector<T> pa(batch_storage_size<T,2,3>(nbatch));
+        FASTOR_EXIT_ASSERT(pa.size() == 3*W*6);
+        batch_pack(a,pa.data(),nbatch);
+        // entry (b,i,j) lives at ((b/W)*M*N + i*N + j)*W + b%W
+        FASTOR_EXIT_ASSERT(std::abs(pa[((W+1)/W*6 + 1*3 + 2)*W + (W+1)%W] - a[W+1](1,2)) < Tol);
+        // padding lanes replicate the last instance
+        FASTOR_EXIT_ASSERT(std::abs(pa[(2*6 + 5)*W + W-1] - a[nbatch-1](1,2)) < Tol);
+        batch_unpack(pa.data(),b,nbatch);
+        for (size_t i=0; i<nbatch; ++i) {
+            FASTOR_EXIT_ASSERT(std::abs(sum(a[i]-b[i])) < Tol);
+        }
+    }
+
+    // matmul
+    {
+        test_batch_matmul<T,2,2,2,1>();
+        test_batch_matmul<T,3,3,3,13>();
+        test_batch_matmul<T,2,3,4,17>();
+        test_batch_matmul<T,6,6,6,9>();
+        test_batch_matmul<T,9,9,9,21>();
+        test_batch_matmul<T,6,3,1,5>();
+    }
+
+    // determinant and inverse
+    {
+        test_batch_linalg<T,2,13>();
+        test_batch_linalg<T,3,13>();
+        test_batch_linalg<T,4,7>();
+        test_batch_linalg<T,6,11>();
+        test_batch_linalg<T,9,5>();
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing batched small matrix operations: single precision")));
+    test_batch<float>();
+    print(FBLU(BOLD("Testing batched small matrix operations: double precision")));
+    test_batch<double>();
+
+    return 0;
+}
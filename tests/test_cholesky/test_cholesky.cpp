@@ -0,0 +1,115 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+// Symmetric positive definite matrix A = B * B^T + M * I
+template<typename T, size_t M>
+Tensor<T,M,M> make_spd() {
+    Tensor<T,M,M> B;
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            B(i,j) = T(std::sin(T(i + 2*j + 1)));
+        }
+    }
+    Tensor<T,M,M> A = matmul(B,transpose(B));
+    for (size_t i=0; i<M; ++i) A(i,i) += T(M);
+    return A;
+}
+
+template<typename T, size_t M>
+void test_cholesky_size() {
+
+    const T tol = sizeof(T) == 4 ? T(HugeTol) : T(BigTol);
+    Tensor<T,M,M> A = make_spd<T,M>();
+    Tensor<T,M,M> I; I.eye2();
+
+    // factorisation
+    Tensor<T,M,M> L;
+    cholesky(A, L);
+    FASTOR_EXIT_ASSERT(norm(matmul(L,transpose(L)) - A) < tol * norm(A));
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(L(i,i) > 0);
+        for (size_t j=i+1; j<M; ++j) {
+            FASTOR_EXIT_ASSERT(std::abs(L(i,j)) < Tol);
+        }
+    }
+
+    // expressions and the returning overload
+    Tensor<T,M,M> L1 = cholesky(A + 0);
+    Tensor<T,M,M> L2 = cholesky(A);
+    FASTOR_EXIT_ASSERT(norm(L1 - L) < tol * norm(L));
+    FASTOR_EXIT_ASSERT(norm(L2 - L) < tol * norm(L));
+
+    // solve - single and multiple right hand sides
+    Tensor<T,M> b; b.iota(1);
+    Tensor<T,M,3> B; B.iota(1);
+    Tensor<T,M> x = solve<SolveCompType::Chol>(A,b);
+    Tensor<T,M,3> X = solve<SolveCompType::Chol>(A,B);
+    FASTOR_EXIT_ASSERT(norm(matmul(A,x) - b) < tol * norm(b));
+    FASTOR_EXIT_ASSERT(norm(matmul(A,X) - B) < tol * norm(B));
+    Tensor<T,M> x1 = solve<SolveCompType::Chol>(A+0,b+0);
+    FASTOR_EXIT_ASSERT(norm(x1 - x) < tol * norm(x));
+
+    // inverse
+    Tensor<T,M,M> invA = inverse<InvCompType::Chol>(A);
+    FASTOR_EXIT_ASSERT(norm(matmul(invA,A) - I) < tol * T(M));
+    Tensor<T,M,M> invA1 = inverse<InvCompType::Chol>(A+0);
+    FASTOR_EXIT_ASSERT(norm(invA1 - invA) < tol * norm(invA));
+
+    // determinant
+    const T detA = determinant<DetCompType::Chol>(A);
+    const T detA_lu = determinant<DetCompType::LU>(A);
+    FASTOR_EXIT_ASSERT(detA > 0);
+    FASTOR_EXIT_ASSERT(std::abs(detA - detA_lu) < tol * std::abs(detA_lu));
+    FASTOR_EXIT_ASSERT(std::abs(determinant<DetCompType::Chol>(A+0) - detA) < tol * detA);
+}
+
+template<typename T>
+void test_cholesky() {
+
+    // unrolled kernels
+    test_cholesky_size<T,1>();
+    test_cholesky_size<T,2>();
+    test_cholesky_size<T,3>();
+    test_cholesky_size<T,4>();
+    test_cholesky_size<T,5>();
+    test_cholesky_size<T,6>();
+    test_cholesky_size<T,7>();
+    test_cholesky_size<T,8>();
+
+    // blocked kernels
+    test_cholesky_size<T,9>();
+    test_cholesky_size<T,16>();
+    test_cholesky_size<T,17>();
+
+    // known values
+    {
+        Tensor<T,3,3> A = {{4,12,-16},{12,37,-43},{-16,-43,98}};
+        Tensor<T,3,3> L = cholesky(A);
+        FASTOR_EXIT_ASSERT(std::abs(L(0,0) - 2) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(L(1,0) - 6) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(L(1,1) - 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(L(2,0) + 8) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(L(2,1) - 5) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(L(2,2) - 3) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(determinant<DetCompType::Chol>(A) - 36) < BigTol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing Cholesky factorisation: single precision")));
+    test_cholesky<float>();
+    print(FBLU(BOLD("Testing Cholesky factorisation: double precision")));
+    test_cholesky<double>();
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+// Count the products that are actually computed for one shape
+static size_t matmul_count = 0;
+
+namespace Fastor {
+namespace internal {
+template<>
+FASTOR_INLINE void matmul_dispatcher<double,3,5,4>(const Tensor<double,3,5> &a, const Tensor<double,5,4> &b, Tensor<double,3,4> &out) {
+    ++matmul_count;
+    _matmul<double,3,5,4>(a.data(),b.data(),out.data());
+}
+} // internal
+} // Fastor
+
+
+template<typename T>
+void run() {
+
+    using std::abs;
+
+    Tensor<T,3,5> A; A.iota(1); A /= 10;
+    Tensor<T,3,5> A2; A2.iota(2); A2 /= 20;
+    Tensor<T,5,4> B; B.iota(3); B /= 30;
+    Tensor<T,3,3> F; F.iota(1); F /= 10; F(0,0) += 1; F(2,2) += 2;
+
+    matmul_count = 0;
+    const Tensor<T,3,4> AB = A % B;
+    const Tensor<T,3,4> A2B = A2 % B;
+    const Tensor<T,3,3> invF = inv(F);
+    FASTOR_EXIT_ASSERT(matmul_count == 2);
+
+    static_assert(has_common_subexpression_v<decltype(A%B + A%B)>, "EXPRESSION HAS A REPEATED PRODUCT");
+    static_assert(has_common_subexpression_v<decltype(inv(F)%AB - 2*inv(F)%AB)>, "EXPRESSION HAS A REPEATED INVERSE");
+    static_assert(!has_common_subexpression_v<decltype(A%B + 2*AB)>, "EXPRESSION HAS NO REPEATED NODES");
+
+    // repeated products are computed once
+    {
+        matmul_count = 0;
+        Tensor<T,3,4> C = A%B + A%B;
+        FASTOR_EXIT_ASSERT(max(abs(C - 2*AB)) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        C = (A%B)*(A%B) - 2*(A%B);
+        FASTOR_EXIT_ASSERT(max(abs(C - (AB*AB - 2*AB))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        C += A%B / (A%B + 1);
+        FASTOR_EXIT_ASSERT(max(abs(C - (AB*AB - 2*AB + AB / (AB + 1)))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        C -= sqrt(A%B) + sqrt(A%B);
+        FASTOR_EXIT_ASSERT(max(abs(C - (AB*AB - 2*AB + AB / (AB + 1) - 2*sqrt(AB)))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+    }
+
+    // nodes of the same type on different operands are still computed separately
+    {
+        matmul_count = 0;
+        Tensor<T,3,4> C = A%B + A2%B + A%B;
+        FASTOR_EXIT_ASSERT(max(abs(C - (2*AB + A2B))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 2);
+
+        matmul_count = 0;
+        C = (A%B)*3 + (A%B)*2;
+        FASTOR_EXIT_ASSERT(max(abs(C - 5*AB)) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        C = (3*A)%B + (2*A)%B;
+        FASTOR_EXIT_ASSERT(max(abs(C - 5*AB)) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 2);
+    }
+
+    // nested repeated nodes and products at the root
+    {
+        matmul_count = 0;
+        Tensor<T,3,4> C = inv(F)%(A%B) + inv(F)%(A%B);
+        FASTOR_EXIT_ASSERT(max(abs(C - 2*matmul(invF,AB))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        Tensor<T,4,4> D = trans(A%B) % (A%B);
+        FASTOR_EXIT_ASSERT(max(abs(D - matmul(transpose(AB),AB))) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        Tensor<T,3,3> G = inv(F) % trans(inv(F)) - 2*inv(F);
+        FASTOR_EXIT_ASSERT(max(abs(G - (matmul(invF,transpose(invF)) - 2*invF))) < BigTol);
+
+        // destination aliases the operands
+        Tensor<T,3,3> H = F;
+        H = inv(H) % H + inv(H);
+        FASTOR_EXIT_ASSERT(max(abs(H - (matmul(invF,F) + invF))) < BigTol);
+    }
+
+    // views are compared by identity
+    {
+        Tensor<T,4,5> E; E.zeros(); E(fseq<1,4>(),fall) = A;
+
+        matmul_count = 0;
+        auto v = E(fseq<1,4>(),fall);
+        Tensor<T,3,4> C = v%B + v%B;
+        FASTOR_EXIT_ASSERT(max(abs(C - 2*AB)) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 1);
+
+        matmul_count = 0;
+        C = E(fseq<1,4>(),fall)%B + E(fseq<1,4>(),fall)%B;
+        FASTOR_EXIT_ASSERT(max(abs(C - 2*AB)) < BigTol);
+        FASTOR_EXIT_ASSERT(matmul_count == 2);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing common subexpression elimination: double precision")));
+    run<double>();
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+#define FASTOR_USE_RUNTIME_DISPATCH
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M, size_t K, size_t N>
+Tensor<T,M,N> reference_matmul(const Tensor<T,M,K> &a, const Tensor<T,K,N> &b) {
+    Tensor<T,M,N> out(0);
+    for (size_t i=0; i<M; ++i)
+        for (size_t k=0; k<K; ++k)
+            for (size_t j=0; j<N; ++j)
+                out(i,j) += a(i,k)*b(k,j);
+    return out;
+}
+
+template<typename T, size_t M, size_t K, size_t N>
+void test_dispatched_matmul() {
+    Tensor<T,M,K> a; a.iota(1); a /= T(M*K);
+    Tensor<T,K,N> b; b.iota(2); b /= T(K*N);
+    Tensor<T,K>   v; v.iota(3); v /= T(K);
+    const Tensor<T,M,N> exact = reference_matmul(a,b);
+
+    // static operands, above the size where dispatching kicks in
+    Tensor<T,M,N> c = matmul(a,b);
+    FASTOR_EXIT_ASSERT(std::abs(norm(c - exact)) < HugeTol);
+    c = a % b;
+    FASTOR_EXIT_ASSERT(std::abs(norm(c - exact)) < HugeTol);
+
+    // runtime extents
+    DynamicTensor<T,2> da(a), db(b);
+    DynamicTensor<T,1> dv(v);
+    DynamicTensor<T,2> dc = matmul(da,db);
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - exact)) < HugeTol);
+    dc += da % db;
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - 2*exact)) < HugeTol);
+    DynamicTensor<T,1> dw = matmul(da,dv);
+    Tensor<T,M> exactv = matmul(a,v);
+    FASTOR_EXIT_ASSERT(std::abs(norm(dw - exactv)) < HugeTol);
+}
+
+template<typename T>
+void test_dispatch() {
+    test_dispatched_matmul<T,3,4,5>();
+    test_dispatched_matmul<T,17,19,23>();
+    test_dispatched_matmul<T,32,32,32>();
+    test_dispatched_matmul<T,33,41,67>();
+    test_dispatched_matmul<T,64,20,3>();
+}
+
+
+int main() {
+
+    FASTOR_EXIT_ASSERT(int(detected_isa()) >= int(compiled_isa()));
+    FASTOR_EXIT_ASSERT(get_dispatch_isa() == detected_isa());
+
+    const DispatchISA isas[3] = {DispatchISA::SSE2, DispatchISA::AVX2, DispatchISA::AVX512};
+    const char *names[3] = {"SSE2", "AVX2", "AVX512"};
+    for (int i=0; i<3; ++i) {
+        if (int(isas[i]) > int(detected_isa())) break;
+        set_dispatch_isa(isas[i]);
+        FASTOR_EXIT_ASSERT(get_dispatch_isa() == isas[i]);
+        println(FBLU(BOLD("Testing runtime dispatch to")), names[i]);
+        print();
+        test_dispatch<float>();
+        test_dispatch<double>();
+        print(FGRN(BOLD("All tests passed successfully")));
+    }
+
+    return 0;
+}
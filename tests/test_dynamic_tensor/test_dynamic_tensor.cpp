@@ -0,0 +1,200 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void test_dynamic_matmul() {
+    Tensor<T,M,K> a; a.iota(1);
+    Tensor<T,K,N> b; b.iota(2);
+    Tensor<T,K>   v; v.iota(3);
+    Tensor<T,M,N> exact  = matmul(a,b);
+    Tensor<T,M>   exactv = matmul(a,v);
+
+    DynamicTensor<T,2> da(a), db(b);
+    DynamicTensor<T,1> dv(v);
+
+    // dynamic - dynamic
+    DynamicTensor<T,2> dc = matmul(da,db);
+    FASTOR_EXIT_ASSERT(dc.dimension(0)==M && dc.dimension(1)==N);
+    FASTOR_EXIT_ASSERT(std::abs(sum(dc - exact)) < HugeTol);
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - exact)) < HugeTol);
+
+    // lazy operator % with mixed static/dynamic operands
+    dc = da % b;
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - exact)) < HugeTol);
+    Tensor<T,M,N> c = a % db;
+    FASTOR_EXIT_ASSERT(std::abs(norm(c - exact)) < HugeTol);
+    dc = (da + 0) % (db * 1);
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - exact)) < HugeTol);
+
+    // in-place
+    dc += da % db;
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - 2*exact)) < HugeTol);
+    dc -= da % b;
+    FASTOR_EXIT_ASSERT(std::abs(norm(dc - exact)) < HugeTol);
+
+    // matrix-vector
+    DynamicTensor<T,1> dw = matmul(da,dv);
+    FASTOR_EXIT_ASSERT(dw.dimension(0)==M);
+    FASTOR_EXIT_ASSERT(std::abs(norm(dw - exactv)) < HugeTol);
+    dw = da % v;
+    FASTOR_EXIT_ASSERT(std::abs(norm(dw - exactv)) < HugeTol);
+}
+
+
+template<typename T>
+void test_dynamic_tensor() {
+
+    // construction and indexing
+    {
+        DynamicTensor<T,2> a(3,5);
+        FASTOR_EXIT_ASSERT(a.size()==15);
+        FASTOR_EXIT_ASSERT(a.dimension(0)==3 && a.dimension(1)==5);
+        FASTOR_EXIT_ASSERT(a.rank()==2);
+        FASTOR_EXIT_ASSERT(reinterpret_cast<std::uintptr_t>(a.data()) % FASTOR_MEMORY_ALIGNMENT_VALUE == 0);
+        a.iota(0);
+        FASTOR_EXIT_ASSERT(std::abs(a(1,2) - 7) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a(-1,-1) - 14) < Tol);
+        a(2,4) = 100;
+        FASTOR_EXIT_ASSERT(std::abs(a[14] - 100) < Tol);
+
+        DynamicTensor<T,3> b(std::array<FASTOR_INDEX,3>{2,3,4}, T(2));
+        FASTOR_EXIT_ASSERT(b.size()==24);
+        FASTOR_EXIT_ASSERT(std::abs(b.sum() - 48) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(b(1,2,3) - 2) < Tol);
+
+        // copy, move and resize
+        DynamicTensor<T,2> c(a);
+        FASTOR_EXIT_ASSERT(c.data()!=a.data());
+        FASTOR_EXIT_ASSERT(std::abs(c.sum() - a.sum()) < Tol);
+        DynamicTensor<T,2> d(std::move(c));
+        FASTOR_EXIT_ASSERT(c.size()==0 && c.data()==nullptr);
+        FASTOR_EXIT_ASSERT(std::abs(d.sum() - a.sum()) < Tol);
+        d.resize(7,9);
+        FASTOR_EXIT_ASSERT(d.size()==63 && d.dimension(1)==9);
+        d = a;
+        FASTOR_EXIT_ASSERT(d.size()==15 && d.dimension(1)==5);
+
+        DynamicTensor<T,1> e;
+        FASTOR_EXIT_ASSERT(e.size()==0);
+        e = DynamicTensor<T,1>(17);
+        e.ones();
+        FASTOR_EXIT_ASSERT(std::abs(e.sum() - 17) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(e.product() - 1) < Tol);
+        e = 3;
+        FASTOR_EXIT_ASSERT(std::abs(e.sum() - 51) < Tol);
+    }
+
+    // expressions with mixed static/dynamic operands, odd sizes exercise the remainder
+    {
+        Tensor<T,5,7> a; a.iota(1);
+        Tensor<T,5,7> b; b.iota(3);
+        DynamicTensor<T,2> da(a), db(b);
+        FASTOR_EXIT_ASSERT(da.dimension(0)==5 && da.dimension(1)==7);
+
+        DynamicTensor<T,2> dc = da + db;
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - sum(a+b)) < BigTol);
+        dc = da + b;
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - sum(a+b)) < BigTol);
+        dc = 2*a - db/2 + sqrt(da);
+        Tensor<T,5,7> exact = 2*a - b/2 + sqrt(a);
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - sum(exact)) < BigTol);
+
+        Tensor<T,5,7> c = da * b + 1;
+        FASTOR_EXIT_ASSERT(std::abs(sum(c) - sum(a*b+1)) < BigTol);
+        c = da;
+        FASTOR_EXIT_ASSERT(std::abs(sum(c) - sum(a)) < BigTol);
+
+        dc = da;
+        dc += b;
+        dc -= db;
+        dc *= 2;
+        dc /= da;
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - 70) < BigTol);
+
+        // reductions over dynamic expressions
+        FASTOR_EXIT_ASSERT(std::abs(sum(da + db) - sum(a + b)) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(product(da/da) - 1) < BigTol);
+    }
+
+    // matmul
+    {
+        test_dynamic_matmul<T,2,2,2>();
+        test_dynamic_matmul<T,3,3,3>();
+        test_dynamic_matmul<T,4,4,4>();
+        test_dynamic_matmul<T,5,3,7>();
+        test_dynamic_matmul<T,8,8,8>();
+        test_dynamic_matmul<T,9,13,17>();
+        test_dynamic_matmul<T,17,5,33>();
+    }
+
+    // views
+    {
+        Tensor<T,6,9> a; a.iota(1);
+        DynamicTensor<T,2> da(a);
+
+        DynamicTensor<T,2> db = da(seq(1,5),seq(2,9));
+        Tensor<T,4,7> exact = a(seq(1,5),seq(2,9));
+        FASTOR_EXIT_ASSERT(db.dimension(0)==4 && db.dimension(1)==7);
+        FASTOR_EXIT_ASSERT(std::abs(sum(db) - sum(exact)) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(norm(db - exact)) < BigTol);
+
+        // strided and negative sequences
+        db = da(seq(0,last,2),seq(1,last,3));
+        Tensor<T,3,3> exact2 = a(seq(0,last,2),seq(1,last,3));
+        FASTOR_EXIT_ASSERT(std::abs(norm(db - exact2)) < BigTol);
+        db = da(all,seq(2,last));
+        FASTOR_EXIT_ASSERT(db.dimension(0)==6 && db.dimension(1)==7);
+        FASTOR_EXIT_ASSERT(std::abs(sum(db) - sum(a(all,seq(2,last)))) < BigTol);
+        const DynamicTensor<T,2>& cda = da;
+        FASTOR_EXIT_ASSERT(std::abs(sum(cda(last,all)) - sum(a(last,all))) < BigTol);
+
+        // views in expressions
+        Tensor<T,4,7> c = da(seq(1,5),seq(2,9)) + 2*exact;
+        FASTOR_EXIT_ASSERT(std::abs(norm(c - 3*exact)) < BigTol);
+
+        // writing through views
+        DynamicTensor<T,2> dc(da);
+        dc(seq(1,5),seq(2,9)) = 0;
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - (sum(a) - sum(exact))) < BigTol);
+        dc(seq(1,5),seq(2,9)) = exact;
+        FASTOR_EXIT_ASSERT(std::abs(norm(dc - a)) < BigTol);
+        dc(seq(1,5),seq(2,9)) += da(seq(1,5),seq(2,9));
+        FASTOR_EXIT_ASSERT(std::abs(sum(dc) - (sum(a) + sum(exact))) < BigTol);
+        dc(seq(1,5),seq(2,9)) -= exact;
+        FASTOR_EXIT_ASSERT(std::abs(norm(dc - a)) < BigTol);
+        dc(all,seq(0,last,2)) *= 2;
+        dc(all,seq(0,last,2)) /= 2;
+        FASTOR_EXIT_ASSERT(std::abs(norm(dc - a)) < BigTol);
+
+        DynamicTensor<T,2> dd(std::array<FASTOR_INDEX,2>{4,4}, T(0));
+        Tensor<T,4,4> m; m.iota(1);
+        dd(seq(0,2),all) = matmul(m,m)(seq(0,2),all);
+        dd(seq(2,4),all) = m(fseq<2,4>(),all) % m;
+        FASTOR_EXIT_ASSERT(std::abs(norm(dd - matmul(m,m))) < HugeTol);
+
+        DynamicTensor<T,3> e(3,4,5); e.iota(0);
+        Tensor<T,3,4,5> f; f.iota(0);
+        DynamicTensor<T,3> g = e(seq(1,3),all,seq(1,last,2));
+        Tensor<T,2,4,2> exact3 = f(seq(1,3),all,seq(1,last,2));
+        FASTOR_EXIT_ASSERT(std::abs(norm(g - exact3)) < BigTol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing dynamic tensor: single precision")));
+    test_dynamic_tensor<float>();
+    print(FBLU(BOLD("Testing dynamic tensor: double precision")));
+    test_dynamic_tensor<double>();
+
+    return 0;
+}
@@ -356,6 +356,105 @@ void run() {
         FASTOR_EXIT_ASSERT(abs(c1.sum()-c2.sum()) < BigTol);
     }
 
+    // Tests permute + matmul lowering of general by-pair contractions
+    {
+        Tensor<T,2,3,4,5> a; a.iota(1); a /= 100;
+        Tensor<T,5,4> b; b.arange(2);
+        Tensor<T,6,3> c; c.iota(-4);
+        Tensor<T,2,5> d; d.iota(3);
+        Tensor<T,5,3,4> e; e.iota(1); e /= 10;
+        Tensor<T,4,7,5> f; f.arange(-2); f /= 10;
+
+        auto c1 = einsum<Index<i,j,k,l>,Index<l,k>>(a,b);
+        auto c2 = contraction<Index<i,j,k,l>,Index<l,k>>(a,b);
+        FASTOR_EXIT_ASSERT(max(abs(c1-c2)) < BigTol*max(abs(c2)));
+
+        auto c3 = einsum<Index<i,j,k,l>,Index<m,j>>(a,c);
+        auto c4 = contraction<Index<i,j,k,l>,Index<m,j>>(a,c);
+        FASTOR_EXIT_ASSERT(max(abs(c3-c4)) < BigTol*max(abs(c4)));
+
+        auto c5 = einsum<Index<i,j,k,l>,Index<i,l>>(a,d);
+        auto c6 = contraction<Index<i,j,k,l>,Index<i,l>>(a,d);
+        FASTOR_EXIT_ASSERT(max(abs(c5-c6)) < BigTol*max(abs(c6)));
+
+        auto c7 = einsum<Index<l,j,k>,Index<k,m,l>>(e,f);
+        auto c8 = contraction<Index<l,j,k>,Index<k,m,l>>(e,f);
+        FASTOR_EXIT_ASSERT(max(abs(c7-c8)) < BigTol*max(abs(c8)));
+
+        auto c9  = einsum<Index<k,m,l>,Index<l,j,k>>(f,e);
+        auto c10 = contraction<Index<k,m,l>,Index<l,j,k>>(f,e);
+        FASTOR_EXIT_ASSERT(max(abs(c9-c10)) < BigTol*max(abs(c10)));
+    }
+
+    // Tests einsum, inner and outer over expressions, views and maps
+    {
+        Tensor<T,3,4> a; a.iota(1); a /= 10;
+        Tensor<T,3,4> b; b.arange(-2); b /= 10;
+        Tensor<T,5,4,3> e; e.iota(2); e /= 100;
+        Tensor<T,4,4> f; f.iota(3); f /= 10;
+        TensorMap<T,3,4> am(a.data());
+        const Tensor<T,3,4> apb = a + b;
+
+        FASTOR_EXIT_ASSERT(abs(inner(a+b,am) - inner(apb,a)) < BigTol);
+        FASTOR_EXIT_ASSERT(abs(inner(f(fseq<0,3>(),fseq<1,4>())) - f(0,1) - f(1,2) - f(2,3)) < BigTol);
+        FASTOR_EXIT_ASSERT(abs(einsum<Index<i,j>,Index<i,j>>(a+b,am).toscalar() - inner(apb,a)) < BigTol);
+
+        Tensor<T,3,4,3,4> o1 = outer(a+b,am);
+        Tensor<T,3,4,3,4> o2 = outer(apb,a);
+        FASTOR_EXIT_ASSERT(max(abs(o1-o2)) < BigTol*max(abs(o2)));
+        o1 = einsum<Index<i,j>,Index<k,l>>(am,2*b);
+        o2 = outer(a,evaluate(2*b));
+        FASTOR_EXIT_ASSERT(max(abs(o1-o2)) < BigTol*max(abs(o2)));
+
+        auto c1 = einsum<Index<i,j>,Index<k,j,i>>(a+b,e);
+        auto c2 = einsum<Index<i,j>,Index<k,j,i>>(apb,e);
+        FASTOR_EXIT_ASSERT(max(abs(c1-c2)) < BigTol*max(abs(c2)));
+
+        Tensor<T,4,3> fs = f(fseq<0,4>(),fseq<1,4>());
+        auto c3 = einsum<Index<i,j>,Index<k,i>>(am,f(fseq<0,4>(),fseq<1,4>()));
+        auto c4 = einsum<Index<i,j>,Index<k,i>>(a,fs);
+        FASTOR_EXIT_ASSERT(max(abs(c3-c4)) < BigTol*max(abs(c4)));
+
+        auto c5 = einsum<Index<i,j>,Index<j,k>>(a+b,f);
+        Tensor<T,3,4> c6 = matmul(apb,f);
+        FASTOR_EXIT_ASSERT(max(abs(c5-c6)) < BigTol*max(abs(c6)));
+    }
+
+#if !defined(FASTOR_DONT_PERFORM_OP_MIN)
+    // Tests contraction ordering of tensor networks
+    {
+        Tensor<T,2,3> a; a.iota(1); a /= 10;
+        Tensor<T,4,5> b; b.arange(-3); b /= 10;
+        Tensor<T,3,4> c; c.iota(2); c /= 10;
+        Tensor<T,5,2> d; d.arange(1); d /= 10;
+
+        // a and b share no index so the network is not contracted from left to right
+        using path = typename einsum_helper<Index<i,j>,Index<k,l>,Index<j,k>,Index<l,m>,
+            Tensor<T,2,3>,Tensor<T,4,5>,Tensor<T,3,4>,Tensor<T,5,2>>::path_type;
+        static_assert(std::is_same<path,
+            opmin_contract<opmin_operand<0>,opmin_contract<opmin_contract<opmin_operand<1>,opmin_operand<3>>,opmin_operand<2>>>>::value,
+            "UNEXPECTED CONTRACTION PATH");
+
+        auto e1 = einsum<Index<i,j>,Index<k,l>,Index<j,k>,Index<l,m>>(a,b,c,d);
+        Tensor<T,2,2> e2 = matmul(matmul(matmul(a,c),b),d);
+        FASTOR_EXIT_ASSERT(max(abs(e1-e2)) < BigTol*max(abs(e2)));
+
+        // free indices come out in the order they appear in, whatever the path
+        auto e3 = einsum<Index<k,l>,Index<i,j>,Index<l,m>,Index<j,n>>(b,a,d,c);
+        Tensor<T,4,2,2,4> e4 = permute<Index<0,2,1,3>>(einsum<Index<k,m>,Index<i,n>>(matmul(b,d),matmul(a,c)));
+        FASTOR_EXIT_ASSERT(max(abs(e3-e4)) < BigTol*max(abs(e4)));
+
+        // beyond the exhaustive search
+        enum {a0,a1,a2,a3,a4,a5,a6,a7,a8,a9};
+        Tensor<T,3,3> f; f.iota(1); f /= 20;
+        auto f1 = einsum<Index<a0,a1>,Index<a1,a2>,Index<a2,a3>,Index<a3,a4>,Index<a4,a5>,
+                         Index<a5,a6>,Index<a6,a7>,Index<a7,a8>,Index<a8,a9>,Index<a9,a0>>(f,f,f,f,f,f,f,f,f,f);
+        Tensor<T,3,3> f2 = f;
+        for (int it=0; it<9; ++it) f2 = matmul(f2,f);
+        FASTOR_EXIT_ASSERT(abs(f1.toscalar() - trace(f2)) < BigTol*abs(trace(f2)));
+    }
+#endif
+
 #if !defined(FASTOR_MSVC)
     // Tests pair-reduction including permuted reduction cases
     {
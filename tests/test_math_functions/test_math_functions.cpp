@@ -7,9 +7,32 @@ using namespace Fastor;
 #define BigTol 1e-04
 
 
+template<typename T, typename ABI>
+void test_simd_copysign() {
+    using V = SIMDVector<T,ABI>;
+    T a[V::Size], b[V::Size];
+    for (FASTOR_INDEX i=0; i<V::Size; ++i) {
+        a[i] = (i % 3 == 0 ? T(-1) : T(1)) * T(i+0.5);
+        b[i] = i % 2 == 0 ? T(-0.) : T(2);
+    }
+    V c = copysign(V(a,false),V(b,false));
+    for (FASTOR_INDEX i=0; i<V::Size; ++i) {
+        FASTOR_EXIT_ASSERT(c[i] == std::copysign(a[i],b[i]));
+        FASTOR_EXIT_ASSERT(std::signbit(c[i]) == std::signbit(b[i]));
+    }
+}
+
 template<typename T>
 void test_math_functions() {
 
+    {
+        test_simd_copysign<T,simd_abi::scalar>();
+        test_simd_copysign<T,simd_abi::sse>();
+        test_simd_copysign<T,simd_abi::avx>();
+        test_simd_copysign<T,simd_abi::avx512>();
+        test_simd_copysign<T,DEFAULT_ABI>();
+    }
+
     {
         Tensor<T,2,2,2,2> t11; t11.fill(16);
         FASTOR_EXIT_ASSERT(std::abs(norm(sqrt(t11)) - 16       ) < BigTol);
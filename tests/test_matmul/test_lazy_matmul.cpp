@@ -284,6 +284,43 @@ void run() {
         FASTOR_EXIT_ASSERT(std::abs(e3.sum() - e2.sum()) < BigTol);
     }
 
+    // chains of products are evaluated in the cheapest order
+    {
+        Tensor<T,6,6> a;
+        Tensor<T,6,9> b;
+        Tensor<T,9,4> c;
+        Tensor<T,4> v;
+        a.iota(1); b.iota(2); c.iota(3); v.iota(4);
+        a /= 10; b /= 10; c /= 10;
+
+        using chain_type = internal::matmul_chain<typename matmul_chain_factors<decltype(a % b % c % v)>::type>;
+        static_assert(chain_type::split(0,3) == 0 && chain_type::split(1,3) == 1, "CHAIN IS NOT EVALUATED FROM THE RIGHT");
+
+        Tensor<T,6> e0 = matmul(matmul(matmul(a,b),c),v);
+        Tensor<T,6> e1 = a % b % c % v;
+        FASTOR_EXIT_ASSERT(std::abs(e1.sum() - e0.sum()) < BigTol*std::abs(e0.sum()));
+
+        e0 += matmul(a,matmul(b,matmul(c,v)));
+        e1 += a % (b % c) % v;
+        FASTOR_EXIT_ASSERT(std::abs(e1.sum() - e0.sum()) < BigTol*std::abs(e0.sum()));
+
+        Tensor<T,6,4> e2 = matmul(matmul(transpose(a),a + 1),matmul(b,c));
+        Tensor<T,6,4> e3 = trans(a) % (a + 1) % (b % c);
+        FASTOR_EXIT_ASSERT(std::abs(e3.sum() - e2.sum()) < BigTol*std::abs(e2.sum()));
+
+        e2 -= matmul(matmul(a,b),c);
+        e3 -= a % b % c;
+        FASTOR_EXIT_ASSERT(std::abs(e3.sum() - e2.sum()) < BigTol*std::abs(e2.sum()));
+
+        e2 *= matmul(matmul(a,a),matmul(b,c));
+        e3 *= a % a % b % c;
+        FASTOR_EXIT_ASSERT(std::abs(e3.sum() - e2.sum()) < BigTol*std::abs(e2.sum()));
+
+        e2 /= matmul(matmul(a,b),c) + 1;
+        e3 /= a % b % c + 1;
+        FASTOR_EXIT_ASSERT(std::abs(e3.sum() - e2.sum()) < BigTol*std::abs(e2.sum()));
+    }
+
 
     print(FGRN(BOLD("All tests passed successfully")));
 
@@ -64,6 +64,43 @@ void SINGLE_TEST(const Tensor<T,M,K> &a, const Tensor<T,K> &b) {
 
 
 
+// float storage with double accumulation is the double product rounded once
+template<size_t M, size_t K, size_t N>
+void MIXED_TEST() {
+
+    Tensor<float,M,K> a; a.random(); a -= 0.5f;
+    Tensor<float,K,N> b; b.random(); b -= 0.5f;
+
+    Tensor<double,M,N> c1 = matmul_ref(a.template cast<double>(),b.template cast<double>());
+    Tensor<float,M,N> c2 = matmul<double>(a,b);
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            FASTOR_EXIT_ASSERT(c2(i,j) == static_cast<float>(c1(i,j)));
+        }
+    }
+}
+
+void run_mixed() {
+    MIXED_TEST<1,1,1>();
+    MIXED_TEST<3,3,3>();
+    MIXED_TEST<8,3,3>();
+    MIXED_TEST<20,3,9>();
+    MIXED_TEST<5,7,13>();
+    MIXED_TEST<17,64,31>();
+
+    // matrix-vector
+    {
+        Tensor<float,9,17> a; a.random();
+        Tensor<float,17> b; b.random();
+        Tensor<double,9> c1 = matmul(a.cast<double>(),b.cast<double>());
+        Tensor<float,9> c2 = matmul<double>(a,b);
+        FASTOR_EXIT_ASSERT(norm(c1.cast<float>() - c2) == 0);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
 template<typename T>
 void run() {
 
@@ -450,6 +487,8 @@ int main() {
     run<float>();
     print(FBLU(BOLD("Testing tensor matmul: double precision")));
     run<double>();
+    print(FBLU(BOLD("Testing tensor matmul: single precision with double accumulation")));
+    run_mixed();
 
 
 
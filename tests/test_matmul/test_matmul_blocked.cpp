@@ -0,0 +1,95 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define Tol 1e-10
+#define BigTol 1e-4
+
+
+template<typename T>
+void matmul_ref(const T *a, const T *b, T *out, size_t M, size_t K, size_t N) {
+    for (size_t i=0; i<M*N; ++i) out[i] = T(0);
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<K; ++j) {
+            for (size_t k=0; k<N; ++k) {
+                out[i*N+k] += a[i*K+j]*b[j*N+k];
+            }
+        }
+    }
+}
+
+template<typename T>
+T max_rel_error(const T *c1, const T *c2, size_t size) {
+    T err = 0;
+    for (size_t i=0; i<size; ++i) {
+        err = std::max(err, std::abs(c1[i] - c2[i]) / std::max(T(1),std::abs(c1[i])));
+    }
+    return err;
+}
+
+
+// Matrices are too big for the stack, use heap buffers
+template<typename T, size_t M, size_t K, size_t N>
+void SINGLE_TEST(T tol) {
+
+    T *a  = internal::aligned_allocate<T>(M*K);
+    T *b  = internal::aligned_allocate<T>(K*N);
+    T *c1 = internal::aligned_allocate<T>(M*N);
+    T *c2 = internal::aligned_allocate<T>(M*N);
+    T *c3 = internal::aligned_allocate<T>(M*N);
+
+    for (size_t i=0; i<M*K; ++i) a[i] = T(int(i % 13) - 6) / T(7);
+    for (size_t i=0; i<K*N; ++i) b[i] = T(int(i % 11) - 5) / T(3);
+
+    matmul_ref(a,b,c1,M,K,N);
+    // Blocked kernel directly
+    internal::_matmul_blocked<T,M,K,N>(a,b,c2);
+    // Through the dispatcher
+    _matmul<T,M,K,N>(a,b,c3);
+
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c2,M*N) < tol);
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c3,M*N) < tol);
+
+    // Accumulating panels with random data
+    for (size_t i=0; i<M*K; ++i) a[i] = T(rand()) / T(RAND_MAX);
+    for (size_t i=0; i<K*N; ++i) b[i] = T(rand()) / T(RAND_MAX);
+
+    matmul_ref(a,b,c1,M,K,N);
+    internal::_matmul_blocked<T,M,K,N>(a,b,c2);
+    _matmul<T,M,K,N>(a,b,c3);
+
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c2,M*N) < tol);
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c3,M*N) < tol);
+
+    internal::aligned_free(a);
+    internal::aligned_free(b);
+    internal::aligned_free(c1);
+    internal::aligned_free(c2);
+    internal::aligned_free(c3);
+}
+
+
+template<typename T>
+void run(T tol) {
+
+    SINGLE_TEST<T,16,16,16>(tol);
+    SINGLE_TEST<T,17,5,31>(tol);
+    SINGLE_TEST<T,64,64,64>(tol);
+    SINGLE_TEST<T,67,129,93>(tol);
+    SINGLE_TEST<T,127,127,127>(tol);
+    SINGLE_TEST<T,256,256,256>(tol);
+    SINGLE_TEST<T,513,513,513>(tol);
+    SINGLE_TEST<T,600,37,300>(tol);
+    SINGLE_TEST<T,40,700,41>(tol);
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing blocked matmul: single precision")));
+    run<float>(BigTol);
+    print(FBLU(BOLD("Testing blocked matmul: double precision")));
+    run<double>(Tol);
+
+    return 0;
+}
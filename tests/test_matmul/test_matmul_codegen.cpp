@@ -0,0 +1,87 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define Tol 1e-09
+#define BigTol 1e-4
+
+// The kernels for these shapes are generated by tools/gemm_codegen, see CMakeLists.txt
+
+template<typename T, size_t M, size_t K, size_t N>
+Tensor<T,M,N> matmul_ref(const Tensor<T,M,K> &a, const Tensor<T,K,N> &b) {
+
+    Tensor<T,M,N> out; out.zeros();
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<K; ++j) {
+            for (size_t k=0; k<N; ++k) {
+                out(i,k) += a(i,j)*b(j,k);
+            }
+        }
+    }
+
+    return out;
+}
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void test() {
+
+    Tensor<T,M,K> a; a.random();
+    Tensor<T,K,N> b; b.random();
+
+    auto c1 = matmul_ref(a,b);
+    Tensor<T,M,N> c2 = matmul(a,b);
+    FASTOR_EXIT_ASSERT(norm(c1-c2) < BigTol);
+
+    // no kernels are generated for scalar code
+#ifndef FASTOR_DONT_VECTORISE
+    static_assert(internal::gemm_kernel<T,M,K,N>::value, "NO KERNEL WAS GENERATED FOR THIS SHAPE");
+    Tensor<T,M,N> c3;
+    internal::gemm_kernel<T,M,K,N>::apply(a.data(),b.data(),c3.data());
+    FASTOR_EXIT_ASSERT(norm(c2-c3) < Tol);
+#endif
+}
+
+
+template<typename T>
+void run() {
+
+    test<T,1,1,1>();
+    test<T,4,3,3>();
+    test<T,8,3,3>();
+    test<T,20,3,3>();
+    test<T,27,3,9>();
+    test<T,9,9,9>();
+    test<T,5,7,13>();
+    test<T,17,19,23>();
+    test<T,12,40,16>();
+    test<T,33,2,31>();
+
+    // shapes with hand written kernels are left to them
+    static_assert(!internal::gemm_kernel<T,3,8,3>::value, "SPECIALISED SHAPE SHOULD NOT BE GENERATED");
+    {
+        Tensor<T,3,8> a; a.random();
+        Tensor<T,8,3> b; b.random();
+        FASTOR_EXIT_ASSERT(norm(matmul(a,b)-matmul_ref(a,b)) < BigTol);
+    }
+
+    // shapes that were not generated keep the default kernels
+    static_assert(!internal::gemm_kernel<T,6,5,7>::value, "UNEXPECTED KERNEL");
+    {
+        Tensor<T,6,5> a; a.random();
+        Tensor<T,5,7> b; b.random();
+        FASTOR_EXIT_ASSERT(norm(matmul(a,b)-matmul_ref(a,b)) < BigTol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing matmul with generated kernels: single precision")));
+    run<float>();
+    print(FBLU(BOLD("Testing matmul with generated kernels: double precision")));
+    run<double>();
+
+    return 0;
+}
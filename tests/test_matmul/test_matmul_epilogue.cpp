@@ -0,0 +1,172 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+#define Tol 1e-10
+#define BigTol 1e-4
+
+
+template<typename T, size_t ... Rest>
+T max_rel_error(const Tensor<T,Rest...> &c1, const Tensor<T,Rest...> &c2) {
+    T err = 0;
+    for (size_t i=0; i<c1.size(); ++i) {
+        err = std::max(err, std::abs(c1.data()[i] - c2.data()[i]) / std::max(T(1),std::abs(c1.data()[i])));
+    }
+    return err;
+}
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void SINGLE_TEST(T tol) {
+
+    Tensor<T,M,K> a;
+    Tensor<T,K,N> b;
+    Tensor<T,M,N> d;
+    for (size_t i=0; i<M*K; ++i) a.data()[i] = T(int(i % 13) - 6) / T(7);
+    for (size_t i=0; i<K*N; ++i) b.data()[i] = T(int(i % 11) - 5) / T(3);
+    for (size_t i=0; i<M*N; ++i) d.data()[i] = T(int(i % 7) + 1) / T(5);
+
+    // plain products are tested elsewhere
+    const Tensor<T,M,N> ab = a % b;
+
+    static_assert(is_fused_gemm_expr_v<decltype(2*(a%b) + d)>, "EXPRESSION IS NOT FUSED");
+    static_assert(is_fused_gemm_expr_v<decltype(sqrt(abs(a%b)))>, "EXPRESSION IS NOT FUSED");
+    static_assert(!is_fused_gemm_expr_v<decltype(a%b)>, "PLAIN PRODUCTS ARE NOT FUSED");
+
+    // assignment
+    {
+        Tensor<T,M,N> c1 = 2*(a%b) + d;
+        Tensor<T,M,N> c2 = 2*ab + d;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 = d - (a%b)/3;
+        c2 = d - ab/3;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 = (a%b)*d + 1;
+        c2 = ab*d + 1;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 = sqrt(abs(a%b));
+        c2 = sqrt(abs(ab));
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 = -exp(T(0.1)*(a%b) + d);
+        c2 = -exp(T(0.1)*ab + d);
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+    }
+
+    // in-place assignment
+    {
+        Tensor<T,M,N> c1 = d, c2 = d;
+        c1 += 2*(a%b) + d;
+        c2 += 2*ab + d;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 -= (a%b)/2;
+        c2 -= ab/2;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 *= (a%b) - 1;
+        c2 *= ab - 1;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+        c1 /= abs(a%b) + 1;
+        c2 /= abs(ab) + 1;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+    }
+
+    // operands that are expressions
+    {
+        Tensor<T,K,M> at = transpose(a);
+        Tensor<T,M,N> c1 = 3*(transpose(at)%(b+1)) - d;
+        Tensor<T,M,N> c2 = 3*(a%b) + 3*(a%Tensor<T,K,N>(1)) - d;
+        FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+    }
+}
+
+
+// The destination is an operand of the product
+template<typename T, size_t M, size_t N>
+void ALIAS_TEST(T tol) {
+
+    Tensor<T,M,M> a;
+    Tensor<T,M,N> d;
+    for (size_t i=0; i<M*M; ++i) a.data()[i] = T(int(i % 13) - 6) / T(7);
+    for (size_t i=0; i<M*N; ++i) d.data()[i] = T(int(i % 7) + 1) / T(5);
+
+    Tensor<T,M,N> c1 = d;
+    Tensor<T,M,N> c2 = d + 2*Tensor<T,M,N>(a % d);
+    c1 += 2*(a%c1);
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+
+    c1 = d;
+    c2 = sqrt(abs(Tensor<T,M,N>(a % d))) - d;
+    c1 = sqrt(abs(a%c1)) - c1;
+    FASTOR_EXIT_ASSERT(max_rel_error(c1,c2) < tol);
+}
+
+
+// The alpha/beta kernel on heap buffers including products that are too large
+// for the register tiled kernel
+template<typename T, size_t M, size_t K, size_t N>
+void GEMM_TEST(T tol) {
+
+    T *a  = internal::aligned_allocate<T>(M*K);
+    T *b  = internal::aligned_allocate<T>(K*N);
+    T *c1 = internal::aligned_allocate<T>(M*N);
+    T *c2 = internal::aligned_allocate<T>(M*N);
+
+    for (size_t i=0; i<M*K; ++i) a[i] = T(int(i % 13) - 6) / T(7);
+    for (size_t i=0; i<K*N; ++i) b[i] = T(int(i % 11) - 5) / T(3);
+    for (size_t i=0; i<M*N; ++i) c1[i] = T(int(i % 7) + 1) / T(5);
+
+    _matmul<T,M,K,N>(a,b,c2);
+    for (size_t i=0; i<M*N; ++i) c2[i] = 2*c2[i] - 3*c1[i];
+    internal::_gemm<T,M,K,N>(T(2),a,b,T(-3),c1);
+
+    T err = 0;
+    for (size_t i=0; i<M*N; ++i) {
+        err = std::max(err, std::abs(c1[i] - c2[i]) / std::max(T(1),std::abs(c1[i])));
+    }
+    FASTOR_EXIT_ASSERT(err < tol);
+
+    internal::aligned_free(a);
+    internal::aligned_free(b);
+    internal::aligned_free(c1);
+    internal::aligned_free(c2);
+}
+
+
+template<typename T>
+void run(T tol) {
+
+    SINGLE_TEST<T,2,2,2>(tol);
+    SINGLE_TEST<T,3,4,5>(tol);
+    SINGLE_TEST<T,4,4,4>(tol);
+    SINGLE_TEST<T,8,8,8>(tol);
+    SINGLE_TEST<T,9,7,17>(tol);
+    SINGLE_TEST<T,16,16,16>(tol);
+    SINGLE_TEST<T,19,19,35>(tol);
+    SINGLE_TEST<T,33,20,45>(tol);
+
+    ALIAS_TEST<T,4,4>(tol);
+    ALIAS_TEST<T,9,17>(tol);
+    ALIAS_TEST<T,16,16>(tol);
+
+    GEMM_TEST<T,5,6,7>(tol);
+    GEMM_TEST<T,32,32,32>(tol);
+    GEMM_TEST<T,37,41,43>(tol);
+    GEMM_TEST<T,400,400,400>(tol);
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing matmul with epilogue: single precision")));
+    run<float>(BigTol);
+    print(FBLU(BOLD("Testing matmul with epilogue: double precision")));
+    run<double>(Tol);
+
+    return 0;
+}
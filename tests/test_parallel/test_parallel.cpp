@@ -0,0 +1,104 @@
+// Use a small threshold and chunk size so that moderately sized tensors
+// are split in to many chunks
+#define FASTOR_USE_THREADS
+#define FASTOR_PARALLEL_THRESHOLD 256
+#define FASTOR_PARALLEL_CHUNK_BYTES 512
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M, size_t N>
+void test_parallel_assignment() {
+
+    Tensor<T,M,N> a, b, serial, parallel;
+    a.iota(1);
+    b.iota(3);
+    b /= T(M*N);
+
+    // assignment
+    set_num_threads(1);
+    serial = 2*a + sqrt(b) - a/3;
+    set_num_threads(4);
+    parallel = 2*a + sqrt(b) - a/3;
+    FASTOR_EXIT_ASSERT(std::abs(norm(serial - parallel)) < Tol);
+
+    // in-place expression operators
+    set_num_threads(1);
+    serial += a*b; serial -= b; serial *= b + 1; serial /= a;
+    set_num_threads(4);
+    parallel += a*b; parallel -= b; parallel *= b + 1; parallel /= a;
+    FASTOR_EXIT_ASSERT(std::abs(norm(serial - parallel)) < Tol);
+
+    // in-place scalar operators
+    set_num_threads(1);
+    serial += 2; serial -= 1; serial *= 3; serial /= 2;
+    set_num_threads(4);
+    parallel += 2; parallel -= 1; parallel *= 3; parallel /= 2;
+    FASTOR_EXIT_ASSERT(std::abs(norm(serial - parallel)) < Tol);
+    parallel = 5;
+    FASTOR_EXIT_ASSERT(std::abs(parallel.sum() - 5*M*N) < BigTol);
+
+    // boolean expressions
+    Tensor<bool,M,N> mask = a > T(M*N/2);
+    FASTOR_EXIT_ASSERT(mask(0,0)==false && mask(M-1,N-1)==true);
+
+    // reductions
+    set_num_threads(1);
+    const T sum_serial = sum(a + b);
+    const T prod_serial = product(b/b);
+    const T min_serial = min(a + b);
+    const T max_serial = max(a + b);
+    set_num_threads(4);
+    FASTOR_EXIT_ASSERT(std::abs(sum(a + b) - sum_serial) < BigTol*sum_serial);
+    FASTOR_EXIT_ASSERT(std::abs(product(b/b) - prod_serial) < BigTol);
+    FASTOR_EXIT_ASSERT(std::abs(min(a + b) - min_serial) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(max(a + b) - max_serial) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(sum(a) - T(M*N)*T(M*N+1)/2) < BigTol*sum(a));
+}
+
+template<typename T>
+void test_parallel_dynamic(FASTOR_INDEX M, FASTOR_INDEX N) {
+    DynamicTensor<T,2> a(M,N), b(M,N), c(M,N);
+    a.iota(1);
+    b.ones();
+
+    c = a + 2*b;
+    FASTOR_EXIT_ASSERT(std::abs(c(0,0) - 3) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(c(M-1,N-1) - T(M*N+2)) < Tol);
+    c -= a;
+    FASTOR_EXIT_ASSERT(std::abs(sum(c) - 2*T(M*N)) < BigTol);
+}
+
+
+template<typename T>
+void run_tests() {
+    FASTOR_EXIT_ASSERT(get_num_threads()>=1);
+
+    // smaller than the threshold
+    test_parallel_assignment<T,5,7>();
+    // chunk sizes that are and are not a multiple of the SIMD width
+    test_parallel_assignment<T,16,32>();
+    test_parallel_assignment<T,37,29>();
+    test_parallel_assignment<T,101,13>();
+
+    test_parallel_dynamic<T>(123,77);
+    test_parallel_dynamic<T>(512,3);
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing parallel evaluation: single precision")));
+    run_tests<float>();
+    print(FBLU(BOLD("Testing parallel evaluation: double precision")));
+    run_tests<double>();
+
+    return 0;
+}
@@ -533,6 +533,8 @@ void run() {
     run_permute_3d<T,4,4,4>();
     // non-uniform
     run_permute_3d<T,3,5,11>();
+    // large enough to go through the blocked permutation
+    run_permute_3d<T,17,19,23>();
 
     // 4D
     // uniform
@@ -541,6 +543,7 @@ void run() {
     run_permute_4d<T,4,4,4,4>();
     // non-uniform
     run_permute_4d<T,2,3,4,5>();
+    run_permute_4d<T,8,10,12,14>();
 
     // 5D
     // uniform
@@ -548,6 +551,7 @@ void run() {
     run_permute_5d<T,3,3,3,3,3>();
     // non-uniform
     run_permute_5d<T,2,3,4,5,7>();
+    run_permute_5d<T,5,6,9,10,11>();
 }
 
 int main() {
@@ -109,6 +109,51 @@ void run() {
     }
 }
 
+template<typename T>
+void run_gather_scatter() {
+
+    // indices scattered over the tensor, enough of them for full SIMD vectors and a remainder
+    constexpr size_t N = 101, M = 37;
+    Tensor<T,N> a; a.iota(0);
+    Tensor<int,M> it;
+    for (size_t i=0; i<M; ++i) it(i) = int((i*41 + 7) % N);
+
+    Tensor<T,M> b = a(it);
+    Tensor<T,M> c = 2*a(it) + b;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(b(i) == a(it(i)));
+        FASTOR_EXIT_ASSERT(c(i) == 3*a(it(i)));
+    }
+
+    Tensor<T,N> d; d.zeros();
+    d(it) = b + 1;
+    for (size_t i=0; i<M; ++i) FASTOR_EXIT_ASSERT(d(it(i)) == b(i) + 1);
+
+    // repeated indices, the last write wins and updates accumulate
+    Tensor<int,M> it_rep;
+    for (size_t i=0; i<M; ++i) it_rep(i) = int(i % 5);
+    d.zeros();
+    d(it_rep) = b;
+    for (size_t k=0; k<5; ++k) FASTOR_EXIT_ASSERT(d(k) == b(k + 5*((M-1-k)/5)));
+    d.zeros();
+    d(it_rep) += b;
+    for (size_t k=0; k<5; ++k) {
+        T sum = 0;
+        for (size_t i=k; i<M; i+=5) sum += b(i);
+        FASTOR_EXIT_ASSERT(d(k) == sum);
+    }
+
+    // strided views
+    Tensor<T,N> e; e.iota(0);
+    Tensor<T,34> f = e(seq(0,N,3));
+    e(seq(1,N,3)) = f;
+    e(fseq<2,N,3>()) += f(fseq<0,33>());
+    for (size_t i=0; i<34; ++i) FASTOR_EXIT_ASSERT(f(i) == T(3*i) && e(3*i+1) == T(3*i));
+    for (size_t i=0; i<33; ++i) FASTOR_EXIT_ASSERT(e(3*i+2) == T(6*i+2));
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
 
 int main() {
 
@@ -117,5 +162,14 @@ int main() {
     print(FBLU(BOLD("Testing 1-dimensional random tensor views: double precision")));
     run<double>();
 
+    print(FBLU(BOLD("Testing gather/scatter through 1-dimensional views: single precision")));
+    run_gather_scatter<float>();
+    print(FBLU(BOLD("Testing gather/scatter through 1-dimensional views: double precision")));
+    run_gather_scatter<double>();
+    print(FBLU(BOLD("Testing gather/scatter through 1-dimensional views: int32_t")));
+    run_gather_scatter<int32_t>();
+    print(FBLU(BOLD("Testing gather/scatter through 1-dimensional views: int64_t")));
+    run_gather_scatter<int64_t>();
+
     return 0;
 }
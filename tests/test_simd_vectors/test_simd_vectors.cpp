@@ -178,6 +178,90 @@ void test_intergers_divs<Int64,simd_abi::sse>() {
 }
 
 
+// 64-bit integer multiplication has no SSE/AVX2 instruction and is emulated
+// by _mm_mul_epi64, check lanes with products that do not fit in 32 bits
+template<typename ABI>
+void test_int64_muls() {
+
+    using TT = Int64;
+    using V = SIMDVector<TT,ABI>;
+    constexpr FASTOR_INDEX N = V::Size;
+
+    TT arr_a[N], arr_b[N];
+    for (FASTOR_INDEX i=0; i<N; ++i) {
+        arr_a[i] = (i % 2 == 0 ? 1 : -1) * (TT(3000000007) + TT(i));
+        arr_b[i] = TT(i) - TT(40000);
+    }
+
+    {
+        V a(arr_a,false), b(arr_b,false);
+        V c = a * b;
+        for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(c[i] == arr_a[i]*arr_b[i], "TEST FAILED");
+        a *= b;
+        for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(a[i] == arr_a[i]*arr_b[i], "TEST FAILED");
+    }
+
+    {
+        V a(arr_a,false);
+        V c = a * TT(-70000);
+        V d = TT(-70000) * a;
+        a *= TT(-70000);
+        for (FASTOR_INDEX i=0; i<N; ++i) {
+            FASTOR_EXIT_ASSERT(c[i] == arr_a[i]*TT(-70000), "TEST FAILED");
+            FASTOR_EXIT_ASSERT(d[i] == arr_a[i]*TT(-70000), "TEST FAILED");
+            FASTOR_EXIT_ASSERT(a[i] == arr_a[i]*TT(-70000), "TEST FAILED");
+        }
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+
+
+#ifdef FASTOR_NEON_IMPL
+template<typename T>
+void test_neon_vectors() {
+
+    using V = SIMDVector<T,simd_abi::neon>;
+    constexpr FASTOR_INDEX N = V::Size;
+    FASTOR_EXIT_ASSERT(N*sizeof(T)==16);
+
+    T arr[N], out[N];
+    for (FASTOR_INDEX i=0; i<N; ++i) arr[i] = T(i+1);
+
+    V a(arr,false);
+    a.store(out,false);
+    for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(out[i]==arr[i] && a[i]==arr[i], "TEST FAILED");
+
+    V r = a.reverse();
+    for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(r[i]==arr[N-i-1], "TEST FAILED");
+
+    FASTOR_EXIT_ASSERT(a.minimum()==T(1) && a.maximum()==T(N), "TEST FAILED");
+    FASTOR_EXIT_ASSERT(std::abs(a.sum() - T(N*(N+1)/2)) < Tol, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(std::abs(a.product() - (N==4 ? T(24) : T(2))) < Tol, "TEST FAILED");
+
+    V m = min(a,V(T(2))), M = max(a,V(T(2)));
+    for (FASTOR_INDEX i=0; i<N; ++i) {
+        FASTOR_EXIT_ASSERT(m[i]==std::min(arr[i],T(2)) && M[i]==std::max(arr[i],T(2)), "TEST FAILED");
+    }
+
+    V f = fmadd(a,a,a);
+    for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(f[i]==arr[i]*arr[i]+arr[i], "TEST FAILED");
+
+    V n = abs(-a);
+    for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(n[i]==arr[i], "TEST FAILED");
+
+    V d = (a*T(6)) / a;
+    for (FASTOR_INDEX i=0; i<N; ++i) FASTOR_EXIT_ASSERT(d[i]==T(6), "TEST FAILED");
+
+    // Bit i of the mask is lane i
+    V l; l.mask_load(arr,0x1);
+    FASTOR_EXIT_ASSERT(l[0]==arr[0] && l.sum()==arr[0], "TEST FAILED");
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+#endif
 
 
 template<typename T, typename ABI>
@@ -226,6 +310,13 @@ void test_simd_vectors() {
     // FASTOR_EXIT_ASSERT(SIMDVector<std::complex<float>,simd_abi::scalar>::size()==1);
 #endif
 
+#ifdef FASTOR_NEON_IMPL
+    FASTOR_EXIT_ASSERT(SIMDVector<double>::size()==2);
+    FASTOR_EXIT_ASSERT(SIMDVector<float>::size()==4);
+    FASTOR_EXIT_ASSERT(SIMDVector<int>::size()==4);
+    FASTOR_EXIT_ASSERT(SIMDVector<Int64>::size()==2);
+#endif
+
     print(FGRN(BOLD("All tests passed successfully")));
 
 }
@@ -281,6 +372,21 @@ int main() {
 #endif
 
 
+#ifdef FASTOR_NEON_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of single precision - NEON")));
+    test_simd_vectors<float,simd_abi::neon>();
+    test_neon_vectors<float>();
+    print(FBLU(BOLD("Testing SIMDVector of double precision - NEON")));
+    test_simd_vectors<double,simd_abi::neon>();
+    test_neon_vectors<double>();
+    print(FBLU(BOLD("Testing SIMDVector of int - NEON")));
+    test_simd_vectors<int,simd_abi::neon>();
+    test_neon_vectors<int>();
+    print(FBLU(BOLD("Testing SIMDVector of long long - NEON")));
+    test_simd_vectors<Int64,simd_abi::neon>();
+    test_neon_vectors<Int64>();
+#endif
+
     print(FBLU(BOLD("Testing SIMDVector of int for division - 128")));
     test_intergers_divs<int,simd_abi::sse>();
     print(FBLU(BOLD("Testing SIMDVector of int for division - 256")));
@@ -291,5 +397,10 @@ int main() {
     print(FBLU(BOLD("Testing SIMDVector of long long for division - 256")));
     test_intergers_divs<Int64,simd_abi::avx>();
 
+    print(FBLU(BOLD("Testing SIMDVector of long long for multiplication - 128")));
+    test_int64_muls<simd_abi::sse>();
+    print(FBLU(BOLD("Testing SIMDVector of long long for multiplication - 256")));
+    test_int64_muls<simd_abi::avx>();
+
     return 0;
 }
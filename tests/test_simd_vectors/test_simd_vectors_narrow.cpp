@@ -0,0 +1,295 @@
+#include <Fastor/Fastor.h>
+#include <random>
+
+using namespace Fastor;
+
+#define Tol 1e-12
+#define HTol 1e-2
+
+
+template<typename T, typename ABI>
+void test_narrow_ints() {
+
+    using V = SIMDVector<T,ABI>;
+    constexpr int Size = V::Size;
+
+    T arr0[Size], arr1[Size], out[Size];
+    for (int i=0; i<Size; ++i) {
+        arr0[i] = T(3*i - 40);
+        arr1[i] = T(i % 7 + 1);
+    }
+    // wrap around is deliberate, integer arithmetic is modular
+    auto wrap = [](int a) {return T(a);};
+
+    {
+        V a(arr0,false), b(arr1,false);
+        (a + b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(arr0[i] + arr1[i]), "TEST FAILED");
+        (a - b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(arr0[i] - arr1[i]), "TEST FAILED");
+        (a * b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(arr0[i] * arr1[i]), "TEST FAILED");
+        (a / b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(arr0[i] / arr1[i]), "TEST FAILED");
+        (a * T(3) - T(1)).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(wrap(arr0[i] * 3) - 1), "TEST FAILED");
+        (T(2) - a).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(2 - arr0[i]), "TEST FAILED");
+    }
+
+    {
+        V a(arr0,false), b(arr1,false);
+        a += b; a *= b; a -= T(1);
+        a.store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(wrap(wrap(arr0[i] + arr1[i]) * arr1[i]) - 1), "TEST FAILED");
+    }
+
+    {
+        V a(arr0,false), b(arr1,false);
+        min(a,b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == std::min(arr0[i],arr1[i]), "TEST FAILED");
+        max(a,b).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == std::max(arr0[i],arr1[i]), "TEST FAILED");
+        abs(a).store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(std::is_signed<T>::value ? std::abs(int(arr0[i])) : arr0[i]), "TEST FAILED");
+        FASTOR_EXIT_ASSERT(a.minimum() == *std::min_element(arr0,arr0+Size), "TEST FAILED");
+        FASTOR_EXIT_ASSERT(a.maximum() == *std::max_element(arr0,arr0+Size), "TEST FAILED");
+        T s = 0; for (int i=0; i<Size; ++i) s += arr0[i];
+        FASTOR_EXIT_ASSERT(a.sum() == s, "TEST FAILED");
+    }
+
+    {
+        V a(T(0));
+        FASTOR_EXIT_ASSERT(a.sum() == T(0), "TEST FAILED");
+        a.set_sequential(T(1));
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(a[i] == wrap(i+1), "TEST FAILED");
+        a.reverse().store(out,false);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(out[i] == wrap(Size-i), "TEST FAILED");
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_narrow_int_tensors() {
+
+    {
+        Tensor<T,7,13> a, b;
+        a.iota(); b.fill(2);
+        Tensor<T,7,13> c = a*b - a + T(1);
+        for (FASTOR_INDEX i=0; i<c.size(); ++i) {
+            FASTOR_EXIT_ASSERT(c.data()[i] == T(T(a.data()[i]*2) - a.data()[i] + 1), "TEST FAILED");
+        }
+        c = max(a,b) - min(a,b);
+        for (FASTOR_INDEX i=0; i<c.size(); ++i) {
+            FASTOR_EXIT_ASSERT(c.data()[i] == T(std::max(a.data()[i],b.data()[i]) - std::min(a.data()[i],b.data()[i])), "TEST FAILED");
+        }
+    }
+
+    {
+        Tensor<T,91> a; a.iota();
+        Tensor<T,30> b = a(seq(0,90,3));
+        for (int i=0; i<30; ++i) FASTOR_EXIT_ASSERT(b(i) == a(3*i), "TEST FAILED");
+        b = a(iseq<1,91,3>());
+        for (int i=0; i<30; ++i) FASTOR_EXIT_ASSERT(b(i) == a(3*i+1), "TEST FAILED");
+        a(seq(0,90,3)) = T(0);
+        for (int i=0; i<30; ++i) FASTOR_EXIT_ASSERT(a(3*i) == T(0), "TEST FAILED");
+
+        Tensor<T,8,9> c; c.iota();
+        Tensor<T,4,4> d = c(seq(0,4),seq(1,9,2));
+        FASTOR_EXIT_ASSERT(d(1,1) == c(1,3) && d(3,3) == c(3,7), "TEST FAILED");
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename H>
+void test_half_conversions();
+
+template<>
+void test_half_conversions<float16>() {
+    // every finite float16 survives a round trip through float
+    for (uint32_t bits=0; bits<65536; ++bits) {
+        float16 h = float16::from_bits(uint16_t(bits));
+        float f = float(h);
+        if (std::isnan(f)) {
+            FASTOR_EXIT_ASSERT(std::isnan(float(float16(f))), "TEST FAILED");
+            continue;
+        }
+        FASTOR_EXIT_ASSERT(float16(f).bits == bits, "TEST FAILED");
+    }
+    // rounding to nearest with ties to even
+    FASTOR_EXIT_ASSERT(float16(1.f + 1.f/2048).bits == 0x3C00, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(float16(1.f + 3.f/2048).bits == 0x3C02, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(float16(65520.f).bits == 0x7C00, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(float16(65519.f).bits == 0x7BFF, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(float16(-2.98023224e-8f).bits == 0x8000, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(float16(5.96046448e-8f).bits == 0x0001, "TEST FAILED");
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+template<>
+void test_half_conversions<bfloat16>() {
+    for (uint32_t bits=0; bits<65536; ++bits) {
+        bfloat16 h = bfloat16::from_bits(uint16_t(bits));
+        float f = float(h);
+        if (std::isnan(f)) {
+            FASTOR_EXIT_ASSERT(std::isnan(float(bfloat16(f))), "TEST FAILED");
+            continue;
+        }
+        FASTOR_EXIT_ASSERT(bfloat16(f).bits == bits, "TEST FAILED");
+    }
+    FASTOR_EXIT_ASSERT(bfloat16(1.f + 1.f/256).bits == 0x3F80, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(bfloat16(1.f + 3.f/256).bits == 0x3F82, "TEST FAILED");
+    FASTOR_EXIT_ASSERT(bfloat16(std::numeric_limits<float>::max()).bits == 0x7F80, "TEST FAILED");
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename H, typename ABI>
+void test_half_vectors() {
+
+    using V = SIMDVector<H,ABI>;
+    constexpr int Size = V::Size;
+
+    // the vector conversions round like the scalar ones, denormals are left out as
+    // the AVX512_BF16 conversions flush them
+    {
+        std::mt19937 gen(7);
+        std::uniform_int_distribution<uint32_t> dist;
+        float vals[Size];
+        H hvals[Size];
+        for (int k=0; k<20000; ++k) {
+            for (int i=0; i<Size; ++i) {
+                uint32_t bits = dist(gen);
+                if ((bits & 0x7F800000u) == 0u) bits &= 0x80000000u;
+                std::memcpy(&vals[i],&bits,sizeof(float));
+            }
+            V a; a.value.load(vals,false);
+            a.store(hvals,false);
+            for (int i=0; i<Size; ++i) {
+                if (std::isnan(vals[i])) FASTOR_EXIT_ASSERT(std::isnan(float(hvals[i])), "TEST FAILED");
+                else FASTOR_EXIT_ASSERT(hvals[i].bits == H(vals[i]).bits, "TEST FAILED");
+            }
+            V b(hvals,false);
+            for (int i=0; i<Size; ++i) {
+                FASTOR_EXIT_ASSERT(std::isnan(vals[i]) || b[i].bits == hvals[i].bits, "TEST FAILED");
+            }
+        }
+    }
+
+    {
+        H arr[Size];
+        for (int i=0; i<Size; ++i) arr[i] = H(float(i) + 0.5f);
+        V a(arr,false), b(H(2.f));
+        V c = a*b + sqrt(b) - H(1.f);
+        for (int i=0; i<Size; ++i) {
+            FASTOR_EXIT_ASSERT(std::abs(float(c[i]) - (2.f*float(arr[i]) + std::sqrt(2.f) - 1.f)) < HTol*(i+1), "TEST FAILED");
+        }
+        c = -a / b;
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(float(c[i]) == -float(arr[i])/2.f, "TEST FAILED");
+        c = max(a,b);
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(float(c[i]) == std::max(float(arr[i]),2.f), "TEST FAILED");
+        a += b;
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(float(a[i]) == float(arr[i]) + 2.f, "TEST FAILED");
+        FASTOR_EXIT_ASSERT(std::abs(float(b.sum()) - 2.f*Size) < Tol, "TEST FAILED");
+    }
+
+    {
+        V a(0);
+        FASTOR_EXIT_ASSERT(float(a.sum()) == 0.f, "TEST FAILED");
+        a.set_sequential(H(1.f));
+        for (int i=0; i<Size; ++i) FASTOR_EXIT_ASSERT(float(a[i]) == float(i+1), "TEST FAILED");
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename H>
+void test_half_tensors() {
+
+    {
+        Tensor<float,9,17> af; af.random();
+        Tensor<H,9,17> a = af.template cast<H>(), b; b.fill(2.f);
+        for (FASTOR_INDEX i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i].bits == H(af.data()[i]).bits, "TEST FAILED");
+
+        Tensor<H,9,17> c = a*b + exp(a) - H(1.f);
+        Tensor<float,9,17> cf = c.template cast<float>();
+        for (FASTOR_INDEX i=0; i<c.size(); ++i) {
+            float ai = float(a.data()[i]);
+            FASTOR_EXIT_ASSERT(cf.data()[i] == float(c.data()[i]), "TEST FAILED");
+            FASTOR_EXIT_ASSERT(std::abs(cf.data()[i] - (2.f*ai + std::exp(ai) - 1.f)) < 5*HTol, "TEST FAILED");
+        }
+
+        // without SIMD the partial sums are rounded to half precision after every addition
+        float s = 0.f; for (FASTOR_INDEX i=0; i<a.size(); ++i) s += float(a.data()[i]);
+        FASTOR_EXIT_ASSERT(std::abs(float(sum(a)) - s) < std::abs(s)*5*HTol, "TEST FAILED");
+    }
+
+    {
+        Tensor<H,8,9> a; a.iota(1.f);
+        Tensor<H,4,4> b = a(seq(0,4),seq(1,9,2));
+        FASTOR_EXIT_ASSERT(float(b(1,1)) == float(a(1,3)) && float(b(3,3)) == float(a(3,7)), "TEST FAILED");
+        a(seq(0,4),seq(1,9,2)) = H(0.f);
+        FASTOR_EXIT_ASSERT(float(a(1,3)) == 0.f && float(a(1,4)) == 14.f, "TEST FAILED");
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+#ifdef FASTOR_AVX512BW_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of 8 and 16 bit integers - 512")));
+    test_narrow_ints<int8_t,simd_abi::avx512>();
+    test_narrow_ints<uint8_t,simd_abi::avx512>();
+    test_narrow_ints<int16_t,simd_abi::avx512>();
+#endif
+#ifdef FASTOR_AVX2_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of 8 and 16 bit integers - 256")));
+    test_narrow_ints<int8_t,simd_abi::avx>();
+    test_narrow_ints<uint8_t,simd_abi::avx>();
+    test_narrow_ints<int16_t,simd_abi::avx>();
+#endif
+#ifdef FASTOR_SSE2_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of 8 and 16 bit integers - 128")));
+    test_narrow_ints<int8_t,simd_abi::sse>();
+    test_narrow_ints<uint8_t,simd_abi::sse>();
+    test_narrow_ints<int16_t,simd_abi::sse>();
+#endif
+
+    print(FBLU(BOLD("Testing tensors of 8 and 16 bit integers")));
+    test_narrow_int_tensors<int8_t>();
+    test_narrow_int_tensors<uint8_t>();
+    test_narrow_int_tensors<int16_t>();
+
+    print(FBLU(BOLD("Testing half precision conversions")));
+    test_half_conversions<float16>();
+    test_half_conversions<bfloat16>();
+
+#ifdef FASTOR_AVX512_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of half precision - 512")));
+    test_half_vectors<float16,simd_abi::avx512>();
+    test_half_vectors<bfloat16,simd_abi::avx512>();
+#endif
+#ifdef FASTOR_AVX_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of half precision - 256")));
+    test_half_vectors<float16,simd_abi::avx>();
+    test_half_vectors<bfloat16,simd_abi::avx>();
+#endif
+#ifdef FASTOR_SSE2_IMPL
+    print(FBLU(BOLD("Testing SIMDVector of half precision - 128")));
+    test_half_vectors<float16,simd_abi::sse>();
+    test_half_vectors<bfloat16,simd_abi::sse>();
+#endif
+
+    print(FBLU(BOLD("Testing tensors of half precision")));
+    test_half_tensors<float16>();
+    test_half_tensors<bfloat16>();
+
+    return 0;
+}
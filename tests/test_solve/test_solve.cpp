@@ -268,6 +268,37 @@ void test_solve() {
         FASTOR_EXIT_ASSERT(std::abs(sum(solve<SolveCompType::SimpleLUPiv>(A,b) - sol)) < BigTol);
     }
 
+    // mixed precision - factorised in single precision and refined in double
+    {
+        constexpr size_t M = 12;
+        Tensor<T,M,M> a; a.random();
+        Tensor<T,M,M> A = matmul(a,transpose(a));
+        for (size_t i=0; i<M; ++i) A(i,i) += T(1);
+        Tensor<T,M> b; b.random();
+        Tensor<T,M,3> B; B.random();
+
+        const T scale = norm(A)*norm(solve<SolveCompType::BlockLUPiv>(A,b));
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::MixedLU  >(A,b)) - b) < Tol*scale);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::MixedChol>(A,b)) - b) < Tol*scale);
+
+        const T Scale = norm(A)*norm(solve<SolveCompType::BlockLUPiv>(A,B));
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::MixedLU  >(A,B)) - B) < Tol*Scale);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::MixedChol>(A,B)) - B) < Tol*Scale);
+
+        // too ill-conditioned for single precision, solved in double instead
+        Tensor<T,M,M> H;
+        for (size_t i=0; i<M; ++i)
+            for (size_t j=0; j<M; ++j)
+                H(i,j) = T(1) / T(i+j+1);
+        Tensor<T,M> h = solve<SolveCompType::MixedLU>(H,b);
+        FASTOR_EXIT_ASSERT(norm(matmul(H,h) - b) < Tol*norm(H)*norm(h));
+
+        // single precision storage
+        Tensor<float,M> xf = solve<SolveCompType::MixedLU>(A.template cast<float>(),b.template cast<float>());
+        Tensor<T,M> x = solve<SolveCompType::BlockLUPiv>(A.template cast<float>().template cast<T>(),b.template cast<float>().template cast<T>());
+        FASTOR_EXIT_ASSERT(norm(xf.template cast<T>() - x) < 1e-6*norm(x));
+    }
+
     // complex valued solve - issue 110
     {
         using TT = std::complex<double>;
@@ -0,0 +1,196 @@
+#include <Fastor/Fastor.h>
+#include <vector>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+constexpr size_t NMATS = 21;
+
+// A set of general matrices including singular, repeated singular values and reflections
+template<typename T, size_t M>
+void make_matrices(Tensor<T,M,M> (&mats)[NMATS]) {
+    for (size_t n=0; n<16; ++n) {
+        for (size_t i=0; i<M; ++i) {
+            for (size_t j=0; j<M; ++j) {
+                mats[n](i,j) = T(std::sin(T(n*M*M + i*M + j + 1)*T(1.7)));
+            }
+        }
+    }
+    mats[16].eye2();
+    mats[17].fill(0);
+    mats[18].fill(1);
+    mats[19].eye2(); mats[19](0,0) = -1;
+    mats[20].eye2(); mats[20] *= 1e4; mats[20](M-1,M-1) = 1e-3;
+}
+
+template<typename T, size_t M>
+Tensor<T,M,M> make_diag(const Tensor<T,M> &d) {
+    Tensor<T,M,M> D(0);
+    for (size_t i=0; i<M; ++i) D(i,i) = d(i);
+    return D;
+}
+
+template<typename T, size_t M>
+bool is_orthogonal(const Tensor<T,M,M> &Q, T tol) {
+    Tensor<T,M,M> I; I.eye2();
+    return norm(matmul(transpose(Q),Q) - I) < tol;
+}
+
+template<typename T, size_t M>
+void test_eigh() {
+    const T tol = sizeof(T) == 4 ? T(1e-4) : T(1e-10);
+    Tensor<T,M,M> mats[NMATS];
+    make_matrices(mats);
+    for (const auto &B : mats) {
+        Tensor<T,M,M> A = B + transpose(B);
+        Tensor<T,M> w;
+        Tensor<T,M,M> V;
+        eigh(A,w,V);
+
+        FASTOR_EXIT_ASSERT(is_orthogonal(V,tol));
+        FASTOR_EXIT_ASSERT(norm(matmul(A,V) - matmul(V,make_diag(w))) < tol*(1+norm(A)));
+        for (size_t i=1; i<M; ++i) FASTOR_EXIT_ASSERT(w(i-1) <= w(i));
+        FASTOR_EXIT_ASSERT(std::abs(sum(w) - trace(A)) < tol*(1+norm(A)));
+
+        // expressions
+        Tensor<T,M> w1 = eigvalsh(A);
+        Tensor<T,M,M> V1;
+        eigh(A+0,w1,V1);
+        FASTOR_EXIT_ASSERT(norm(w1 - w) < tol*(1+norm(A)));
+    }
+
+    // known values
+    {
+        Tensor<T,M,M> A; A.eye2();
+        A(0,0) = 3; A(M-1,M-1) = -2;
+        Tensor<T,M> w = eigvalsh(A);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) + 2) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(M-1) - 3) < BigTol);
+    }
+}
+
+template<typename T, size_t M>
+void test_svd() {
+    const T tol = sizeof(T) == 4 ? T(1e-4) : T(1e-10);
+    Tensor<T,M,M> mats[NMATS];
+    make_matrices(mats);
+    for (const auto &A : mats) {
+        Tensor<T,M,M> U, V;
+        Tensor<T,M> s;
+        svd(A,U,s,V);
+
+        FASTOR_EXIT_ASSERT(is_orthogonal(U,tol));
+        FASTOR_EXIT_ASSERT(is_orthogonal(V,tol));
+        FASTOR_EXIT_ASSERT(norm(matmul(matmul(U,make_diag(s)),transpose(V)) - A) < tol*(1+norm(A)));
+        for (size_t i=0; i<M; ++i) FASTOR_EXIT_ASSERT(s(i) >= 0);
+        for (size_t i=1; i<M; ++i) FASTOR_EXIT_ASSERT(s(i-1) >= s(i));
+        FASTOR_EXIT_ASSERT(std::abs(product(s) - std::abs(determinant(A))) < tol*(1+std::pow(norm(A),T(M))));
+
+        Tensor<T,M> s1 = svdvals(A);
+        FASTOR_EXIT_ASSERT(norm(s1 - s) < tol*(1+norm(A)));
+
+        // polar decomposition
+        Tensor<T,M,M> R, Us;
+        polar(A,R,Us);
+        FASTOR_EXIT_ASSERT(is_orthogonal(R,tol));
+        FASTOR_EXIT_ASSERT(norm(Us - transpose(Us)) < tol*(1+norm(A)));
+        FASTOR_EXIT_ASSERT(norm(matmul(R,Us) - A) < tol*(1+norm(A)));
+        Tensor<T,M> wu = eigvalsh(Us);
+        FASTOR_EXIT_ASSERT(wu(0) > -tol*(1+norm(A)));
+        if (determinant(A) > tol) {
+            FASTOR_EXIT_ASSERT(std::abs(determinant(R) - 1) < tol);
+        }
+
+        Tensor<T,M,M> R1, Us1;
+        polar(A+0,R1,Us1);
+        FASTOR_EXIT_ASSERT(norm(Us1 - Us) < tol*(1+norm(A)));
+    }
+
+    // rotation times stretch is recovered
+    {
+        Tensor<T,M,M> Q, Ustretch; Q.eye2(); Ustretch.eye2();
+        const T theta = T(0.3);
+        Q(0,0) =  std::cos(theta); Q(0,1) = -std::sin(theta);
+        Q(1,0) =  std::sin(theta); Q(1,1) =  std::cos(theta);
+        Ustretch(0,0) = 2; Ustretch(1,1) = T(0.5); Ustretch(0,1) = Ustretch(1,0) = T(0.1);
+        Tensor<T,M,M> F = matmul(Q,Ustretch);
+        Tensor<T,M,M> R, Us;
+        polar(F,R,Us);
+        FASTOR_EXIT_ASSERT(norm(R - Q) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(Us - Ustretch) < BigTol);
+    }
+}
+
+template<typename T, size_t M>
+void test_batched() {
+    const T tol = sizeof(T) == 4 ? T(1e-4) : T(1e-10);
+    Tensor<T,M,M> mats[NMATS];
+    make_matrices(mats);
+    constexpr size_t nbatch = NMATS;
+
+    Tensor<T,M,M> a[nbatch], V[nbatch], U[nbatch], R[nbatch];
+    Tensor<T,M> w[nbatch], s[nbatch];
+    for (size_t b=0; b<nbatch; ++b) a[b] = mats[b] + transpose(mats[b]);
+
+    std::vector<T> pa(batch_storage_size<T,M,M>(nbatch)), pv(batch_storage_size<T,M,M>(nbatch));
+    std::vector<T> pu(batch_storage_size<T,M,M>(nbatch)), pw(batch_storage_size<T,M>(nbatch));
+
+    // eigh
+    batch_pack(a,pa.data(),nbatch);
+    batch_eigh<T,M>(pa.data(),pw.data(),pv.data(),nbatch);
+    batch_unpack(pw.data(),w,nbatch);
+    batch_unpack(pv.data(),V,nbatch);
+    for (size_t b=0; b<nbatch; ++b) {
+        Tensor<T,M> we; Tensor<T,M,M> Ve;
+        eigh(a[b],we,Ve);
+        FASTOR_EXIT_ASSERT(norm(w[b] - we) < tol*(1+norm(a[b])));
+        FASTOR_EXIT_ASSERT(norm(matmul(a[b],V[b]) - matmul(V[b],make_diag(w[b]))) < tol*(1+norm(a[b])));
+    }
+
+    // svd
+    batch_pack(mats,pa.data(),nbatch);
+    batch_svd<T,M>(pa.data(),pu.data(),pw.data(),pv.data(),nbatch);
+    batch_unpack(pu.data(),U,nbatch);
+    batch_unpack(pw.data(),s,nbatch);
+    batch_unpack(pv.data(),V,nbatch);
+    for (size_t b=0; b<nbatch; ++b) {
+        FASTOR_EXIT_ASSERT(norm(s[b] - svdvals(mats[b])) < tol*(1+norm(mats[b])));
+        FASTOR_EXIT_ASSERT(norm(matmul(matmul(U[b],make_diag(s[b])),transpose(V[b])) - mats[b]) < tol*(1+norm(mats[b])));
+    }
+
+    // polar
+    batch_polar<T,M>(pa.data(),pu.data(),pv.data(),nbatch);
+    batch_unpack(pu.data(),R,nbatch);
+    batch_unpack(pv.data(),U,nbatch);
+    for (size_t b=0; b<nbatch; ++b) {
+        FASTOR_EXIT_ASSERT(is_orthogonal(R[b],tol));
+        FASTOR_EXIT_ASSERT(norm(matmul(R[b],U[b]) - mats[b]) < tol*(1+norm(mats[b])));
+    }
+}
+
+template<typename T>
+void test_all() {
+    test_eigh<T,2>();
+    test_eigh<T,3>();
+    test_svd<T,2>();
+    test_svd<T,3>();
+    test_batched<T,2>();
+    test_batched<T,3>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing eigen, singular value and polar decompositions: single precision")));
+    test_all<float>();
+    print(FBLU(BOLD("Testing eigen, singular value and polar decompositions: double precision")));
+    test_all<double>();
+
+    return 0;
+}
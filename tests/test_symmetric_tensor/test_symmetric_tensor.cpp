@@ -0,0 +1,118 @@
+#include <Fastor/Fastor.h>
+#include <Fastor/experimental/SymmetricTensor.h>
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+enum {i,j,k,l,m,n,o,p};
+
+// A fourth order tensor with minor and major symmetries
+template<typename T, size_t N>
+Tensor<T,N,N,N,N> make_elasticity() {
+    Tensor<T,N,N> I; I.eye2();
+    Tensor<T,N,N> A; A.iota(1); A /= 10;
+    Tensor<T,N,N> S = A + transpose(A);
+    Tensor<T,N,N,N,N> C = 2*outer(I,I) + outer(S,S) + permute<Index<0,2,1,3>>(outer(I,I)) + permute<Index<0,3,2,1>>(outer(I,I));
+    return C;
+}
+
+template<typename T, size_t N>
+void run() {
+
+    // storage and element access
+    {
+        Tensor<T,N,N> A; A.iota(1);
+        Tensor<T,N,N> S = A + transpose(A);
+        SymmetricTensor<T,N,N> s(S);
+        FASTOR_EXIT_ASSERT(s.packed_size() == N*(N+1)/2);
+        Tensor<T,N,N> S2 = s;
+        FASTOR_EXIT_ASSERT(max(abs(S-S2)) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(trace(s) - trace(S)) < Tol);
+
+        s(0,N-1) = 42;
+        FASTOR_EXIT_ASSERT(std::abs(s(N-1,0) - 42) < Tol);
+
+        Tensor<T,N,N,N,N> C = make_elasticity<T,N>();
+        SymmetricTensor<T,N,N,N,N> c(C);
+        constexpr size_t M = N*(N+1)/2;
+        FASTOR_EXIT_ASSERT(c.packed_size() == M*(M+1)/2);
+        Tensor<T,N,N,N,N> C2 = c;
+        FASTOR_EXIT_ASSERT(max(abs(C-C2)) < Tol);
+        FASTOR_EXIT_ASSERT(max(abs(voigt(C)-voigt(c))) < BigTol);
+        FASTOR_EXIT_ASSERT(max(abs(voigt(S)-voigt(SymmetricTensor<T,N,N>(S)))) < BigTol);
+
+        // mixed expressions evaluate to dense tensors
+        Tensor<T,N,N> D = 2*SymmetricTensor<T,N,N>(S) - A;
+        FASTOR_EXIT_ASSERT(max(abs(D-(2*S-A))) < Tol);
+        Tensor<T,N,N> E = 3*SymmetricTensor<T,N,N>(S) + SymmetricTensor<T,N,N>(S);
+        FASTOR_EXIT_ASSERT(max(abs(E-4*S)) < Tol);
+    }
+
+    // contractions
+    {
+        Tensor<T,N,N> A; A.iota(1); A /= 10;
+        Tensor<T,N,N> S = A + transpose(A);
+        Tensor<T,N,N,N,N> C = make_elasticity<T,N>();
+        SymmetricTensor<T,N,N> s(S);
+        SymmetricTensor<T,N,N,N,N> c(C);
+
+        FASTOR_EXIT_ASSERT(std::abs(inner(s,s) - inner(S,S)) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(inner(s,A) - inner(S,A)) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(inner(c,c) - inner(C,C)) < BigTol*inner(C,C));
+        FASTOR_EXIT_ASSERT(std::abs(einsum<Index<i,j>,Index<i,j>>(s,s).toscalar() - inner(S,S)) < BigTol);
+
+        Tensor<T,N,N> s1 = einsum<Index<i,j,k,l>,Index<k,l>>(c,s);
+        Tensor<T,N,N> s2 = einsum<Index<i,j,k,l>,Index<k,l>>(C,S);
+        FASTOR_EXIT_ASSERT(max(abs(s1-s2)) < BigTol*max(abs(s2)));
+
+        // a non-symmetric operand only enters through its symmetric part
+        s1 = einsum<Index<i,j,k,l>,Index<k,l>>(c,A);
+        s2 = einsum<Index<i,j,k,l>,Index<k,l>>(C,A);
+        FASTOR_EXIT_ASSERT(max(abs(s1-s2)) < BigTol*max(abs(s2)));
+
+        s1 = einsum<Index<i,j>,Index<i,j,k,l>>(A,c);
+        s2 = einsum<Index<i,j>,Index<i,j,k,l>>(A,C);
+        FASTOR_EXIT_ASSERT(max(abs(s1-s2)) < BigTol*max(abs(s2)));
+
+        // contractions without a specialised kernel fall back to dense tensors
+        Tensor<T,N,N,N,N> cc1 = einsum<Index<i,j,k,l>,Index<k,l,m,n>>(c,c);
+        Tensor<T,N,N,N,N> cc2 = einsum<Index<i,j,k,l>,Index<k,l,m,n>>(C,C);
+        FASTOR_EXIT_ASSERT(max(abs(cc1-cc2)) < BigTol*max(abs(cc2)));
+    }
+
+    // push-forward
+    {
+        Tensor<T,N,N> F; F.iota(1); F /= 10; F += 1;
+        Tensor<T,N,N> A; A.iota(1); A /= 10;
+        Tensor<T,N,N> S = A + transpose(A);
+        Tensor<T,N,N,N,N> C = make_elasticity<T,N>();
+
+        Tensor<T,N,N> s1 = push_forward(SymmetricTensor<T,N,N>(S),F);
+        Tensor<T,N,N> s2 = matmul(F,matmul(S,transpose(F)));
+        FASTOR_EXIT_ASSERT(max(abs(s1-s2)) < BigTol*max(abs(s2)));
+
+        Tensor<T,N,N,N,N> c1 = push_forward(SymmetricTensor<T,N,N,N,N>(C),F);
+        Tensor<T,N,N,N,N> c2 = einsum<Index<i,m>,Index<j,n>,Index<k,o>,Index<l,p>,Index<m,n,o,p>>(F,F,F,F,C);
+        FASTOR_EXIT_ASSERT(max(abs(c1-c2)) < BigTol*max(abs(c2)));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing symmetric tensors: single precision 2D")));
+    run<float,2>();
+    print(FBLU(BOLD("Testing symmetric tensors: single precision 3D")));
+    run<float,3>();
+    print(FBLU(BOLD("Testing symmetric tensors: double precision 2D")));
+    run<double,2>();
+    print(FBLU(BOLD("Testing symmetric tensors: double precision 3D")));
+    run<double,3>();
+
+    return 0;
+}
@@ -7,6 +7,52 @@ using namespace Fastor;
 #define BigTol 1e-5
 
 
+// Sizes that are not a multiple of the SIMD width finish their loops with a masked vector
+// where supported. The entries past the end of a tensor must be left untouched
+template<typename T, size_t M>
+void test_tails() {
+    Tensor<T,M> a, b, c;
+    a.iota(1); b.iota(2);
+
+    c = a + T(2)*b;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(c(i) - T(3*i+5)) < Tol);
+    }
+    c += a; c -= b; c *= a; c /= b;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(c(i) - T(3*i+4)*T(i+1)/T(i+2)) < BigTol);
+    }
+    c = T(5); c += T(1); c *= T(2); c -= T(2); c /= T(2);
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(c(i) - T(5)) < Tol);
+    }
+
+    FASTOR_EXIT_ASSERT(std::abs(sum(a) - T(M*(M+1)/2)) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(sum(a+b) - T(M*(M+2))) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(product(a/a) - T(1)) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(min(a) - T(1)) < Tol);
+    FASTOR_EXIT_ASSERT(std::abs(max(a) - T(M)) < Tol);
+
+    FASTOR_ALIGN T buffer[M+16];
+    std::fill(buffer, buffer+M+16, T(-7));
+    TensorMap<T,M> ma(buffer);
+    ma = a + b; ma += a; ma *= T(2);
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(buffer[i] - T(6*i+8)) < Tol);
+    }
+    for (size_t i=M; i<M+16; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(buffer[i] + T(7)) < Tol);
+    }
+
+    DynamicTensor<T,1> da(M), db(M);
+    da = a; db = sqrt(da*da) + T(1);
+    db *= da;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(db(i) - T(i+2)*T(i+1)) < Tol);
+    }
+}
+
+
 template<typename T>
 void test_basics() {
 
@@ -209,6 +255,48 @@ void test_basics() {
         unused(ss);
     }
 
+    // Outputs larger than the streaming threshold are written with non-temporal stores. The
+    // size is odd so that the scalar remainder is written as well
+    {
+        constexpr size_t N = FASTOR_STREAMING_STORE_THRESHOLD/sizeof(T) + 13;
+        DynamicTensor<T,1> a(N), b(N), c(N);
+        b.iota(0); c.fill(2);
+
+        a = b + T(3)*c;
+        for (size_t i=0; i<N; ++i) {
+            FASTOR_EXIT_ASSERT(std::abs(a(i) - b(i) - T(6)) < Tol);
+        }
+        a = T(7);
+        for (size_t i=0; i<N; ++i) {
+            FASTOR_EXIT_ASSERT(std::abs(a(i) - T(7)) < Tol);
+        }
+        a = b;
+        FASTOR_EXIT_ASSERT(std::abs(a(N-1) - T(N-1)) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(sum(a) - sum(b)) < BigTol*std::abs(sum(b)));
+
+        TensorMap<T,N> ma(a.data());
+        ma = c*c;
+        for (size_t i=0; i<N; ++i) {
+            FASTOR_EXIT_ASSERT(std::abs(a(i) - T(4)) < Tol);
+        }
+    }
+
+    // Remainders of every length up to those of the widest vectors
+    {
+        test_tails<T,1>();
+        test_tails<T,2>();
+        test_tails<T,3>();
+        test_tails<T,5>();
+        test_tails<T,7>();
+        test_tails<T,9>();
+        test_tails<T,13>();
+        test_tails<T,15>();
+        test_tails<T,17>();
+        test_tails<T,23>();
+        test_tails<T,31>();
+        test_tails<T,33>();
+    }
+
     print(FGRN(BOLD("All tests passed successfully")));
 
 }
@@ -0,0 +1,141 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+// op(A) as a dense matrix
+template<typename UpLo, bool Transpose, typename T, size_t M>
+Tensor<T,M,M> triangular_ref(const Tensor<T,M,M> &a) {
+    constexpr bool is_unit  = is_same_v_<UpLo,UpLoType::UniLower> || is_same_v_<UpLo,UpLoType::UniUpper>;
+    constexpr bool is_lower = is_same_v_<UpLo,UpLoType::Lower>    || is_same_v_<UpLo,UpLoType::UniLower>;
+
+    Tensor<T,M,M> out; out.zeros();
+    for (size_t i=0; i<M; ++i) {
+        for (size_t k=0; k<M; ++k) {
+            if (i==k) out(i,k) = is_unit ? T(1) : a(i,k);
+            else if ((is_lower && k<i) || (!is_lower && k>i)) out(i,k) = a(i,k);
+        }
+    }
+    return Transpose ? Tensor<T,M,M>(transpose(out)) : out;
+}
+
+template<typename T, size_t M, size_t N, typename UpLo, bool Transpose>
+void check_trsm() {
+
+    using std::abs;
+
+    // the other triangle is filled in to make sure it is never read
+    Tensor<T,M,M> a; a.random(); a -= T(0.5);
+    for (size_t i=0; i<M; ++i) a(i,i) = T(2) + a(i,i);
+    Tensor<T,M,N> b; b.random();
+
+    Tensor<T,M,N> x;
+    _trsm<T,M,N,UpLo,Transpose>(a.data(),b.data(),x.data());
+    Tensor<T,M,N> residual = matmul(triangular_ref<UpLo,Transpose>(a),x) - b;
+    FASTOR_EXIT_ASSERT(norm(residual) < BigTol);
+
+    // in place
+    Tensor<T,M,N> y = b;
+    _trsm<T,M,N,UpLo,Transpose>(a.data(),y.data(),y.data());
+    FASTOR_EXIT_ASSERT(norm(y - x) < Tol);
+}
+
+template<typename T, size_t M, size_t N>
+void check_trsm_all() {
+    check_trsm<T,M,N,UpLoType::Lower   ,false>();
+    check_trsm<T,M,N,UpLoType::Lower   ,true >();
+    check_trsm<T,M,N,UpLoType::UniLower,false>();
+    check_trsm<T,M,N,UpLoType::UniLower,true >();
+    check_trsm<T,M,N,UpLoType::Upper   ,false>();
+    check_trsm<T,M,N,UpLoType::Upper   ,true >();
+    check_trsm<T,M,N,UpLoType::UniUpper,false>();
+    check_trsm<T,M,N,UpLoType::UniUpper,true >();
+}
+
+template<typename T, size_t M>
+void check_lowunitri_inverse() {
+
+    Tensor<T,M,M> a; a.random(); a -= T(0.5); a /= T(M);
+    Tensor<T,M,M> L = triangular_ref<UpLoType::UniLower,false>(a);
+    Tensor<T,M,M> I; I.eye2();
+
+    Tensor<T,M,M> inv_L;
+    _lowunitri_inverse<T,M>(L.data(),inv_L.data());
+    Tensor<T,M,M> residual = matmul(L,inv_L) - I;
+    FASTOR_EXIT_ASSERT(norm(residual) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(tinverse<InvCompType::SimpleInv,UpLoType::UniLower>(L) - inv_L) < BigTol);
+}
+
+
+template<typename T>
+void test_trsm() {
+
+    using std::abs;
+
+    // single and multiple right hand sides around the SIMD widths
+    {
+        check_trsm_all<T,1,1>();
+        check_trsm_all<T,2,1>();
+        check_trsm_all<T,3,2>();
+        check_trsm_all<T,5,3>();
+        check_trsm_all<T,7,4>();
+        check_trsm_all<T,9,8>();
+        check_trsm_all<T,13,11>();
+        check_trsm_all<T,16,17>();
+        check_trsm_all<T,31,33>();
+        check_trsm_all<T,64,1>();
+        check_trsm_all<T,64,16>();
+        check_trsm_all<T,100,7>();
+        check_trsm_all<T,128,64>();
+    }
+
+    // inverse of lower unitriangular matrices
+    {
+        check_lowunitri_inverse<T,5>();
+        check_lowunitri_inverse<T,12>();
+        check_lowunitri_inverse<T,17>();
+        check_lowunitri_inverse<T,40>();
+        check_lowunitri_inverse<T,67>();
+    }
+
+    // LU and Cholesky solves built on top of TRSM
+    {
+        constexpr size_t M = 35;
+        Tensor<T,M,M> a; a.random();
+        Tensor<T,M,M> spd = matmul(a,transpose(a));
+        for (size_t i=0; i<M; ++i) spd(i,i) += T(M);
+        Tensor<T,M> b; b.random();
+        Tensor<T,M,6> B; B.random();
+
+        Tensor<T,M> x0 = solve<SolveCompType::BlockLU>(spd,b);
+        Tensor<T,M> x1 = solve<SolveCompType::BlockLUPiv>(spd,b);
+        Tensor<T,M> x2 = solve<SolveCompType::Chol>(spd,b);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,x0) - b) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,x1) - b) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,x2) - b) < BigTol);
+
+        Tensor<T,M,6> X0 = solve<SolveCompType::BlockLU>(spd,B);
+        Tensor<T,M,6> X1 = solve<SolveCompType::BlockLUPiv>(spd,B);
+        Tensor<T,M,6> X2 = solve<SolveCompType::Chol>(spd,B);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,X0) - B) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,X1) - B) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,X2) - B) < BigTol);
+
+        Tensor<T,M,M> I; I.eye2();
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,inverse<InvCompType::BlockLU>(spd)) - I) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(spd,inverse<InvCompType::Chol>(spd)) - I) < BigTol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing triangular solve: double precision")));
+    test_trsm<double>();
+
+    return 0;
+}
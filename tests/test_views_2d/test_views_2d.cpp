@@ -130,13 +130,71 @@ void run() {
     }
 }
 
+// Views whose rows are not a multiple of the SIMD width, so that SIMD vectors
+// evaluated through the flat index straddle rows
+template<typename T>
+void run_rows() {
+
+    using std::abs;
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    {
+        Tensor<T,17,23> a; a.iota(1);
+        for (int s0=1; s0<4; ++s0) {
+            for (int s1=1; s1<4; ++s1) {
+                for (int f1=0; f1<3; ++f1) {
+                    auto v = a(seq(1,17,s0),seq(f1,23,s1));
+                    const int m = v.dimension(0), n = v.dimension(1);
+                    for (int i=0; i<m*n; ++i) {
+                        FASTOR_EXIT_ASSERT(abs(v.template eval_s<T>(i) - a(1+(i/n)*s0,f1+(i%n)*s1)) < Tol);
+                    }
+                    for (int i=0; i+(int)V::Size<=m*n; ++i) {
+                        const V vec = v.template eval<T>(i);
+                        for (int j=0; j<(int)V::Size; ++j) {
+                            FASTOR_EXIT_ASSERT(abs(vec[j] - a(1+((i+j)/n)*s0,f1+((i+j)%n)*s1)) < Tol);
+                        }
+                    }
+                }
+            }
+        }
+
+        Tensor<T,8,11> b = a(seq(1,17,2),seq(0,22,2));
+        for (int i=0; i<8; ++i)
+            for (int j=0; j<11; ++j)
+                FASTOR_EXIT_ASSERT(abs(b(i,j) - a(1+2*i,2*j)) < Tol);
+
+        const Tensor<T,17,23>& ca = a;
+        Tensor<T,8,11> c = ca(seq(1,17,2),seq(1,23,2));
+        for (int i=0; i<8; ++i)
+            for (int j=0; j<11; ++j)
+                FASTOR_EXIT_ASSERT(abs(c(i,j) - a(1+2*i,1+2*j)) < Tol);
+
+        c += a(seq(1,17,2),seq(0,22,2));
+        c -= ca(seq(1,17,2),seq(0,22,2));
+        c *= a(seq(1,17,2),seq(0,22,2));
+        c /= ca(seq(1,17,2),seq(0,22,2));
+        for (int i=0; i<8; ++i)
+            for (int j=0; j<11; ++j)
+                FASTOR_EXIT_ASSERT(abs(c(i,j) - a(1+2*i,1+2*j)) < BigTol);
+
+        Tensor<T,8,11> d = 2*a(seq(1,17,2),seq(0,22,2)) + b;
+        for (int i=0; i<8; ++i)
+            for (int j=0; j<11; ++j)
+                FASTOR_EXIT_ASSERT(abs(d(i,j) - 3*a(1+2*i,2*j)) < Tol);
+
+        print(FGRN(BOLD("All tests passed successfully")));
+    }
+}
+
 int main() {
 
     print(FBLU(BOLD("Testing 2-dimensional tensor views: single precision")));
     run<float>();
     print(FBLU(BOLD("Testing 2-dimensional tensor views: double precision")));
     run<double>();
-
+    print(FBLU(BOLD("Testing 2-dimensional tensor views straddling rows: single precision")));
+    run_rows<float>();
+    print(FBLU(BOLD("Testing 2-dimensional tensor views straddling rows: double precision")));
+    run_rows<double>();
 
     return 0;
 }
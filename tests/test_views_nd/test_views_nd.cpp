@@ -147,6 +147,45 @@ void run() {
 }
 
 
+// Views whose last dimension is not a multiple of the SIMD width, so that SIMD
+// vectors evaluated through the flat index straddle rows
+template<typename T>
+void run_rows() {
+
+    using std::abs;
+    {
+        Tensor<T,6,7,5,9> a; a.iota(1);
+        Tensor<T,3,4,5,3> b = a(seq(0,6,2),seq(1,5),sall,seq(1,9,3));
+        for (int i=0; i<3; ++i)
+            for (int j=0; j<4; ++j)
+                for (int k=0; k<5; ++k)
+                    for (int l=0; l<3; ++l)
+                        FASTOR_EXIT_ASSERT(abs(b(i,j,k,l) - a(2*i,1+j,k,1+3*l)) < Tol);
+
+        const Tensor<T,6,7,5,9>& ca = a;
+        Tensor<T,3,4,5,3> c = ca(seq(0,6,2),seq(1,5),sall,seq(1,9,3));
+        c += a(seq(0,6,2),seq(1,5),sall,seq(1,9,3));
+        c *= ca(seq(0,6,2),seq(1,5),sall,seq(1,9,3));
+        Tensor<T,3,4,5,3> d = 2*a(seq(0,6,2),seq(1,5),sall,seq(1,9,3)) + b;
+        for (int i=0; i<3; ++i)
+            for (int j=0; j<4; ++j)
+                for (int k=0; k<5; ++k)
+                    for (int l=0; l<3; ++l) {
+                        FASTOR_EXIT_ASSERT(abs(c(i,j,k,l) - 2*b(i,j,k,l)*b(i,j,k,l)) < BigTol);
+                        FASTOR_EXIT_ASSERT(abs(d(i,j,k,l) - 3*b(i,j,k,l)) < Tol);
+                    }
+
+        Tensor<T,2,7,5,9> e = a(seq(1,6,3),sall,sall,sall);
+        for (int i=0; i<2; ++i)
+            for (int j=0; j<7; ++j)
+                for (int k=0; k<5; ++k)
+                    for (int l=0; l<9; ++l)
+                        FASTOR_EXIT_ASSERT(abs(e(i,j,k,l) - a(1+3*i,j,k,l)) < Tol);
+
+        print(FGRN(BOLD("All tests passed successfully")));
+    }
+}
+
 
 int main() {
 
@@ -154,6 +193,10 @@ int main() {
     run<float>();
     print(FBLU(BOLD("Testing multi-dimensional tensor views: double precision")));
     run<double>();
+    print(FBLU(BOLD("Testing multi-dimensional tensor views straddling rows: single precision")));
+    run_rows<float>();
+    print(FBLU(BOLD("Testing multi-dimensional tensor views straddling rows: double precision")));
+    run_rows<double>();
 
     return 0;
 }
@@ -0,0 +1,357 @@
+// Offline generator of exact-shape GEMM kernels for Fastor
+//
+// Emits a header of register-blocked kernels C[M,N] = A[M,K] * B[K,N] for a list of shapes
+// known ahead of time, for instance the element matrices of a finite element code. For every
+// instruction set the columns of C are split in to full SIMD vectors and a remainder that is
+// either masked in the narrowest vector that covers it [AVX512] or covered with narrower vectors
+// and scalars, the rows are blocked so that the accumulators of a block stay in registers and
+// short reductions are fully unrolled.
+// The generated header is picked up by _matmul when it is compiled with
+//
+//      -DFASTOR_GEMM_KERNELS_HEADER="\"path/to/header.h\""
+//
+// see Fastor/backend/matmul/gemm_kernels.h and cmake/FastorGemmKernels.cmake
+//
+// Usage:
+//      gemm_codegen [-o header.h] [-t float|double]... [-a sse|avx|avx512|neon]... MxKxN...
+//
+// By default kernels are generated for double precision and all instruction sets
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+struct Shape {
+    size_t M, K, N;
+};
+
+struct ABI {
+    std::string name;
+    std::string guard;
+    size_t bits;
+    size_t registers;
+    bool has_masks;
+};
+
+struct ScalarType {
+    std::string name;
+    size_t bytes;
+};
+
+// A group of columns of C held in one SIMD register per row
+struct ColumnGroup {
+    size_t offset;
+    size_t width;
+    std::string vector_type;
+    bool masked;
+};
+
+
+static const std::vector<ABI> all_abis = {
+    // widest first, as the instruction sets imply each other
+    {"avx512", "FASTOR_AVX512_IMPL", 512, 32, true },
+    {"avx"   , "FASTOR_AVX_IMPL"   , 256, 16, false},
+    {"sse"   , "FASTOR_SSE2_IMPL"  , 128, 16, false},
+    {"neon"  , "FASTOR_NEON_IMPL"  , 128, 32, false},
+};
+
+static const std::vector<ScalarType> all_types = {
+    {"float" , 4},
+    {"double", 8},
+};
+
+
+// Instruction set of a vector of the given width or an empty string if there is none
+static std::string abi_of_width(const ABI &abi, const ScalarType &type, size_t width) {
+    const size_t bits = width*type.bytes*8;
+    if (width == 1)                     return "simd_abi::scalar";
+    if (bits > abi.bits)                return "";
+    if (abi.name == "neon")             return bits == 128 ? "simd_abi::neon" : "";
+    if (bits == 512)                    return "simd_abi::avx512";
+    if (bits == 256)                    return "simd_abi::avx";
+    if (bits == 128)                    return "simd_abi::sse";
+    return "";
+}
+
+static std::vector<ColumnGroup> column_groups(const ABI &abi, const ScalarType &type, size_t N) {
+    std::vector<ColumnGroup> groups;
+    const size_t W = abi.bits / 8 / type.bytes;
+    const std::string V = "SIMDVector<" + type.name + "," + abi_of_width(abi,type,W) + ">";
+
+    size_t j = 0;
+    for (; j + W <= N; j += W) {
+        groups.push_back({j, W, V, false});
+    }
+    size_t rem = N - j;
+    if (rem == 0) return groups;
+
+    if (abi.has_masks && rem > 1) {
+        // the narrowest vector that covers the remainder
+        size_t w = W;
+        while (w/2 >= rem && !abi_of_width(abi,type,w/2).empty()) w /= 2;
+        groups.push_back({j, rem, "SIMDVector<" + type.name + "," + abi_of_width(abi,type,w) + ">", rem != w});
+        return groups;
+    }
+    // narrower vectors first then scalars
+    for (size_t w = W/2; w > 1; w /= 2) {
+        const std::string abi_w = abi_of_width(abi,type,w);
+        if (rem >= w && !abi_w.empty()) {
+            groups.push_back({j, w, "SIMDVector<" + type.name + "," + abi_w + ">", false});
+            j += w; rem -= w;
+        }
+    }
+    for (; rem > 0; ++j, --rem) {
+        groups.push_back({j, 1, "SIMDVector<" + type.name + ",simd_abi::scalar>", false});
+    }
+    return groups;
+}
+
+
+class KernelWriter {
+public:
+    KernelWriter(std::ostream &os, const ABI &abi, const ScalarType &type, const Shape &shape)
+        : os(os), abi(abi), type(type), shape(shape) {}
+
+    void write() {
+        const size_t M = shape.M, N = shape.N;
+        const std::vector<ColumnGroup> groups = column_groups(abi,type,N);
+
+        // At most this many column groups are kept in registers at a time, leaving
+        // room for a block of at least four rows, the row of B and a broadcast of A
+        const size_t max_groups = std::max<size_t>(1, (abi.registers - 1) / 5);
+
+        os << "template<>\n";
+        os << "struct gemm_kernel<" << type.name << "," << M << "," << shape.K << "," << N << "> {\n";
+        os << "    static constexpr bool value = true;\n";
+        os << "    static FASTOR_INLINE void apply(const " << type.name << " * FASTOR_RESTRICT a, const "
+           << type.name << " * FASTOR_RESTRICT b, " << type.name << " * FASTOR_RESTRICT c) {\n";
+
+        for (size_t g0 = 0; g0 < groups.size(); g0 += max_groups) {
+            const size_t g1 = std::min(groups.size(), g0 + max_groups);
+            const std::vector<ColumnGroup> chunk(groups.begin() + g0, groups.begin() + g1);
+            const size_t ng = chunk.size();
+
+            // Rows per block as evenly spread as the registers allow
+            const size_t max_rows = std::min<size_t>(8, std::max<size_t>(1, (abi.registers - ng - 1) / ng));
+            const size_t nblocks  = (M + max_rows - 1) / max_rows;
+            const size_t rows     = (M + nblocks - 1) / nblocks;
+            const size_t M0       = M / rows * rows;
+
+            os << "        // columns " << chunk.front().offset << " to "
+               << chunk.back().offset + chunk.back().width << "\n";
+            if (M0 == rows) {
+                os << "        {\n";
+                os << "            constexpr size_t i = 0;\n";
+                write_block(chunk, rows, "            ");
+                os << "        }\n";
+            }
+            else if (M0 > 0) {
+                os << "        for (size_t i = 0; i < " << M0 << "; i += " << rows << ") {\n";
+                write_block(chunk, rows, "            ");
+                os << "        }\n";
+            }
+            if (M0 < M) {
+                os << "        {\n";
+                os << "            constexpr size_t i = " << M0 << ";\n";
+                write_block(chunk, M - M0, "            ");
+                os << "        }\n";
+            }
+        }
+        os << "    }\n";
+        os << "};\n";
+    }
+
+private:
+    static std::string acc(size_t r, size_t g) {
+        return "c" + std::to_string(r) + "_" + std::to_string(g);
+    }
+
+    static std::string mask_literal(size_t width) {
+        std::ostringstream ss;
+        ss << "0x" << std::hex << ((1ULL << width) - 1ULL);
+        return ss.str();
+    }
+
+    void write_k_step(const std::vector<ColumnGroup> &chunk, size_t rows, const std::string &k, const std::string &indent) {
+        const size_t K = shape.K, N = shape.N;
+        for (size_t g = 0; g < chunk.size(); ++g) {
+            const ColumnGroup &cg = chunk[g];
+            const std::string ptr = "&b[" + k + "*" + std::to_string(N) + "+" + std::to_string(cg.offset) + "]";
+            if (cg.masked) {
+                os << indent << cg.vector_type << " b" << g << "; b" << g << ".mask_load(" << ptr << ","
+                   << mask_literal(cg.width) << ",false);\n";
+            }
+            else {
+                os << indent << "const " << cg.vector_type << " b" << g << "(" << ptr << ",false);\n";
+            }
+        }
+        for (size_t r = 0; r < rows; ++r) {
+            os << indent << "{\n";
+            os << indent << "    const " << type.name << " a" << r << " = a[(i+" << r << ")*" << K << "+" << k << "];\n";
+            for (size_t g = 0; g < chunk.size(); ++g) {
+                os << indent << "    " << acc(r,g) << " = fmadd(" << chunk[g].vector_type << "(a" << r << "),b" << g
+                   << "," << acc(r,g) << ");\n";
+            }
+            os << indent << "}\n";
+        }
+    }
+
+    void write_block(const std::vector<ColumnGroup> &chunk, size_t rows, const std::string &indent) {
+        const size_t K = shape.K, N = shape.N;
+        for (size_t g = 0; g < chunk.size(); ++g) {
+            os << indent << chunk[g].vector_type;
+            for (size_t r = 0; r < rows; ++r) {
+                os << (r == 0 ? " " : ", ") << acc(r,g);
+            }
+            os << ";\n";
+        }
+
+        // short reductions are fully unrolled
+        if (K <= 16) {
+            for (size_t k = 0; k < K; ++k) {
+                os << indent << "{\n";
+                write_k_step(chunk, rows, std::to_string(k), indent + "    ");
+                os << indent << "}\n";
+            }
+        }
+        else {
+            os << indent << "for (size_t k = 0; k < " << K << "; ++k) {\n";
+            write_k_step(chunk, rows, "k", indent + "    ");
+            os << indent << "}\n";
+        }
+
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t g = 0; g < chunk.size(); ++g) {
+                const ColumnGroup &cg = chunk[g];
+                const std::string ptr = "&c[(i+" + std::to_string(r) + ")*" + std::to_string(N) + "+" + std::to_string(cg.offset) + "]";
+                if (cg.masked) {
+                    os << indent << acc(r,g) << ".mask_store(" << ptr << "," << mask_literal(cg.width) << ",false);\n";
+                }
+                else {
+                    os << indent << acc(r,g) << ".store(" << ptr << ",false);\n";
+                }
+            }
+        }
+    }
+
+    std::ostream &os;
+    const ABI &abi;
+    const ScalarType &type;
+    const Shape &shape;
+};
+
+
+static bool parse_shape(const std::string &str, Shape &shape) {
+    char x0, x1;
+    std::istringstream ss(str);
+    if (!(ss >> shape.M >> x0 >> shape.K >> x1 >> shape.N)) return false;
+    return x0 == 'x' && x1 == 'x' && shape.M > 0 && shape.K > 0 && shape.N > 0 && ss.peek() == EOF;
+}
+
+// These shapes are dispatched to the hand written kernels of matmul_specialisations_kernels.h
+static bool has_specialised_kernel(const Shape &shape) {
+    return shape.M != shape.K && shape.M == shape.N &&
+        (shape.M == 2 || shape.M == 3 || shape.M == 4 || shape.M == 8);
+}
+
+static void usage() {
+    std::cerr << "Usage: gemm_codegen [-o header.h] [-t float|double]... [-a sse|avx|avx512|neon]... MxKxN...\n";
+}
+
+
+int main(int argc, char *argv[]) {
+
+    std::string output;
+    std::vector<ScalarType> types;
+    std::vector<ABI> abis;
+    std::vector<Shape> shapes;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "-o" || arg == "-t" || arg == "-a") && i + 1 == argc) {
+            usage();
+            return EXIT_FAILURE;
+        }
+        if (arg == "-o") {
+            output = argv[++i];
+        }
+        else if (arg == "-t") {
+            const std::string name = argv[++i];
+            auto it = std::find_if(all_types.begin(), all_types.end(), [&](const ScalarType &t) { return t.name == name; });
+            if (it == all_types.end()) { std::cerr << "Unknown type " << name << "\n"; return EXIT_FAILURE; }
+            types.push_back(*it);
+        }
+        else if (arg == "-a") {
+            const std::string name = argv[++i];
+            auto it = std::find_if(all_abis.begin(), all_abis.end(), [&](const ABI &a) { return a.name == name; });
+            if (it == all_abis.end()) { std::cerr << "Unknown instruction set " << name << "\n"; return EXIT_FAILURE; }
+            abis.push_back(*it);
+        }
+        else {
+            Shape shape;
+            if (!parse_shape(arg, shape)) {
+                std::cerr << "Invalid shape " << arg << ", expected MxKxN\n";
+                usage();
+                return EXIT_FAILURE;
+            }
+            if (has_specialised_kernel(shape)) {
+                std::cerr << "Skipping " << arg << " which already has a specialised kernel\n";
+                continue;
+            }
+            auto it = std::find_if(shapes.begin(), shapes.end(), [&](const Shape &s) {
+                return s.M == shape.M && s.K == shape.K && s.N == shape.N; });
+            if (it == shapes.end()) shapes.push_back(shape);
+        }
+    }
+    if (types.empty()) types.push_back(all_types[1]);
+    if (abis.empty()) abis = all_abis;
+    // keep the widest instruction set first so that the guards below pick the best one
+    std::stable_sort(abis.begin(), abis.end(), [](const ABI &a, const ABI &b) { return a.bits > b.bits; });
+
+    std::ostringstream os;
+    os << "// Generated by tools/gemm_codegen, do not edit\n";
+    os << "//\n//     gemm_codegen";
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "-o") { ++i; continue; }
+        os << " " << argv[i];
+    }
+    os << "\n\n";
+    os << "#ifndef FASTOR_DONT_VECTORISE\n\n";
+    os << "namespace Fastor {\nnamespace internal {\n\n";
+
+    for (size_t n = 0; n < abis.size(); ++n) {
+        os << (n == 0 ? "#if" : "#elif") << " defined(" << abis[n].guard << ")\n\n";
+        for (const ScalarType &type : types) {
+            for (const Shape &shape : shapes) {
+                KernelWriter(os, abis[n], type, shape).write();
+                os << "\n";
+            }
+        }
+    }
+    if (!abis.empty()) os << "#endif\n\n";
+
+    os << "} // internal\n} // end of namespace Fastor\n\n";
+    os << "#endif // FASTOR_DONT_VECTORISE\n";
+
+    if (output.empty()) {
+        std::cout << os.str();
+    }
+    else {
+        // only touch the header if it changes to avoid needless rebuilds
+        std::ifstream in(output);
+        std::stringstream existing; existing << in.rdbuf();
+        if (!in || existing.str() != os.str()) {
+            std::ofstream out(output);
+            out << os.str();
+            if (!out) { std::cerr << "Could not write " << output << "\n"; return EXIT_FAILURE; }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}